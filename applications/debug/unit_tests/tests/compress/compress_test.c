@@ -250,6 +250,12 @@ static bool file_counter(const char* name, bool is_dir, void* context) {
     return true;
 }
 
+static bool big_file_filter(const char* name, bool is_dir, void* context) {
+    UNUSED(is_dir);
+    UNUSED(context);
+    return strcmp(name, "dir/big_file.txt") != 0;
+}
+
 /*
 Heatshrink tar file contents and MD5 sums:
 file1.txt:                      64295676ceed5cce2d0dcac402e4bda4
@@ -329,6 +335,52 @@ static void compress_test_heatshrink_tar() {
             0x76};
         mu_assert(memcmp(md5_total, expected_md5, sizeof(md5_total)) == 0, "MD5 mismatch");
 
+        storage_simply_remove_recursive(api, HS_TAR_EXTRACT_PATH);
+        mu_assert(storage_simply_mkdir(api, HS_TAR_EXTRACT_PATH), "Failed to create extract dir");
+
+        tar_archive_set_file_callback(archive, big_file_filter, NULL);
+        mu_assert(
+            tar_archive_unpack_to(archive, HS_TAR_EXTRACT_PATH, NULL),
+            "Failed to unpack heatshrink tar with filter");
+        mu_assert(
+            !storage_file_exists(api, HS_TAR_EXTRACT_PATH "/dir/big_file.txt"),
+            "Skipped file was extracted");
+        mu_assert(
+            storage_file_exists(api, HS_TAR_EXTRACT_PATH "/dir/nested_dir/file4.txt"),
+            "File after skipped one was not extracted");
+
+        mu_assert(
+            tar_archive_unpack_file(archive, "dir/file3.txt", HS_TAR_EXTRACT_PATH "/file3.txt"),
+            "Failed to unpack single file");
+        mu_assert(
+            md5_calc_file(file, HS_TAR_EXTRACT_PATH "/file3.txt", md5_file, NULL),
+            "Failed to calc md5");
+
+        static const unsigned char expected_file3_md5[16] = {
+            0x34,
+            0xd9,
+            0x8a,
+            0xd8,
+            0x13,
+            0x5f,
+            0xfe,
+            0x50,
+            0x2d,
+            0xba,
+            0x37,
+            0x46,
+            0x90,
+            0x13,
+            0x6d,
+            0x16};
+        mu_assert(
+            memcmp(md5_file, expected_file3_md5, sizeof(md5_file)) == 0,
+            "Single file MD5 mismatch");
+
+        mu_assert(
+            !tar_archive_unpack_file(archive, "missing.txt", HS_TAR_EXTRACT_PATH "/missing.txt"),
+            "Unpacked missing file");
+
         storage_simply_remove_recursive(api, HS_TAR_EXTRACT_PATH);
     } while(false);
 
@@ -5,6 +5,8 @@
 #include <storage/storage.h>
 #include "../test.h" // IWYU pragma: keep
 
+#define TAG "FlipperFormatStringTest"
+
 static const char* test_filetype = "Flipper Format test";
 static const uint32_t test_version = 666;
 
@@ -327,9 +329,92 @@ MU_TEST(flipper_format_file_test) {
     furi_record_close(RECORD_STORAGE);
 }
 
+MU_TEST(flipper_format_value_format_test) {
+    FlipperFormat* flipper_format = flipper_format_string_alloc();
+    Stream* stream = flipper_format_get_raw_stream(flipper_format);
+
+    const int32_t int32_data[] = {INT32_MIN, -10, -1, 0, 9, INT32_MAX};
+    const uint32_t uint32_data[] = {0, 10, UINT32_MAX};
+    const uint64_t uint64_data[] = {0, 0x0123456789ABCDEF, UINT64_MAX};
+    const uint8_t hex_data[] = {0x00, 0x0F, 0xA5, 0xFF};
+    const bool bool_data[] = {true, false};
+
+    mu_check(flipper_format_write_int32(flipper_format, "I", ARRAY_W_COUNT(int32_data)));
+    mu_check(flipper_format_write_uint32(flipper_format, "U", ARRAY_W_COUNT(uint32_data)));
+    mu_check(flipper_format_write_hex_uint64(flipper_format, "L", ARRAY_W_COUNT(uint64_data)));
+    mu_check(flipper_format_write_hex(flipper_format, "H", ARRAY_W_COUNT(hex_data)));
+    mu_check(flipper_format_write_bool(flipper_format, "B", ARRAY_W_COUNT(bool_data)));
+
+    const char* expected = "I: -2147483648 -10 -1 0 9 2147483647\n"
+                           "U: 0 10 4294967295\n"
+                           "L: 0000000000000000 0123456789ABCDEF FFFFFFFFFFFFFFFF\n"
+                           "H: 00 0F A5 FF\n"
+                           "B: true false\n";
+    char buffer[192] = {0};
+    mu_check(stream_rewind(stream));
+    mu_assert_int_eq(strlen(expected), stream_read(stream, (uint8_t*)buffer, sizeof(buffer)));
+    mu_assert_string_eq(expected, buffer);
+
+    flipper_format_free(flipper_format);
+}
+
+MU_TEST(flipper_format_write_speed_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* flipper_format = flipper_format_file_alloc(storage);
+    mu_check(flipper_format_file_open_always(
+        flipper_format, EXT_PATH(".tmp/unit_tests/flipper_speed.fff")));
+
+    const size_t sample_count = 512;
+    const size_t line_count = 16;
+    int32_t* int32_data = malloc(sample_count * sizeof(int32_t));
+    uint8_t* hex_data = malloc(sample_count);
+    for(size_t i = 0; i < sample_count; i++) {
+        int32_data[i] = (i % 2) ? -(int32_t)(i * 37) : (int32_t)(i * 101);
+        hex_data[i] = i;
+    }
+
+    uint32_t start = furi_get_tick();
+    for(size_t i = 0; i < line_count; i++) {
+        mu_check(flipper_format_write_int32(flipper_format, "RAW_Data", int32_data, sample_count));
+    }
+    uint32_t int32_ticks = furi_get_tick() - start;
+
+    start = furi_get_tick();
+    for(size_t i = 0; i < line_count; i++) {
+        mu_check(flipper_format_write_hex(flipper_format, "Data", hex_data, sample_count));
+    }
+    uint32_t hex_ticks = furi_get_tick() - start;
+
+    FURI_LOG_I(
+        TAG,
+        "%zu lines of %zu values: int32 %lu ms, hex %lu ms",
+        line_count,
+        sample_count,
+        int32_ticks,
+        hex_ticks);
+
+    // Read back to make sure batched lines are well-formed
+    mu_check(flipper_format_rewind(flipper_format));
+    int32_t* int32_read = malloc(sample_count * sizeof(int32_t));
+    mu_check(flipper_format_read_int32(flipper_format, "RAW_Data", int32_read, sample_count));
+    mu_check(memcmp(int32_data, int32_read, sample_count * sizeof(int32_t)) == 0);
+    uint8_t* hex_read = malloc(sample_count);
+    mu_check(flipper_format_read_hex(flipper_format, "Data", hex_read, sample_count));
+    mu_check(memcmp(hex_data, hex_read, sample_count) == 0);
+
+    free(hex_read);
+    free(int32_read);
+    free(hex_data);
+    free(int32_data);
+    flipper_format_free(flipper_format);
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(flipper_format_string_suite) {
     MU_RUN_TEST(flipper_format_string_test);
     MU_RUN_TEST(flipper_format_file_test);
+    MU_RUN_TEST(flipper_format_value_format_test);
+    MU_RUN_TEST(flipper_format_write_speed_test);
 }
 
 int run_minunit_test_flipper_format_string(void) {
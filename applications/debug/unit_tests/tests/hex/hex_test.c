@@ -0,0 +1,179 @@
+#include <furi.h>
+#include <furi_hal.h>
+
+#include "../test.h" // IWYU pragma: keep
+
+#include <toolbox/hex.h>
+
+#define TAG "HexTest"
+
+#define HEX_TEST_BENCH_DATA_SIZE  (1024U)
+#define HEX_TEST_BENCH_ITERATIONS (256U)
+
+// Byte by byte conversion, as it was done before hex_decode() was introduced
+static bool hex_test_reference_nibble(char c, uint8_t* nibble) {
+    if(c >= '0' && c <= '9') {
+        *nibble = c - '0';
+        return true;
+    } else if(c >= 'A' && c <= 'F') {
+        *nibble = c - 'A' + 10;
+        return true;
+    } else if(c >= 'a' && c <= 'f') {
+        *nibble = c - 'a' + 10;
+        return true;
+    } else {
+        return false;
+    }
+}
+
+static bool hex_test_reference_decode(const char* buf, size_t len, uint8_t* out) {
+    for(size_t i = 0; i < len / 2; i++) {
+        uint8_t hi, low;
+        if(!hex_test_reference_nibble(buf[i * 2], &hi) ||
+           !hex_test_reference_nibble(buf[i * 2 + 1], &low)) {
+            return false;
+        }
+        out[i] = (hi << 4) | low;
+    }
+    return true;
+}
+
+static void hex_test_reference_encode(const uint8_t* data, size_t len, char* out) {
+    for(size_t i = 0; i < len; i++) {
+        snprintf(&out[i * 2], 3, "%02X", data[i]);
+    }
+}
+
+static void hex_test_log_rate(const char* name, uint32_t ticks, uint32_t ref_ticks) {
+    const uint32_t bytes = HEX_TEST_BENCH_DATA_SIZE * HEX_TEST_BENCH_ITERATIONS;
+    // Bytes per millisecond / 1000 = MB/s, shown with two decimals
+    const uint32_t rate = bytes / (MAX(ticks, 1UL) * 10);
+    const uint32_t ref_rate = bytes / (MAX(ref_ticks, 1UL) * 10);
+
+    FURI_LOG_I(
+        TAG,
+        "%s: %lu.%02lu MB/s, byte by byte: %lu.%02lu MB/s",
+        name,
+        rate / 100,
+        rate % 100,
+        ref_rate / 100,
+        ref_rate % 100);
+}
+
+MU_TEST(hex_test_decode) {
+    uint8_t data[8] = {};
+
+    mu_assert(hex_decode("", 0, data), "empty string must be decoded");
+
+    mu_assert(hex_decode("0123456789abcdEF", 16, data), "hex string must be decoded");
+    const uint8_t expected[] = {0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF};
+    mu_assert_mem_eq(expected, data, sizeof(expected));
+
+    mu_assert(hex_decode("0123456", 7, data) == false, "odd length must be rejected");
+    mu_assert(hex_decode("0123456G", 8, data) == false, "non-hex char must be rejected");
+    mu_assert(hex_decode("G1234567", 8, data) == false, "non-hex char must be rejected");
+    mu_assert(hex_decode("0123 567", 8, data) == false, "space must be rejected");
+    const char with_nul[] = {'0', '1', '\0', '3', '4', '5', '6', '7'};
+    mu_assert(hex_decode(with_nul, 8, data) == false, "NUL must be rejected");
+    const char with_non_ascii[] = {'0', '1', '2', '3', '4', '5', (char)0xB6, '7'};
+    mu_assert(hex_decode(with_non_ascii, 8, data) == false, "non-ASCII must be rejected");
+    mu_assert(hex_decode("9:", 2, data) == false, "char after 9 must be rejected");
+    mu_assert(hex_decode("@A", 2, data) == false, "char before A must be rejected");
+    mu_assert(hex_decode("fg", 2, data) == false, "char after f must be rejected");
+}
+
+MU_TEST(hex_test_encode) {
+    const uint8_t data[] = {0x00, 0x0F, 0xA5, 0xFF, 0x10};
+    char str[sizeof(data) * 2 + 1];
+
+    memset(str, 'X', sizeof(str));
+    hex_encode(data, 0, str);
+    mu_assert_string_eq("", str);
+
+    hex_encode(data, sizeof(data), str);
+    mu_assert_string_eq("000FA5FF10", str);
+}
+
+MU_TEST(hex_test_random) {
+    uint8_t data[67];
+    uint8_t decoded[sizeof(data)];
+    char str[sizeof(data) * 2 + 1];
+    char ref_str[sizeof(str)];
+
+    for(size_t i = 0; i < 1000; i++) {
+        const size_t size = rand() % (sizeof(data) + 1);
+        furi_hal_random_fill_buf(data, size);
+
+        hex_encode(data, size, str);
+        hex_test_reference_encode(data, size, ref_str);
+        mu_assert_mem_eq(ref_str, str, size * 2);
+
+        mu_assert(hex_decode(str, size * 2, decoded), "encoded data must be decoded");
+        mu_assert_mem_eq(data, decoded, size);
+
+        if(size == 0) continue;
+
+        // A single bad char anywhere must be caught by the final check
+        const size_t pos = rand() % (size * 2);
+        str[pos] = 'x';
+        mu_assert(hex_decode(str, size * 2, decoded) == false, "bad char must be rejected");
+    }
+}
+
+MU_TEST(hex_test_benchmark) {
+    uint8_t* data = malloc(HEX_TEST_BENCH_DATA_SIZE);
+    uint8_t* decoded = malloc(HEX_TEST_BENCH_DATA_SIZE);
+    char* str = malloc(HEX_TEST_BENCH_DATA_SIZE * 2 + 1);
+
+    furi_hal_random_fill_buf(data, HEX_TEST_BENCH_DATA_SIZE);
+    hex_encode(data, HEX_TEST_BENCH_DATA_SIZE, str);
+
+    uint32_t start = furi_get_tick();
+    for(size_t i = 0; i < HEX_TEST_BENCH_ITERATIONS; i++) {
+        hex_test_reference_decode(str, HEX_TEST_BENCH_DATA_SIZE * 2, decoded);
+    }
+    const uint32_t ref_decode_ticks = furi_get_tick() - start;
+
+    start = furi_get_tick();
+    for(size_t i = 0; i < HEX_TEST_BENCH_ITERATIONS; i++) {
+        hex_decode(str, HEX_TEST_BENCH_DATA_SIZE * 2, decoded);
+    }
+    const uint32_t decode_ticks = furi_get_tick() - start;
+
+    mu_assert_mem_eq(data, decoded, HEX_TEST_BENCH_DATA_SIZE);
+
+    start = furi_get_tick();
+    for(size_t i = 0; i < HEX_TEST_BENCH_ITERATIONS; i++) {
+        uint8_to_hex_chars(data, (uint8_t*)str, HEX_TEST_BENCH_DATA_SIZE * 2);
+    }
+    const uint32_t ref_encode_ticks = furi_get_tick() - start;
+
+    start = furi_get_tick();
+    for(size_t i = 0; i < HEX_TEST_BENCH_ITERATIONS; i++) {
+        hex_encode(data, HEX_TEST_BENCH_DATA_SIZE, str);
+    }
+    const uint32_t encode_ticks = furi_get_tick() - start;
+
+    hex_test_log_rate("hex_decode", decode_ticks, ref_decode_ticks);
+    hex_test_log_rate("hex_encode", encode_ticks, ref_encode_ticks);
+
+    mu_assert(decode_ticks <= ref_decode_ticks, "hex_decode is slower than byte by byte");
+
+    free(str);
+    free(decoded);
+    free(data);
+}
+
+MU_TEST_SUITE(test_hex_suite) {
+    MU_RUN_TEST(hex_test_decode);
+    MU_RUN_TEST(hex_test_encode);
+    MU_RUN_TEST(hex_test_random);
+    MU_RUN_TEST(hex_test_benchmark);
+}
+
+int run_minunit_test_hex(void) {
+    MU_RUN_SUITE(test_hex_suite);
+    return MU_EXIT_CODE;
+}
+
+TEST_API_DEFINE(run_minunit_test_hex)
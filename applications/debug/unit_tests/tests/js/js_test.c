@@ -0,0 +1,146 @@
+#include <furi.h>
+#include <furi_hal.h>
+
+#include "../test.h" // IWYU pragma: keep
+
+#include <mjs_core_public.h>
+#include <mjs_exec_public.h>
+#include <mjs_object_public.h>
+#include <mjs_primitive_public.h>
+
+#define TAG "JsTest"
+
+#define JS_TEST_PROPERTY_COUNT (64)
+#define JS_TEST_BENCH_ITERATIONS 2000
+
+static struct mjs* js_test_mjs_alloc(void) {
+    struct mjs* mjs = mjs_create(NULL);
+    mjs_val_t global = mjs_get_global(mjs);
+    mjs_val_t big = mjs_mk_object(mjs);
+    char name[16];
+
+    for(size_t i = 0; i < JS_TEST_PROPERTY_COUNT; i++) {
+        snprintf(name, sizeof(name), "property_%02zu", i);
+        mjs_set(mjs, big, name, ~0, mjs_mk_number(mjs, i));
+    }
+    mjs_set(mjs, global, "big", ~0, big);
+
+    return mjs;
+}
+
+static mjs_err_t js_test_exec_int(struct mjs* mjs, const char* name, const char* src, int* res) {
+    mjs_val_t val = MJS_UNDEFINED;
+    uint32_t start = furi_get_tick();
+    mjs_err_t err = mjs_exec(mjs, src, &val);
+    FURI_LOG_I(TAG, "%s: %lu ms", name, furi_get_tick() - start);
+    *res = mjs_get_int(mjs, val);
+    return err;
+}
+
+MU_TEST(js_object_properties_test) {
+    struct mjs* mjs = js_test_mjs_alloc();
+    mjs_val_t big = mjs_get(mjs, mjs_get_global(mjs), "big", ~0);
+    char name[16];
+
+    for(size_t i = 0; i < JS_TEST_PROPERTY_COUNT; i++) {
+        snprintf(name, sizeof(name), "property_%02zu", i);
+        mu_assert_int_eq(i, mjs_get_int(mjs, mjs_get(mjs, big, name, ~0)));
+    }
+
+    // Deleted properties must not be served from the lookup cache
+    mu_assert_int_eq(0, mjs_del(mjs, big, "property_00", ~0));
+    mu_assert(
+        mjs_is_undefined(mjs_get(mjs, big, "property_00", ~0)), "deleted property is visible");
+    mu_assert_int_eq(-1, mjs_del(mjs, big, "property_00", ~0));
+
+    // Properties must survive garbage collection and string compaction
+    int sum = 0;
+    mjs_err_t err = js_test_exec_int(
+        mjs,
+        "gc",
+        "let gc_sum = 0;"
+        "for(let i = 0; i < 500; i++) {"
+        "  let o = {long_name_1: i, long_name_2: 'garbage string ' + 'x'};"
+        "  gc_sum = gc_sum + o.long_name_1 - i;"
+        "}"
+        "gc_sum + big.property_01 + big.property_63;",
+        &sum);
+    mu_assert_int_eq(MJS_OK, err);
+    mu_assert_int_eq(64, sum);
+
+    big = mjs_get(mjs, mjs_get_global(mjs), "big", ~0);
+    for(size_t i = 1; i < JS_TEST_PROPERTY_COUNT; i++) {
+        snprintf(name, sizeof(name), "property_%02zu", i);
+        mu_assert_int_eq(i, mjs_get_int(mjs, mjs_get(mjs, big, name, ~0)));
+    }
+
+    mjs_destroy(mjs);
+}
+
+MU_TEST(js_object_benchmark_test) {
+    struct mjs* mjs = js_test_mjs_alloc();
+
+    // The first property set is the last one in the object property list
+    int res = 0;
+    mjs_err_t err = js_test_exec_int(
+        mjs,
+        "property get",
+        "let get_sum = 0;"
+        "for(let i = 0; i < " TOSTRING(JS_TEST_BENCH_ITERATIONS) "; i++) {"
+        "  get_sum = get_sum + big.property_00 + big.property_01;"
+        "}"
+        "get_sum;",
+        &res);
+    mu_assert_int_eq(MJS_OK, err);
+    mu_assert_int_eq(JS_TEST_BENCH_ITERATIONS, res);
+
+    err = js_test_exec_int(
+        mjs,
+        "property set",
+        "for(let i = 0; i < " TOSTRING(JS_TEST_BENCH_ITERATIONS) "; i++) {"
+        "  big.property_00 = i;"
+        "}"
+        "big.property_00;",
+        &res);
+    mu_assert_int_eq(MJS_OK, err);
+    mu_assert_int_eq(JS_TEST_BENCH_ITERATIONS - 1, res);
+
+    err = js_test_exec_int(
+        mjs,
+        "method call",
+        "let calc = {accumulate: function(a, b) { return a + b; }};"
+        "let call_sum = 0;"
+        "for(let i = 0; i < " TOSTRING(JS_TEST_BENCH_ITERATIONS) "; i++) {"
+        "  call_sum = calc.accumulate(call_sum, 1);"
+        "}"
+        "call_sum;",
+        &res);
+    mu_assert_int_eq(MJS_OK, err);
+    mu_assert_int_eq(JS_TEST_BENCH_ITERATIONS, res);
+
+    err = js_test_exec_int(
+        mjs,
+        "array push",
+        "let a = [];"
+        "for(let i = 0; i < 200; i++) {"
+        "  a.push(i);"
+        "}"
+        "a[199];",
+        &res);
+    mu_assert_int_eq(MJS_OK, err);
+    mu_assert_int_eq(199, res);
+
+    mjs_destroy(mjs);
+}
+
+MU_TEST_SUITE(test_js_suite) {
+    MU_RUN_TEST(js_object_properties_test);
+    MU_RUN_TEST(js_object_benchmark_test);
+}
+
+int run_minunit_test_js(void) {
+    MU_RUN_SUITE(test_js_suite);
+    return MU_EXIT_CODE;
+}
+
+TEST_API_DEFINE(run_minunit_test_js)
@@ -3,6 +3,7 @@
 #include <toolbox/protocols/protocol_dict.h>
 #include <lfrfid/protocols/lfrfid_protocols.h>
 #include <toolbox/pulse_protocols/pulse_glue.h>
+#include <lib/lfrfid/lfrfid_worker_i.h>
 
 #define LF_RFID_READ_TIMING_MULTIPLIER 8
 
@@ -334,6 +335,93 @@ MU_TEST(test_lfrfid_protocol_h10301_read_simple) {
     protocol_dict_free(dict);
 }
 
+MU_TEST(test_lfrfid_protocol_h10301_read_by_id) {
+    // other FSK protocols share the demodulator with H10301, but are not fed here
+    ProtocolDict* dict = protocol_dict_alloc(lfrfid_protocols, LFRFIDProtocolMax);
+    const uint8_t data[HID10301_TEST_DATA_SIZE] = HID10301_TEST_DATA;
+
+    protocol_dict_decoders_start(dict);
+
+    ProtocolId protocol = PROTOCOL_NO;
+    PulseGlue* pulse_glue = pulse_glue_alloc();
+
+    for(size_t i = 0; i < HID10301_TEST_EMULATION_TIMINGS_COUNT * 10; i++) {
+        bool pulse_pop = pulse_glue_push(
+            pulse_glue,
+            hid10301_test_timings[i % HID10301_TEST_EMULATION_TIMINGS_COUNT] >= 0,
+            abs(hid10301_test_timings[i % HID10301_TEST_EMULATION_TIMINGS_COUNT]) *
+                LF_RFID_READ_TIMING_MULTIPLIER);
+
+        if(pulse_pop) {
+            uint32_t length, period;
+            pulse_glue_pop(pulse_glue, &length, &period);
+
+            protocol =
+                protocol_dict_decoders_feed_by_id(dict, LFRFIDProtocolH10301, true, period);
+            if(protocol != PROTOCOL_NO) break;
+
+            protocol = protocol_dict_decoders_feed_by_id(
+                dict, LFRFIDProtocolH10301, false, length - period);
+            if(protocol != PROTOCOL_NO) break;
+        }
+    }
+
+    pulse_glue_free(pulse_glue);
+
+    mu_assert_int_eq(LFRFIDProtocolH10301, protocol);
+    uint8_t received_data[HID10301_TEST_DATA_SIZE] = {0};
+    protocol_dict_get_data(dict, protocol, received_data, HID10301_TEST_DATA_SIZE);
+
+    mu_assert_mem_eq(data, received_data, HID10301_TEST_DATA_SIZE);
+
+    protocol_dict_free(dict);
+}
+
+MU_TEST(test_lfrfid_protocol_h10301_read_two_dicts) {
+    // demodulator state is shared within a dict only, another dict gets its own signal
+    ProtocolDict* dict = protocol_dict_alloc(lfrfid_protocols, LFRFIDProtocolMax);
+    ProtocolDict* other_dict = protocol_dict_alloc(lfrfid_protocols, LFRFIDProtocolMax);
+    const uint8_t data[HID10301_TEST_DATA_SIZE] = HID10301_TEST_DATA;
+
+    protocol_dict_decoders_start(dict);
+    protocol_dict_decoders_start(other_dict);
+
+    ProtocolId protocol = PROTOCOL_NO;
+    PulseGlue* pulse_glue = pulse_glue_alloc();
+
+    for(size_t i = 0; i < HID10301_TEST_EMULATION_TIMINGS_COUNT * 10; i++) {
+        bool pulse_pop = pulse_glue_push(
+            pulse_glue,
+            hid10301_test_timings[i % HID10301_TEST_EMULATION_TIMINGS_COUNT] >= 0,
+            abs(hid10301_test_timings[i % HID10301_TEST_EMULATION_TIMINGS_COUNT]) *
+                LF_RFID_READ_TIMING_MULTIPLIER);
+
+        if(pulse_pop) {
+            uint32_t length, period;
+            pulse_glue_pop(pulse_glue, &length, &period);
+
+            protocol = protocol_dict_decoders_feed(dict, true, period);
+            if(protocol != PROTOCOL_NO) break;
+            protocol_dict_decoders_feed(other_dict, true, period * 2);
+
+            protocol = protocol_dict_decoders_feed(dict, false, length - period);
+            if(protocol != PROTOCOL_NO) break;
+            protocol_dict_decoders_feed(other_dict, false, length - period);
+        }
+    }
+
+    pulse_glue_free(pulse_glue);
+
+    mu_assert_int_eq(LFRFIDProtocolH10301, protocol);
+    uint8_t received_data[HID10301_TEST_DATA_SIZE] = {0};
+    protocol_dict_get_data(dict, protocol, received_data, HID10301_TEST_DATA_SIZE);
+
+    mu_assert_mem_eq(data, received_data, HID10301_TEST_DATA_SIZE);
+
+    protocol_dict_free(other_dict);
+    protocol_dict_free(dict);
+}
+
 MU_TEST(test_lfrfid_protocol_h10301_emulate_simple) {
     ProtocolDict* dict = protocol_dict_alloc(lfrfid_protocols, LFRFIDProtocolMax);
     mu_assert_int_eq(
@@ -526,11 +614,78 @@ MU_TEST(test_lfrfid_protocol_fdxb_read_simple) {
     protocol_dict_free(dict);
 }
 
+// Sum of the pulse periods of one read averaging window of the tag emulation, us
+static uint32_t lfrfid_test_read_window_duration(
+    ProtocolDict* dict,
+    LFRFIDProtocol protocol,
+    const uint8_t* data,
+    size_t data_size) {
+    protocol_dict_set_data(dict, protocol, data, data_size);
+    mu_check(protocol_dict_encoder_start(dict, protocol));
+
+    PulseGlue* pulse_glue = pulse_glue_alloc();
+    uint32_t duration = 0;
+    size_t count = 0;
+
+    while(count < LFRFID_WORKER_READ_AVERAGE_COUNT) {
+        LevelDuration level_duration = protocol_dict_encoder_yield(dict, protocol);
+        bool pulse_pop = pulse_glue_push(
+            pulse_glue,
+            level_duration_get_level(level_duration),
+            level_duration_get_duration(level_duration) * LF_RFID_READ_TIMING_MULTIPLIER);
+
+        if(pulse_pop) {
+            uint32_t length, period;
+            pulse_glue_pop(pulse_glue, &length, &period);
+            duration += length;
+            count++;
+        }
+    }
+
+    pulse_glue_free(pulse_glue);
+    return duration;
+}
+
+MU_TEST(test_lfrfid_read_modulation_mismatch) {
+    ProtocolDict* dict = protocol_dict_alloc(lfrfid_protocols, LFRFIDProtocolMax);
+
+    // ASK tag: Manchester half bits of 256 us fit ASK read
+    const uint8_t em_data[EM_TEST_DATA_SIZE] = EM_TEST_DATA;
+    uint32_t duration =
+        lfrfid_test_read_window_duration(dict, LFRFIDProtocolEM4100, em_data, EM_TEST_DATA_SIZE);
+    mu_check(!lfrfid_worker_read_is_modulation_mismatch(LFRFIDFeatureASK, duration, 0));
+
+    // FSK tag: RF/8 and RF/10 subcarrier fits ASK read, but is too fast for PSK read
+    const uint8_t h10301_data[HID10301_TEST_DATA_SIZE] = HID10301_TEST_DATA;
+    duration = lfrfid_test_read_window_duration(
+        dict, LFRFIDProtocolH10301, h10301_data, HID10301_TEST_DATA_SIZE);
+    mu_check(!lfrfid_worker_read_is_modulation_mismatch(LFRFIDFeatureASK, duration, 0));
+    mu_check(lfrfid_worker_read_is_modulation_mismatch(LFRFIDFeaturePSK, duration, 0));
+
+    // PSK tag: RF/2 subcarrier is too fast for ASK read
+    const uint8_t indala26_data[INDALA26_TEST_DATA_SIZE] = INDALA26_TEST_DATA;
+    duration = lfrfid_test_read_window_duration(
+        dict, LFRFIDProtocolIndala26, indala26_data, INDALA26_TEST_DATA_SIZE);
+    mu_check(lfrfid_worker_read_is_modulation_mismatch(LFRFIDFeatureASK, duration, 0));
+
+    // PSK read delivers phase runs of whole bits
+    duration = LFRFID_WORKER_READ_AVERAGE_COUNT * 2 * LFRFID_PSK_US_PER_BIT;
+    mu_check(!lfrfid_worker_read_is_modulation_mismatch(LFRFIDFeaturePSK, duration, 0));
+
+    // noise spikes outnumbering valid edges never fit
+    mu_check(lfrfid_worker_read_is_modulation_mismatch(
+        LFRFIDFeatureASK, duration, LFRFID_WORKER_READ_AVERAGE_COUNT + 1));
+
+    protocol_dict_free(dict);
+}
+
 MU_TEST_SUITE(test_lfrfid_protocols_suite) {
     MU_RUN_TEST(test_lfrfid_protocol_em_read_simple);
     MU_RUN_TEST(test_lfrfid_protocol_em_emulate_simple);
 
     MU_RUN_TEST(test_lfrfid_protocol_h10301_read_simple);
+    MU_RUN_TEST(test_lfrfid_protocol_h10301_read_by_id);
+    MU_RUN_TEST(test_lfrfid_protocol_h10301_read_two_dicts);
     MU_RUN_TEST(test_lfrfid_protocol_h10301_emulate_simple);
 
     MU_RUN_TEST(test_lfrfid_protocol_ioprox_xsf_read_simple);
@@ -540,6 +695,8 @@ MU_TEST_SUITE(test_lfrfid_protocols_suite) {
 
     MU_RUN_TEST(test_lfrfid_protocol_fdxb_read_simple);
     MU_RUN_TEST(test_lfrfid_protocol_fdxb_emulate_simple);
+
+    MU_RUN_TEST(test_lfrfid_read_modulation_mismatch);
 }
 
 int run_minunit_test_lfrfid_protocols(void) {
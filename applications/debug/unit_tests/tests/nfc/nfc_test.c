@@ -15,6 +15,7 @@
 #include <nfc/protocols/felica/felica.h>
 #include <nfc/protocols/felica/felica_poller_sync.h>
 #include <nfc/protocols/mf_classic/mf_classic_poller.h>
+#include <nfc/protocols/mf_desfire/mf_desfire_poller.h>
 #include <nfc/protocols/iso15693_3/iso15693_3_poller.h>
 #include <nfc/protocols/slix/slix.h>
 #include <nfc/protocols/slix/slix_i.h>
@@ -22,9 +23,14 @@
 #include <nfc/protocols/slix/slix_poller_i.h>
 
 #include <nfc/nfc_poller.h>
+#include <nfc/helpers/iso14443_crc.h>
+#include <nfc/helpers/crypto1.h>
+#include <nfc/helpers/mfkey32.h>
 
 #include <toolbox/keys_dict.h>
+#include <toolbox/hex.h>
 #include <nfc/nfc.h>
+#include <nfc/nfc_mock.h>
 
 #include "../test.h" // IWYU pragma: keep
 
@@ -33,8 +39,20 @@
 #define NFC_TEST_NFC_DEV_PATH                  EXT_PATH("unit_tests/nfc/nfc_device_test.nfc")
 #define NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH EXT_PATH("unit_tests/mf_dict.nfc")
 
+#define NFC_TEST_DICT_BENCH_KEYS      (2000U)
+#define NFC_TEST_DICT_BENCH_BATCH     (32U)
+#define NFC_TEST_DICT_LONG_LINE_CHARS (600U)
+
+#define NFC_TEST_CACHE_PATH            EXT_PATH("unit_tests/nfc/.cache")
+#define NFC_TEST_CACHE_MF_CLASSIC_PATH EXT_PATH("unit_tests/nfc/cache_mf_classic.nfc")
+#define NFC_TEST_CACHE_MF_DESFIRE_PATH EXT_PATH("unit_tests/nfc/cache_mf_desfire.nfc")
+#define NFC_TEST_CACHE_LOADS           (4U)
+
 #define NFC_TEST_FLAG_WORKER_DONE (1)
 
+#define NFC_TEST_TRANSCRIPT_FRAMES_MAX (32)
+#define NFC_TEST_TRANSCRIPT_DATA_SIZE  (1024)
+
 typedef enum {
     NfcTestMfClassicSendFrameTestStateAuth,
     NfcTestMfClassicSendFrameTestStateReadBlock,
@@ -207,6 +225,224 @@ MU_TEST(mf_classic_4k_7b_file_test) {
     nfc_file_test_with_generator(NfcDataGeneratorTypeMfClassic4k_7b);
 }
 
+static size_t nfc_test_cache_files_num(void) {
+    File* dir = storage_file_alloc(nfc_test->storage);
+    size_t files_num = 0;
+
+    if(storage_dir_open(dir, NFC_TEST_CACHE_PATH)) {
+        while(storage_dir_read(dir, NULL, NULL, 0)) {
+            files_num++;
+        }
+    }
+
+    storage_dir_close(dir);
+    storage_file_free(dir);
+
+    return files_num;
+}
+
+static MfDesfireData* nfc_test_mf_desfire_alloc(void) {
+    MfDesfireData* data = mf_desfire_alloc();
+
+    const uint8_t uid[] = {0x04, 0x51, 0x5C, 0xFA, 0x6F, 0x73, 0x81};
+    mf_desfire_set_uid(data, uid, sizeof(uid));
+
+    Iso14443_3aData* iso14443_3a_data = data->iso14443_4a_data->iso14443_3a_data;
+    iso14443_3a_data->atqa[0] = 0x44;
+    iso14443_3a_data->atqa[1] = 0x03;
+    iso14443_3a_data->sak = 0x20;
+
+    data->master_key_settings.max_keys = 1;
+    simple_array_init(data->master_key_versions, 1);
+
+    // Two applications with four 256 byte files each
+    const uint32_t application_count = 2;
+    const uint32_t file_count = 4;
+    const uint32_t file_size = 256;
+
+    simple_array_init(data->application_ids, application_count);
+    simple_array_init(data->applications, application_count);
+
+    for(uint32_t i = 0; i < application_count; i++) {
+        MfDesfireApplicationId* app_id = simple_array_get(data->application_ids, i);
+        app_id->data[0] = i + 1;
+
+        MfDesfireApplication* app = simple_array_get(data->applications, i);
+        app->key_settings.max_keys = 1;
+        simple_array_init(app->key_versions, 1);
+        simple_array_init(app->file_ids, file_count);
+        simple_array_init(app->file_settings, file_count);
+        simple_array_init(app->file_data, file_count);
+
+        for(uint32_t j = 0; j < file_count; j++) {
+            MfDesfireFileId* file_id = simple_array_get(app->file_ids, j);
+            *file_id = j;
+
+            MfDesfireFileSettings* file_settings = simple_array_get(app->file_settings, j);
+            file_settings->type = MfDesfireFileTypeStandard;
+            file_settings->comm = MfDesfireFileCommunicationSettingsPlaintext;
+            file_settings->access_rights[0] = 0xEEEE;
+            file_settings->access_rights_len = 1;
+            file_settings->data.size = file_size;
+
+            MfDesfireFileData* file_data = simple_array_get(app->file_data, j);
+            simple_array_init(file_data->data, file_size);
+            furi_hal_random_fill_buf(simple_array_get_data(file_data->data), file_size);
+        }
+    }
+
+    return data;
+}
+
+static void nfc_test_cache_load(const char* path) {
+    NfcDevice* parsed = nfc_device_alloc();
+    NfcDevice* cached = nfc_device_alloc();
+    nfc_device_set_cache_path(cached, NFC_TEST_CACHE_PATH);
+
+    // First load parses the file and saves its binary copy
+    const size_t files_num = nfc_test_cache_files_num();
+    mu_assert(nfc_device_load(cached, path), "nfc_device_load() failed\r\n");
+    mu_assert_int_eq(files_num + 1, nfc_test_cache_files_num());
+
+    uint32_t start = furi_get_tick();
+    for(uint32_t i = 0; i < NFC_TEST_CACHE_LOADS; i++) {
+        mu_assert(nfc_device_load(parsed, path), "nfc_device_load() failed\r\n");
+    }
+    const uint32_t parsed_ticks = furi_get_tick() - start;
+
+    start = furi_get_tick();
+    for(uint32_t i = 0; i < NFC_TEST_CACHE_LOADS; i++) {
+        mu_assert(nfc_device_load(cached, path), "nfc_device_load() failed\r\n");
+    }
+    const uint32_t cached_ticks = furi_get_tick() - start;
+
+    mu_assert(nfc_device_is_equal(parsed, cached), "Cached data differs from parsed data\r\n");
+
+    FURI_LOG_I(
+        TAG,
+        "%s load: %lu ms parsed, %lu ms cached",
+        nfc_device_get_protocol_name(nfc_device_get_protocol(parsed)),
+        parsed_ticks / NFC_TEST_CACHE_LOADS,
+        cached_ticks / NFC_TEST_CACHE_LOADS);
+
+    nfc_device_free(cached);
+    nfc_device_free(parsed);
+}
+
+// Changes the first UID digit in place, keeping the file size
+static void nfc_test_cache_rewrite_uid(const char* path, uint8_t* uid_digit) {
+    File* file = storage_file_alloc(nfc_test->storage);
+    mu_assert(
+        storage_file_open(file, path, FSAM_READ_WRITE, FSOM_OPEN_EXISTING),
+        "storage_file_open() failed\r\n");
+
+    const size_t size = storage_file_size(file);
+    char* data = malloc(size + 1);
+    mu_assert_int_eq(size, storage_file_read(file, data, size));
+    data[size] = '\0';
+
+    const char* uid = strstr(data, "UID: ");
+    mu_assert(uid, "UID not found\r\n");
+    const size_t offset = uid - data + strlen("UID: ");
+    const char digit = data[offset] == '0' ? '1' : '0';
+
+    mu_assert(storage_file_seek(file, offset, true), "storage_file_seek() failed\r\n");
+    mu_assert_int_eq(1, storage_file_write(file, &digit, 1));
+    *uid_digit = digit - '0';
+
+    free(data);
+    storage_file_close(file);
+    storage_file_free(file);
+}
+
+MU_TEST(nfc_device_cache_test) {
+    storage_simply_remove_recursive(nfc_test->storage, NFC_TEST_CACHE_PATH);
+
+    NfcDevice* nfc_device = nfc_device_alloc();
+    nfc_device_set_cache_path(nfc_device, NFC_TEST_CACHE_PATH);
+
+    nfc_data_generator_fill_data(NfcDataGeneratorTypeMfClassic4k_7b, nfc_device);
+    mu_assert(
+        nfc_device_save(nfc_device, NFC_TEST_CACHE_MF_CLASSIC_PATH),
+        "nfc_device_save() failed\r\n");
+
+    MfDesfireData* mf_desfire_data = nfc_test_mf_desfire_alloc();
+    nfc_device_set_data(nfc_device, NfcProtocolMfDesfire, mf_desfire_data);
+    mu_assert(
+        nfc_device_save(nfc_device, NFC_TEST_CACHE_MF_DESFIRE_PATH),
+        "nfc_device_save() failed\r\n");
+
+    nfc_test_cache_load(EXT_PATH("unit_tests/nfc/Ntag216.nfc"));
+    nfc_test_cache_load(EXT_PATH("unit_tests/nfc/Felica.nfc"));
+    nfc_test_cache_load(EXT_PATH("unit_tests/nfc/Slix_cap_default.nfc"));
+    nfc_test_cache_load(NFC_TEST_CACHE_MF_CLASSIC_PATH);
+    nfc_test_cache_load(NFC_TEST_CACHE_MF_DESFIRE_PATH);
+
+    // A same size rewrite right after caching must not be served from the stale copy
+    NfcDevice* nfc_device_loaded = nfc_device_alloc();
+    nfc_device_set_cache_path(nfc_device_loaded, NFC_TEST_CACHE_PATH);
+    uint8_t uid_digit = 0;
+    nfc_test_cache_rewrite_uid(NFC_TEST_CACHE_MF_CLASSIC_PATH, &uid_digit);
+    mu_assert(
+        nfc_device_load(nfc_device_loaded, NFC_TEST_CACHE_MF_CLASSIC_PATH),
+        "nfc_device_load() failed\r\n");
+    size_t uid_len = 0;
+    const uint8_t* uid = nfc_device_get_uid(nfc_device_loaded, &uid_len);
+    mu_assert_int_eq(uid_digit, uid[0] >> 4);
+    nfc_device_free(nfc_device_loaded);
+
+    // DESFire equality check doesn't look into files, so compare them here
+    nfc_device_loaded = nfc_device_alloc();
+    nfc_device_set_cache_path(nfc_device_loaded, NFC_TEST_CACHE_PATH);
+    mu_assert(
+        nfc_device_load(nfc_device_loaded, NFC_TEST_CACHE_MF_DESFIRE_PATH),
+        "nfc_device_load() failed\r\n");
+
+    const MfDesfireData* mf_desfire_data_loaded =
+        nfc_device_get_data(nfc_device_loaded, NfcProtocolMfDesfire);
+    for(uint32_t i = 0; i < simple_array_get_count(mf_desfire_data->applications); i++) {
+        const MfDesfireApplication* app = simple_array_cget(mf_desfire_data->applications, i);
+        const MfDesfireApplication* app_loaded =
+            simple_array_cget(mf_desfire_data_loaded->applications, i);
+
+        for(uint32_t j = 0; j < simple_array_get_count(app->file_data); j++) {
+            const MfDesfireFileData* file_data = simple_array_cget(app->file_data, j);
+            const MfDesfireFileData* file_data_loaded = simple_array_cget(app_loaded->file_data, j);
+            mu_assert_int_eq(
+                simple_array_get_count(file_data->data),
+                simple_array_get_count(file_data_loaded->data));
+            mu_assert(
+                memcmp(
+                    simple_array_cget_data(file_data->data),
+                    simple_array_cget_data(file_data_loaded->data),
+                    simple_array_get_count(file_data->data)) == 0,
+                "Cached file data differs\r\n");
+        }
+    }
+
+    nfc_device_free(nfc_device_loaded);
+    mf_desfire_free(mf_desfire_data);
+
+    // Saving a file drops its copy
+    const size_t files_num = nfc_test_cache_files_num();
+    mu_assert(
+        nfc_device_save(nfc_device, NFC_TEST_CACHE_MF_DESFIRE_PATH),
+        "nfc_device_save() failed\r\n");
+    mu_assert_int_eq(files_num - 1, nfc_test_cache_files_num());
+
+    nfc_device_free(nfc_device);
+
+    mu_assert(
+        storage_simply_remove(nfc_test->storage, NFC_TEST_CACHE_MF_CLASSIC_PATH),
+        "storage_simply_remove() failed\r\n");
+    mu_assert(
+        storage_simply_remove(nfc_test->storage, NFC_TEST_CACHE_MF_DESFIRE_PATH),
+        "storage_simply_remove() failed\r\n");
+    mu_assert(
+        storage_simply_remove_recursive(nfc_test->storage, NFC_TEST_CACHE_PATH),
+        "storage_simply_remove_recursive() failed\r\n");
+}
+
 MU_TEST(iso14443_3a_reader) {
     Nfc* poller = nfc_alloc();
     Nfc* listener = nfc_alloc();
@@ -236,6 +472,229 @@ MU_TEST(iso14443_3a_reader) {
     nfc_free(poller);
 }
 
+MU_TEST(iso14443_3a_transcript_reader) {
+    Nfc* poller = nfc_alloc();
+
+    // Same card as in iso14443_3a_reader, with no listener behind it
+    const uint8_t sens_req[] = {0x52};
+    const uint8_t sens_resp[] = {0x44, 0x00};
+    const uint8_t sdd_req_1[] = {0x93, 0x20};
+    const uint8_t sdd_resp_1[] = {0x88, 0x04, 0x51, 0x5C, 0x81};
+    const uint8_t sel_req_1[] = {0x93, 0x70, 0x88, 0x04, 0x51, 0x5C, 0x81, 0xEC, 0x4D};
+    const uint8_t sel_resp_1[] = {0x04, 0xDA, 0x17};
+    const uint8_t sdd_req_2[] = {0x95, 0x20};
+    const uint8_t sdd_resp_2[] = {0xFA, 0x6F, 0x73, 0x81, 0x67};
+    const uint8_t sel_req_2[] = {0x95, 0x70, 0xFA, 0x6F, 0x73, 0x81, 0x67, 0x53, 0x94};
+    const uint8_t sel_resp_2[] = {0x00, 0xFE, 0x51};
+
+    const NfcMockFrame transcript[] = {
+        {sens_req, 7, sens_resp, sizeof(sens_resp) * 8},
+        {sdd_req_1, sizeof(sdd_req_1) * 8, sdd_resp_1, sizeof(sdd_resp_1) * 8},
+        {sel_req_1, sizeof(sel_req_1) * 8, sel_resp_1, sizeof(sel_resp_1) * 8},
+        {sdd_req_2, sizeof(sdd_req_2) * 8, sdd_resp_2, sizeof(sdd_resp_2) * 8},
+        {sel_req_2, sizeof(sel_req_2) * 8, sel_resp_2, sizeof(sel_resp_2) * 8},
+    };
+
+    const Iso14443_3aData expected_data = {
+        .uid_len = 7,
+        .uid = {0x04, 0x51, 0x5C, 0xFA, 0x6F, 0x73, 0x81},
+        .atqa = {0x44, 0x00},
+        .sak = 0x00,
+    };
+
+    const uint32_t frame_latency_us = 1000;
+    nfc_mock_reset();
+    nfc_mock_set_transcript(transcript, COUNT_OF(transcript));
+    nfc_mock_set_frame_latency(frame_latency_us);
+
+    uint32_t start = furi_get_tick();
+    Iso14443_3aData iso14443_3a_poller_data = {};
+    mu_assert(
+        iso14443_3a_poller_sync_read(poller, &iso14443_3a_poller_data) == Iso14443_3aErrorNone,
+        "iso14443_3a_poller_sync_read() failed");
+    uint32_t read_ticks = furi_get_tick() - start;
+
+    NfcMockStats stats = {};
+    nfc_mock_get_stats(&stats);
+    size_t transcript_position = nfc_mock_get_transcript_position();
+    nfc_mock_reset();
+
+    FURI_LOG_I(TAG, "Transcript read: %lu ms, %lu frames", read_ticks, stats.frames);
+
+    mu_assert(iso14443_3a_is_equal(&iso14443_3a_poller_data, &expected_data), "Data not matches");
+    mu_assert_int_eq(COUNT_OF(transcript), transcript_position);
+    mu_check(stats.frames >= COUNT_OF(transcript));
+    mu_check(read_ticks >= furi_ms_to_ticks(COUNT_OF(transcript) * frame_latency_us / 1000));
+
+    nfc_free(poller);
+}
+
+typedef struct {
+    NfcMockFrame frames[NFC_TEST_TRANSCRIPT_FRAMES_MAX];
+    size_t frames_num;
+    uint8_t data[NFC_TEST_TRANSCRIPT_DATA_SIZE];
+    size_t data_size;
+} NfcTestTranscript;
+
+// Store hex string with CRC_A appended, return its size in bits
+static uint16_t
+    nfc_test_transcript_put(NfcTestTranscript* transcript, const char* hex, const uint8_t** data) {
+    const size_t size = strlen(hex) / 2;
+    furi_check(transcript->data_size + size + 2 <= sizeof(transcript->data));
+
+    uint8_t* frame_data = &transcript->data[transcript->data_size];
+    for(size_t i = 0; i < size; i++) {
+        furi_check(hex_char_to_uint8(hex[i * 2], hex[i * 2 + 1], &frame_data[i]));
+    }
+
+    BitBuffer* buffer = bit_buffer_alloc(size + 2);
+    bit_buffer_copy_bytes(buffer, frame_data, size);
+    iso14443_crc_append(Iso14443CrcTypeA, buffer);
+    bit_buffer_write_bytes(buffer, frame_data, size + 2);
+    bit_buffer_free(buffer);
+
+    transcript->data_size += size + 2;
+    *data = frame_data;
+
+    return (size + 2) * 8;
+}
+
+static void nfc_test_transcript_add(
+    NfcTestTranscript* transcript,
+    const char* request,
+    const char* response) {
+    furi_check(transcript->frames_num < NFC_TEST_TRANSCRIPT_FRAMES_MAX);
+
+    NfcMockFrame* frame = &transcript->frames[transcript->frames_num++];
+    frame->request_bits = nfc_test_transcript_put(transcript, request, &frame->request);
+    frame->response_bits = nfc_test_transcript_put(transcript, response, &frame->response);
+}
+
+typedef struct {
+    FuriThreadId thread_id;
+    MfDesfirePollerEventType event_type;
+} NfcTestMfDesfireReadContext;
+
+static NfcCommand mf_desfire_transcript_reader_callback(NfcGenericEvent event, void* context) {
+    furi_check(event.protocol == NfcProtocolMfDesfire);
+
+    NfcTestMfDesfireReadContext* read_context = context;
+    const MfDesfirePollerEvent* mf_desfire_event = event.event_data;
+    read_context->event_type = mf_desfire_event->type;
+    furi_thread_flags_set(read_context->thread_id, NFC_TEST_FLAG_WORKER_DONE);
+
+    return NfcCommandStop;
+}
+
+MU_TEST(mf_desfire_transcript_reader) {
+    Nfc* poller = nfc_alloc();
+    NfcTestTranscript* transcript = malloc(sizeof(NfcTestTranscript));
+
+    // Activation of card from iso14443_3a_transcript_reader, with ISO14443-4 support in SAK
+    const uint8_t sens_req[] = {0x52};
+    const uint8_t sens_resp[] = {0x44, 0x00};
+    const uint8_t sdd_req_1[] = {0x93, 0x20};
+    const uint8_t sdd_resp_1[] = {0x88, 0x04, 0x51, 0x5C, 0x81};
+    const uint8_t sdd_req_2[] = {0x95, 0x20};
+    const uint8_t sdd_resp_2[] = {0xFA, 0x6F, 0x73, 0x81, 0x67};
+
+    transcript->frames[transcript->frames_num++] =
+        (NfcMockFrame){sens_req, 7, sens_resp, sizeof(sens_resp) * 8};
+    transcript->frames[transcript->frames_num++] =
+        (NfcMockFrame){sdd_req_1, sizeof(sdd_req_1) * 8, sdd_resp_1, sizeof(sdd_resp_1) * 8};
+    nfc_test_transcript_add(transcript, "93708804515C81", "04");
+    transcript->frames[transcript->frames_num++] =
+        (NfcMockFrame){sdd_req_2, sizeof(sdd_req_2) * 8, sdd_resp_2, sizeof(sdd_resp_2) * 8};
+    nfc_test_transcript_add(transcript, "9570FA6F738167", "20");
+
+    // RATS, card takes frames up to 64 bytes
+    nfc_test_transcript_add(transcript, "E080", "067577810280");
+    // Card level: version, free memory, master key settings and version, two applications
+    nfc_test_transcript_add(transcript, "0260", "02AF04010101001805");
+    nfc_test_transcript_add(transcript, "03AF", "03AF04010101041805");
+    nfc_test_transcript_add(transcript, "02AF", "020004515CFA6F7381BA34CC2A401021");
+    nfc_test_transcript_add(transcript, "036E", "0300001C00");
+    nfc_test_transcript_add(transcript, "0245", "02000F01");
+    nfc_test_transcript_add(transcript, "036400", "030000");
+    nfc_test_transcript_add(transcript, "026A", "0200010000020000");
+    // Application 1: one standard file of 32 bytes
+    nfc_test_transcript_add(transcript, "035A010000", "0300");
+    nfc_test_transcript_add(transcript, "0245", "02000B01");
+    nfc_test_transcript_add(transcript, "036400", "030000");
+    nfc_test_transcript_add(transcript, "026F", "020001");
+    nfc_test_transcript_add(transcript, "03F501", "03000000EEEE200000");
+    nfc_test_transcript_add(
+        transcript,
+        "02BD01000000200000",
+        "0200000102030405060708090A0B0C0D0E0F101112131415161718191A1B1C1D1E1F");
+    // Application 2: same file, but card sends its data in two chained blocks
+    nfc_test_transcript_add(transcript, "035A020000", "0300");
+    nfc_test_transcript_add(transcript, "0245", "02000B01");
+    nfc_test_transcript_add(transcript, "036400", "030000");
+    nfc_test_transcript_add(transcript, "026F", "020001");
+    nfc_test_transcript_add(transcript, "03F501", "03000000EEEE200000");
+    nfc_test_transcript_add(
+        transcript, "02BD01000000200000", "1200202122232425262728292A2B2C2D2E2F");
+    nfc_test_transcript_add(transcript, "A3", "03303132333435363738393A3B3C3D3E3F");
+
+    const uint32_t frame_latency_us = 1000;
+    nfc_mock_reset();
+    nfc_mock_set_transcript(transcript->frames, transcript->frames_num);
+    nfc_mock_set_frame_latency(frame_latency_us);
+
+    NfcTestMfDesfireReadContext context = {
+        .thread_id = furi_thread_get_current_id(),
+        .event_type = MfDesfirePollerEventTypeReadFailed,
+    };
+
+    uint32_t start = furi_get_tick();
+    NfcPoller* mf_desfire_poller = nfc_poller_alloc(poller, NfcProtocolMfDesfire);
+    nfc_poller_start(mf_desfire_poller, mf_desfire_transcript_reader_callback, &context);
+    uint32_t flag =
+        furi_thread_flags_wait(NFC_TEST_FLAG_WORKER_DONE, FuriFlagWaitAny, FuriWaitForever);
+    uint32_t read_ticks = furi_get_tick() - start;
+    nfc_poller_stop(mf_desfire_poller);
+
+    NfcMockStats stats = {};
+    nfc_mock_get_stats(&stats);
+    size_t transcript_position = nfc_mock_get_transcript_position();
+    nfc_mock_reset();
+
+    FURI_LOG_I(
+        TAG,
+        "DESFire transcript read: %lu ms, %lu frames, %lu bytes received",
+        read_ticks,
+        stats.frames,
+        stats.response_bits / 8);
+
+    mu_assert(flag == NFC_TEST_FLAG_WORKER_DONE, "Wrong thread flag");
+    mu_assert(context.event_type == MfDesfirePollerEventTypeReadSuccess, "Read failed");
+    mu_assert_int_eq(transcript->frames_num, transcript_position);
+
+    const MfDesfireData* data = nfc_poller_get_data(mf_desfire_poller);
+    mu_assert_int_eq(2, simple_array_get_count(data->application_ids));
+
+    const MfDesfireFileId file_id = 0x01;
+    for(uint8_t i = 0; i < 2; i++) {
+        const MfDesfireApplicationId app_id = {.data = {i + 1, 0x00, 0x00}};
+        const MfDesfireApplication* app = mf_desfire_get_application(data, &app_id);
+        mu_assert(app, "Application not found");
+
+        const MfDesfireFileData* file_data = mf_desfire_get_file_data(app, &file_id);
+        mu_assert(file_data, "File data not found");
+        mu_assert_int_eq(32, simple_array_get_count(file_data->data));
+
+        const uint8_t* file_bytes = simple_array_cget_data(file_data->data);
+        for(uint8_t j = 0; j < 32; j++) {
+            mu_assert_int_eq(i * 32 + j, file_bytes[j]);
+        }
+    }
+
+    nfc_poller_free(mf_desfire_poller);
+    free(transcript);
+    nfc_free(poller);
+}
+
 static void mf_ultralight_reader_test(const char* path) {
     FURI_LOG_I(TAG, "Testing file: %s", path);
     Nfc* poller = nfc_alloc();
@@ -261,10 +720,21 @@ static void mf_ultralight_reader_test(const char* path) {
 
     nfc_listener_start(mfu_listener, NULL, NULL);
 
+    nfc_mock_reset();
+    uint32_t start = furi_get_tick();
     MfUltralightData* mfu_data = mf_ultralight_alloc();
     MfUltralightError error = mf_ultralight_poller_sync_read_card(poller, mfu_data);
     mu_assert(error == MfUltralightErrorNone, "mf_ultralight_poller_sync_read_card() failed");
 
+    NfcMockStats stats = {};
+    nfc_mock_get_stats(&stats);
+    FURI_LOG_I(
+        TAG,
+        "Read in %lu ms: %lu frames, %lu timeouts",
+        furi_get_tick() - start,
+        stats.frames,
+        stats.timeouts);
+
     nfc_listener_stop(mfu_listener);
     nfc_listener_free(mfu_listener);
 
@@ -652,6 +1122,127 @@ MU_TEST(mf_classic_dict_test) {
         "Remove test dict failed");
 }
 
+static void nfc_test_dict_write_str(File* file, const char* str) {
+    const size_t len = strlen(str);
+    furi_check(storage_file_write(file, str, len) == len);
+}
+
+MU_TEST(mf_classic_dict_batch_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+
+    mu_assert(
+        storage_file_open(
+            file, NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, FSAM_WRITE, FSOM_CREATE_ALWAYS),
+        "Create test dict failed");
+    nfc_test_dict_write_str(file, "# Comment\nA0A1A2A3A4A5\n\nb0b1b2b3b4b5 # Trailing\r\n");
+    nfc_test_dict_write_str(file, "#");
+    for(size_t i = 0; i < NFC_TEST_DICT_LONG_LINE_CHARS; i++) {
+        nfc_test_dict_write_str(file, "C0");
+    }
+    nfc_test_dict_write_str(file, "\nZZ0000000000\n123\nC0C1C2C3C4C5");
+    for(size_t i = 0; i < NFC_TEST_DICT_LONG_LINE_CHARS; i++) {
+        nfc_test_dict_write_str(file, "FF");
+    }
+    nfc_test_dict_write_str(file, "\nD0D1D2D3D4D5");
+    storage_file_close(file);
+
+    const MfClassicKey keys_ref[] = {
+        {{0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5}},
+        {{0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5}},
+        {{0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5}},
+        {{0xD0, 0xD1, 0xD2, 0xD3, 0xD4, 0xD5}},
+    };
+    MfClassicKey keys[COUNT_OF(keys_ref) + 1] = {};
+
+    KeysDict* dict = keys_dict_alloc(
+        NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, KeysDictModeOpenExisting, sizeof(MfClassicKey));
+
+    for(size_t batch = 1; batch <= COUNT_OF(keys); batch++) {
+        mu_assert(keys_dict_rewind(dict), "keys_dict_rewind() failed");
+        memset(keys, 0, sizeof(keys));
+
+        size_t keys_num = 0;
+        while(keys_num < COUNT_OF(keys)) {
+            const size_t count = MIN(batch, COUNT_OF(keys) - keys_num);
+            const size_t keys_read = keys_dict_get_next_keys(
+                dict, (uint8_t*)&keys[keys_num], sizeof(MfClassicKey), count);
+            keys_num += keys_read;
+            if(keys_read < count) break;
+        }
+
+        mu_assert_int_eq(COUNT_OF(keys_ref), keys_num);
+        mu_assert_mem_eq(keys_ref, keys, sizeof(keys_ref));
+    }
+
+    // Single and batched reads continue from each other
+    mu_assert(keys_dict_rewind(dict), "keys_dict_rewind() failed");
+    mu_assert(keys_dict_get_next_key(dict, keys[0].data, sizeof(MfClassicKey)), "no key");
+    mu_assert_int_eq(
+        2, keys_dict_get_next_keys(dict, (uint8_t*)&keys[1], sizeof(MfClassicKey), 2));
+    mu_assert(keys_dict_get_next_key(dict, keys[3].data, sizeof(MfClassicKey)), "no key");
+    mu_assert(!keys_dict_get_next_key(dict, keys[4].data, sizeof(MfClassicKey)), "extra key");
+    mu_assert_mem_eq(keys_ref, keys, sizeof(keys_ref));
+
+    keys_dict_free(dict);
+
+    // Decoding speed on a dictionary of the system one's size
+    mu_assert(
+        storage_file_open(
+            file, NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, FSAM_WRITE, FSOM_CREATE_ALWAYS),
+        "Create test dict failed");
+    char line[sizeof(MfClassicKey) * 2 + 2];
+    for(size_t i = 0; i < NFC_TEST_DICT_BENCH_KEYS; i++) {
+        MfClassicKey key;
+        furi_hal_random_fill_buf(key.data, sizeof(MfClassicKey));
+        hex_encode(key.data, sizeof(MfClassicKey), line);
+        strcat(line, "\n");
+        nfc_test_dict_write_str(file, line);
+    }
+    storage_file_close(file);
+
+    dict = keys_dict_alloc(
+        NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, KeysDictModeOpenExisting, sizeof(MfClassicKey));
+    MfClassicKey* batch = malloc(NFC_TEST_DICT_BENCH_BATCH * sizeof(MfClassicKey));
+
+    uint32_t start = furi_get_tick();
+    size_t keys_num = 0;
+    while(keys_dict_get_next_key(dict, batch[0].data, sizeof(MfClassicKey))) {
+        keys_num++;
+    }
+    const uint32_t single_ticks = furi_get_tick() - start;
+    mu_assert_int_eq(NFC_TEST_DICT_BENCH_KEYS, keys_num);
+
+    mu_assert(keys_dict_rewind(dict), "keys_dict_rewind() failed");
+    start = furi_get_tick();
+    keys_num = 0;
+    size_t keys_read = 0;
+    do {
+        keys_read = keys_dict_get_next_keys(
+            dict, (uint8_t*)batch, sizeof(MfClassicKey), NFC_TEST_DICT_BENCH_BATCH);
+        keys_num += keys_read;
+    } while(keys_read == NFC_TEST_DICT_BENCH_BATCH);
+    const uint32_t batch_ticks = furi_get_tick() - start;
+    mu_assert_int_eq(NFC_TEST_DICT_BENCH_KEYS, keys_num);
+
+    FURI_LOG_I(
+        TAG,
+        "Dict %u keys: %lu keys/s one by one, %lu keys/s in batches of %u",
+        NFC_TEST_DICT_BENCH_KEYS,
+        NFC_TEST_DICT_BENCH_KEYS * 1000 / MAX(single_ticks, 1UL),
+        NFC_TEST_DICT_BENCH_KEYS * 1000 / MAX(batch_ticks, 1UL),
+        NFC_TEST_DICT_BENCH_BATCH);
+
+    free(batch);
+    keys_dict_free(dict);
+    storage_file_free(file);
+
+    mu_assert(
+        storage_simply_remove(storage, NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH),
+        "Remove test dict failed");
+    furi_record_close(RECORD_STORAGE);
+}
+
 static FelicaError
     felica_do_request_response(FelicaData* felica_data, const FelicaCardKey* card_key) {
     NfcDeviceData* nfc_device = nfc_device_alloc();
@@ -679,6 +1270,73 @@ static FelicaError
     return error;
 }
 
+/* Same amount the NFC app starts recovery with, one key partition per pass */
+#define NFC_TEST_MFKEY32_MEMORY_SIZE (32 * 1024)
+
+typedef struct {
+    const char* log_line;
+    uint64_t key;
+} NfcTestMfkey32Pair;
+
+/* Lines in the .mfkey32.log format, keys are found in the first search pass */
+static const NfcTestMfkey32Pair nfc_test_mfkey32_pairs[] = {
+    {
+        .log_line = "Sec 1 key A cuid 2a234f80 nt0 d3db3550 nr0 9d47b1a3 ar0 1559b8d7 "
+                    "nt1 012312cd nr1 2588706c ar1 489ac9df",
+        .key = 0xf579218e6424,
+    },
+    {
+        .log_line = "Sec 2 key A cuid 2a234f80 nt0 0bd7b5bb nr0 c89e7681 ar0 a0b639e7 "
+                    "nt1 72d02ff2 nr1 f78c333d ar1 53aab5f6",
+        .key = 0xd2f4bbe3354f,
+    },
+    {
+        .log_line = "Sec 3 key A cuid 2a234f80 nt0 d3faf8db nr0 e389b655 ar0 fa8f4d6b "
+                    "nt1 49cd465c nr1 7912353d ar1 5155696a",
+        .key = 0x4b1dbb81016a,
+    },
+};
+
+MU_TEST(mfkey32_recover_test) {
+    Crypto1 crypto = {};
+    crypto1_init(&crypto, 0xa0a1a2a3a4a5);
+    mu_assert(crypto1_get_key(&crypto) == 0xa0a1a2a3a4a5, "Wrong key from cipher state");
+    Crypto1 rolled = crypto;
+    crypto1_word(&rolled, 0x12345678, 0);
+    crypto1_word(&rolled, 0xcafebabe, 1);
+    crypto1_rollback_word(&rolled, 0xcafebabe, 1);
+    crypto1_rollback_word(&rolled, 0x12345678, 0);
+    mu_assert(crypto1_get_key(&rolled) == 0xa0a1a2a3a4a5, "Rollback doesn't undo cipher steps");
+
+    Mfkey32* mfkey32 = mfkey32_alloc(NFC_TEST_MFKEY32_MEMORY_SIZE);
+    for(size_t i = 0; i < COUNT_OF(nfc_test_mfkey32_pairs); i++) {
+        Mfkey32Nonces nonces = {};
+        int sector_num = 0;
+        char key_type = 0;
+        int fields = sscanf(
+            nfc_test_mfkey32_pairs[i].log_line,
+            "Sec %d key %c cuid %lx nt0 %lx nr0 %lx ar0 %lx nt1 %lx nr1 %lx ar1 %lx",
+            &sector_num,
+            &key_type,
+            &nonces.cuid,
+            &nonces.nt0,
+            &nonces.nr0,
+            &nonces.ar0,
+            &nonces.nt1,
+            &nonces.nr1,
+            &nonces.ar1);
+        mu_assert(fields == 9, "Failed to parse log line");
+
+        uint64_t key = 0;
+        uint32_t start = furi_get_tick();
+        Mfkey32Error error = mfkey32_recover(mfkey32, &nonces, &key);
+        FURI_LOG_I(TAG, "Mfkey32 sector %d: %lu ms", sector_num, furi_get_tick() - start);
+        mu_assert(error == Mfkey32ErrorNone, "Key not recovered");
+        mu_assert(key == nfc_test_mfkey32_pairs[i].key, "Wrong key recovered");
+    }
+    mfkey32_free(mfkey32);
+}
+
 MU_TEST(felica_read) {
     FelicaData* felica_data = felica_alloc();
     FelicaError error = felica_do_request_response(felica_data, NULL);
@@ -827,6 +1485,8 @@ MU_TEST_SUITE(nfc) {
     nfc_test_alloc();
 
     MU_RUN_TEST(iso14443_3a_reader);
+    MU_RUN_TEST(iso14443_3a_transcript_reader);
+    MU_RUN_TEST(mf_desfire_transcript_reader);
     MU_RUN_TEST(mf_ultralight_11_reader);
     MU_RUN_TEST(mf_ultralight_21_reader);
     MU_RUN_TEST(ntag_215_reader);
@@ -858,12 +1518,15 @@ MU_TEST_SUITE(nfc) {
     MU_RUN_TEST(mf_classic_1k_7b_file_test);
     MU_RUN_TEST(mf_classic_4k_4b_file_test);
     MU_RUN_TEST(mf_classic_4k_7b_file_test);
+    MU_RUN_TEST(nfc_device_cache_test);
 
     MU_RUN_TEST(mf_classic_reader);
     MU_RUN_TEST(mf_classic_write);
     MU_RUN_TEST(mf_classic_value_block);
     MU_RUN_TEST(mf_classic_send_frame_test);
     MU_RUN_TEST(mf_classic_dict_test);
+    MU_RUN_TEST(mf_classic_dict_batch_test);
+    MU_RUN_TEST(mfkey32_recover_test);
     MU_RUN_TEST(felica_read);
     MU_RUN_TEST(felica_read_auth);
 
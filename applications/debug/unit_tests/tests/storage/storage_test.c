@@ -1,6 +1,11 @@
 #include "../test.h" // IWYU pragma: keep
 #include <furi.h>
+#include <furi_hal_rtc.h>
 #include <storage/storage.h>
+#include <lib/toolbox/md5_calc.h>
+#include <lib/toolbox/md5_cache.h>
+#include <lib/toolbox/crc32_calc.h>
+#include <mbedtls/md5.h>
 
 // DO NOT USE THIS IN PRODUCTION CODE
 // This is a hack to access internal storage functions and definitions
@@ -695,8 +700,34 @@ MU_TEST(test_storage_common_migrate) {
     furi_record_close(RECORD_STORAGE);
 }
 
+// FAT stores modification seconds with 2 s resolution
+#define STORAGE_MTIME_RESOLUTION (2)
+
+static bool storage_test_mtime_is_now(uint32_t mtime) {
+    int64_t delta = (int64_t)furi_hal_rtc_get_timestamp() - (int64_t)mtime;
+    return delta >= -STORAGE_MTIME_RESOLUTION && delta <= STORAGE_MTIME_RESOLUTION;
+}
+
+MU_TEST(test_storage_common_mtime) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    uint32_t mtime = 0;
+
+    // Two writes a second apart, so at least one lands on an odd second
+    for(size_t i = 0; i < 2; i++) {
+        storage_common_remove(storage, UNIT_TESTS_PATH("mtime.test"));
+        mu_check(storage_file_create(storage, UNIT_TESTS_PATH("mtime.test"), "mtime"));
+        mu_assert_int_eq(
+            FSE_OK, storage_common_mtime(storage, UNIT_TESTS_PATH("mtime.test"), &mtime));
+        mu_check(storage_test_mtime_is_now(mtime));
+        furi_delay_ms(1100);
+    }
+
+    mu_assert_int_eq(FSE_OK, storage_common_remove(storage, UNIT_TESTS_PATH("mtime.test")));
+
+    furi_record_close(RECORD_STORAGE);
+}
+
 #define MD5_HASH_SIZE (16)
-#include <lib/toolbox/md5_calc.h>
 
 MU_TEST(test_md5_calc) {
     Storage* storage = furi_record_open(RECORD_STORAGE);
@@ -738,6 +769,159 @@ MU_TEST(test_md5_calc) {
     furi_record_close(RECORD_STORAGE);
 }
 
+#define HASH_TEST_FILE      UNIT_TESTS_PATH("hash.test")
+#define HASH_TEST_FILE_SIZE (64 * 1024)
+
+static uint32_t hash_test_kib_per_s(size_t size, uint32_t ticks) {
+    return (uint64_t)size * furi_kernel_get_tick_frequency() / 1024 / MAX(ticks, 1UL);
+}
+
+MU_TEST(test_file_hash) {
+    // Standard CRC-32 check value
+    mu_assert_int_eq(0xCBF43926, crc32_calc_buffer(0, "123456789", 9));
+
+    const size_t file_size = HASH_TEST_FILE_SIZE;
+    if(memmgr_heap_get_max_free_block() < file_size) {
+        mu_warn("Not enough RAM for file hash test");
+        return;
+    }
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    uint8_t* data = malloc(file_size);
+
+    // Blocks differ, so misordered pipeline blocks would change the hashes
+    for(size_t i = 0; i < file_size; i++) {
+        data[i] = rand();
+    }
+
+    mu_check(storage_file_open(file, HASH_TEST_FILE, FSAM_WRITE, FSOM_CREATE_ALWAYS));
+    mu_assert_int_eq(file_size, storage_file_write(file, data, file_size));
+    storage_file_close(file);
+
+    uint32_t ticks = furi_get_tick();
+    uint32_t crc_expected = crc32_calc_buffer(0, data, file_size);
+    ticks = furi_get_tick() - ticks;
+    FURI_LOG_I("HashTest", "crc32 buffer: %lu KiB/s", hash_test_kib_per_s(file_size, ticks));
+
+    // Unaligned start and odd size exercise the byte-wise tail
+    mu_assert_int_eq(
+        crc32_calc_buffer(crc32_calc_buffer(0, data, 3), data + 3, file_size - 3), crc_expected);
+
+    uint8_t md5_expected[MD5_HASH_SIZE];
+    mbedtls_md5(data, file_size, md5_expected);
+    free(data);
+
+    mu_check(storage_file_open(file, HASH_TEST_FILE, FSAM_READ, FSOM_OPEN_EXISTING));
+    ticks = furi_get_tick();
+    uint32_t crc = crc32_calc_file(file, NULL, NULL);
+    ticks = furi_get_tick() - ticks;
+    storage_file_close(file);
+    FURI_LOG_I("HashTest", "crc32 file: %lu KiB/s", hash_test_kib_per_s(file_size, ticks));
+    mu_assert_int_eq(crc_expected, crc);
+
+    uint8_t md5[MD5_HASH_SIZE];
+    ticks = furi_get_tick();
+    mu_check(md5_calc_file(file, HASH_TEST_FILE, md5, NULL));
+    ticks = furi_get_tick() - ticks;
+    FURI_LOG_I("HashTest", "md5 file: %lu KiB/s", hash_test_kib_per_s(file_size, ticks));
+    mu_assert_mem_eq(md5_expected, md5, MD5_HASH_SIZE);
+
+    mu_assert_int_eq(FSE_OK, storage_common_remove(storage, HASH_TEST_FILE));
+
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
+#define MD5_CACHE_TEST_FILE  UNIT_TESTS_PATH("md5_cache.test")
+#define MD5_CACHE_TEST_CACHE UNIT_TESTS_PATH("md5_cache.cache")
+// Matches MD5_CACHE_FLUSH_INSERTIONS in md5_cache.c
+#define MD5_CACHE_TEST_FLUSH_FILES (16U)
+
+static void md5_cache_test_write(File* file, const char* data) {
+    mu_check(storage_file_open(file, MD5_CACHE_TEST_FILE, FSAM_WRITE, FSOM_CREATE_ALWAYS));
+    mu_assert_int_eq(strlen(data), storage_file_write(file, data, strlen(data)));
+    storage_file_close(file);
+}
+
+MU_TEST(test_md5_cache) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    uint8_t md5[MD5_HASH_SIZE];
+    uint8_t md5_expected[MD5_HASH_SIZE];
+
+    storage_common_remove(storage, MD5_CACHE_TEST_CACHE);
+    md5_cache_test_write(file, "first");
+
+    uint32_t mtime = 0;
+    mu_assert_int_eq(FSE_OK, storage_common_mtime(storage, MD5_CACHE_TEST_FILE, &mtime));
+    mu_check(storage_test_mtime_is_now(mtime));
+
+    // Hashes of files modified within the FAT time resolution are not cached
+    furi_delay_ms(3000);
+
+    Md5Cache* cache = md5_cache_alloc(storage, MD5_CACHE_TEST_CACHE);
+    mu_check(md5_cache_calc_file(cache, file, MD5_CACHE_TEST_FILE, md5, NULL));
+    mbedtls_md5((const uint8_t*)"first", 5, md5_expected);
+    mu_assert_mem_eq(md5_expected, md5, MD5_HASH_SIZE);
+    md5_cache_free(cache);
+    mu_check(storage_file_exists(storage, MD5_CACHE_TEST_CACHE));
+
+    // Persisted entry is served, then dropped by the same size rewrite
+    cache = md5_cache_alloc(storage, MD5_CACHE_TEST_CACHE);
+    mu_check(md5_cache_calc_file(cache, file, MD5_CACHE_TEST_FILE, md5, NULL));
+    mu_assert_mem_eq(md5_expected, md5, MD5_HASH_SIZE);
+
+    md5_cache_test_write(file, "other");
+    mu_check(md5_cache_calc_file(cache, file, MD5_CACHE_TEST_FILE, md5, NULL));
+    mbedtls_md5((const uint8_t*)"other", 5, md5_expected);
+    mu_assert_mem_eq(md5_expected, md5, MD5_HASH_SIZE);
+    md5_cache_free(cache);
+
+    mu_assert_int_eq(FSE_OK, storage_common_remove(storage, MD5_CACHE_TEST_FILE));
+    storage_common_remove(storage, MD5_CACHE_TEST_CACHE);
+
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST(test_md5_cache_flush) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    FuriString* path = furi_string_alloc();
+    uint8_t md5[MD5_HASH_SIZE];
+
+    storage_common_remove(storage, MD5_CACHE_TEST_CACHE);
+    for(size_t i = 0; i < MD5_CACHE_TEST_FLUSH_FILES; i++) {
+        furi_string_printf(path, MD5_CACHE_TEST_FILE ".%zu", i);
+        mu_check(
+            storage_file_open(file, furi_string_get_cstr(path), FSAM_WRITE, FSOM_CREATE_ALWAYS));
+        mu_assert_int_eq(sizeof(i), storage_file_write(file, &i, sizeof(i)));
+        storage_file_close(file);
+    }
+
+    furi_delay_ms(3000);
+
+    // Entries reach the cache file without waiting for md5_cache_free
+    Md5Cache* cache = md5_cache_alloc(storage, MD5_CACHE_TEST_CACHE);
+    for(size_t i = 0; i < MD5_CACHE_TEST_FLUSH_FILES; i++) {
+        furi_string_printf(path, MD5_CACHE_TEST_FILE ".%zu", i);
+        mu_check(md5_cache_calc_file(cache, file, furi_string_get_cstr(path), md5, NULL));
+    }
+    mu_check(storage_file_exists(storage, MD5_CACHE_TEST_CACHE));
+    md5_cache_free(cache);
+
+    for(size_t i = 0; i < MD5_CACHE_TEST_FLUSH_FILES; i++) {
+        furi_string_printf(path, MD5_CACHE_TEST_FILE ".%zu", i);
+        mu_assert_int_eq(FSE_OK, storage_common_remove(storage, furi_string_get_cstr(path)));
+    }
+    storage_common_remove(storage, MD5_CACHE_TEST_CACHE);
+
+    furi_string_free(path);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(test_data_path) {
     MU_RUN_TEST(test_storage_data_path);
     MU_RUN_TEST(test_storage_data_path_apps);
@@ -745,10 +929,14 @@ MU_TEST_SUITE(test_data_path) {
 
 MU_TEST_SUITE(test_storage_common) {
     MU_RUN_TEST(test_storage_common_migrate);
+    MU_RUN_TEST(test_storage_common_mtime);
 }
 
 MU_TEST_SUITE(test_md5_calc_suite) {
     MU_RUN_TEST(test_md5_calc);
+    MU_RUN_TEST(test_file_hash);
+    MU_RUN_TEST(test_md5_cache);
+    MU_RUN_TEST(test_md5_cache_flush);
 }
 
 int run_minunit_test_storage(void) {
@@ -2,6 +2,7 @@
 #include <toolbox/stream/stream.h>
 #include <toolbox/stream/string_stream.h>
 #include <toolbox/stream/file_stream.h>
+#include <lib/toolbox/stream/file_stream_i.h>
 #include <toolbox/stream/buffered_file_stream.h>
 #include <storage/storage.h>
 #include "../test.h" // IWYU pragma: keep
@@ -17,6 +18,8 @@ static const char* stream_test_right_data =
 
 #define FILESTREAM_PATH EXT_PATH(".tmp/unit_tests/filestream.str")
 
+#define TAG "StreamTest"
+
 MU_TEST_1(stream_composite_subtest, Stream* stream) {
     const size_t data_size = 128;
     uint8_t data[data_size];
@@ -517,12 +520,183 @@ MU_TEST(stream_buffered_large_file_test) {
     furi_string_free(output_data);
 }
 
+static bool stream_test_equal(Stream* stream_a, Stream* stream_b) {
+    if(stream_size(stream_a) != stream_size(stream_b)) return false;
+    if(stream_tell(stream_a) != stream_tell(stream_b)) return false;
+
+    size_t position = stream_tell(stream_a);
+    uint8_t buffer_a[64];
+    uint8_t buffer_b[64];
+    bool equal = stream_rewind(stream_a) && stream_rewind(stream_b);
+
+    while(equal) {
+        size_t read_a = stream_read(stream_a, buffer_a, sizeof(buffer_a));
+        size_t read_b = stream_read(stream_b, buffer_b, sizeof(buffer_b));
+        equal = (read_a == read_b) && (memcmp(buffer_a, buffer_b, read_a) == 0);
+        if(read_a == 0) break;
+    }
+
+    stream_seek(stream_a, position, StreamOffsetFromStart);
+    stream_seek(stream_b, position, StreamOffsetFromStart);
+    return equal;
+}
+
+MU_TEST_1(stream_delete_and_insert_subtest, Stream* stream) {
+    // string stream serves as a reference
+    Stream* reference = string_stream_alloc();
+    FuriString* data = furi_string_alloc();
+
+    // larger than file stream shift chunk, so the tail is moved in several chunks
+    for(size_t i = 0; i < 1000; i++) {
+        furi_string_printf(data, "Line %04zu\n", i);
+        stream_write_string(stream, data);
+        stream_write_string(reference, data);
+    }
+    mu_check(stream_test_equal(stream, reference));
+
+    const struct {
+        size_t position;
+        size_t delete_size;
+        const char* insert;
+    } edits[] = {
+        // grow in the middle
+        {3000, 10, stream_test_data},
+        // same size replace
+        {20, 10, "0123456789"},
+        // shrink across several chunks
+        {100, 6000, "x"},
+        // delete only
+        {50, 20, ""},
+        // append
+        {SIZE_MAX, 0, stream_test_left_data},
+        // delete past the end
+        {200, SIZE_MAX, stream_test_right_data},
+    };
+
+    for(size_t i = 0; i < COUNT_OF(edits); i++) {
+        if(edits[i].position == SIZE_MAX) {
+            mu_check(stream_seek(stream, 0, StreamOffsetFromEnd));
+            mu_check(stream_seek(reference, 0, StreamOffsetFromEnd));
+        } else {
+            mu_check(stream_seek(stream, edits[i].position, StreamOffsetFromStart));
+            mu_check(stream_seek(reference, edits[i].position, StreamOffsetFromStart));
+        }
+        mu_check(
+            stream_delete_and_insert_cstring(stream, edits[i].delete_size, edits[i].insert));
+        mu_check(
+            stream_delete_and_insert_cstring(reference, edits[i].delete_size, edits[i].insert));
+        mu_check(stream_test_equal(stream, reference));
+    }
+
+    furi_string_free(data);
+    stream_free(reference);
+}
+
+MU_TEST(stream_delete_and_insert_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+
+    Stream* stream = file_stream_alloc(storage);
+    mu_check(file_stream_open(stream, FILESTREAM_PATH, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS));
+    MU_RUN_TEST_1(stream_delete_and_insert_subtest, stream);
+    stream_free(stream);
+
+    stream = buffered_file_stream_alloc(storage);
+    mu_check(
+        buffered_file_stream_open(stream, FILESTREAM_PATH, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS));
+    MU_RUN_TEST_1(stream_delete_and_insert_subtest, stream);
+    stream_free(stream);
+
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST(stream_delete_and_insert_rollback_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    Stream* stream = file_stream_alloc(storage);
+    Stream* reference = string_stream_alloc();
+    mu_check(file_stream_open(stream, FILESTREAM_PATH, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS));
+
+    // 10000 bytes, the tail is moved in several chunks
+    for(size_t i = 0; i < 1000; i++) {
+        mu_assert_int_eq(10, stream_write_format(stream, "Line %04zu\n", i));
+        mu_assert_int_eq(10, stream_write_format(reference, "Line %04zu\n", i));
+    }
+
+    const struct {
+        size_t position;
+        size_t delete_size;
+        const char* insert;
+        size_t failing_write;
+    } edits[] = {
+        // grow, fails on the first chunk and after one chunk was moved
+        {3000, 10, stream_test_data, 1},
+        {3000, 10, stream_test_data, 2},
+        // shrink, fails on the first chunk and after one chunk was moved
+        {100, 10, "x", 1},
+        {100, 10, "x", 2},
+    };
+
+    for(size_t i = 0; i < COUNT_OF(edits); i++) {
+        mu_check(stream_seek(stream, edits[i].position, StreamOffsetFromStart));
+        mu_check(stream_seek(reference, edits[i].position, StreamOffsetFromStart));
+
+        // original content survives a write failure in the middle of the tail move
+        file_stream_set_shift_write_failure(stream, edits[i].failing_write);
+        mu_check(
+            !stream_delete_and_insert_cstring(stream, edits[i].delete_size, edits[i].insert));
+        file_stream_set_shift_write_failure(stream, 0);
+        mu_check(stream_test_equal(stream, reference));
+
+        // and the edit succeeds once the failure is gone
+        mu_check(
+            stream_delete_and_insert_cstring(stream, edits[i].delete_size, edits[i].insert));
+        mu_check(
+            stream_delete_and_insert_cstring(reference, edits[i].delete_size, edits[i].insert));
+        mu_check(stream_test_equal(stream, reference));
+    }
+
+    stream_free(reference);
+    stream_free(stream);
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST(stream_file_append_speed_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    Stream* stream = file_stream_alloc(storage);
+    mu_check(file_stream_open(stream, FILESTREAM_PATH, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS));
+
+    // dictionary-like file, 2000 lines of 12 bytes
+    for(size_t i = 0; i < 2000; i++) {
+        mu_assert_int_eq(13, stream_write_format(stream, "%012lX\n", (uint32_t)i));
+    }
+
+    uint32_t start = furi_get_tick();
+    for(size_t i = 0; i < 100; i++) {
+        mu_check(stream_seek(stream, 0, StreamOffsetFromEnd));
+        mu_check(stream_insert_format(stream, "%012lX\n", (uint32_t)i));
+    }
+    uint32_t append_ticks = furi_get_tick() - start;
+
+    start = furi_get_tick();
+    mu_check(stream_seek(stream, 13 * 1000, StreamOffsetFromStart));
+    mu_check(stream_delete_and_insert_cstring(stream, 13, "FFFFFFFFFFFF\n"));
+    uint32_t update_ticks = furi_get_tick() - start;
+
+    mu_assert_int_eq(13 * 2100, stream_size(stream));
+    FURI_LOG_I(TAG, "100 appends: %lu ms, one line update: %lu ms", append_ticks, update_ticks);
+
+    stream_free(stream);
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(stream_suite) {
     MU_RUN_TEST(stream_write_read_save_load_test);
     MU_RUN_TEST(stream_composite_test);
     MU_RUN_TEST(stream_split_test);
     MU_RUN_TEST(stream_buffered_write_after_read_test);
     MU_RUN_TEST(stream_buffered_large_file_test);
+    MU_RUN_TEST(stream_delete_and_insert_test);
+    MU_RUN_TEST(stream_delete_and_insert_rollback_test);
+    MU_RUN_TEST(stream_file_append_speed_test);
 }
 
 int run_minunit_test_stream(void) {
@@ -4,11 +4,16 @@
 #include <lib/subghz/receiver.h>
 #include <lib/subghz/transmitter.h>
 #include <lib/subghz/subghz_keystore.h>
+#include <lib/subghz/subghz_keystore_i.h>
 #include <lib/subghz/subghz_file_encoder_worker.h>
 #include <lib/subghz/protocols/protocol_items.h>
+#include <lib/subghz/blocks/custom_btn.h>
+#include <lib/subghz/blocks/math.h>
 #include <flipper_format/flipper_format_i.h>
 #include <lib/subghz/devices/devices.h>
 #include <lib/subghz/devices/cc1101_configs.h>
+#include <lib/subghz/devices/file/file_interconnect.h>
+#include <lib/drivers/cc1101.h>
 
 #define TAG "SubGhzTest"
 
@@ -20,6 +25,9 @@
 #define TEST_RANDOM_COUNT_PARSE 329
 #define TEST_TIMEOUT            10000
 
+#define TEST_FILE_DEVICE_TX_NAME EXT_PATH("unit_tests/subghz/file_device_tx.sub")
+#define TEST_UNRELATED_FILE_NAME EXT_PATH("unit_tests/subghz/unrelated.tmp")
+
 static SubGhzEnvironment* environment_handler;
 static SubGhzReceiver* receiver_handler;
 //static SubGhzTransmitter* transmitter_handler;
@@ -215,6 +223,70 @@ MU_TEST(subghz_keystore_test) {
         "Test keystore error");
 }
 
+MU_TEST(subghz_keystore_cache_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    storage_simply_remove(storage, KEYSTORE_DIR_NAME ".cache");
+    furi_record_close(RECORD_STORAGE);
+
+    // First load decrypts the keystore and creates the cache, second one is served from it
+    SubGhzKeystore* keystore = subghz_keystore_alloc();
+    SubGhzKeystore* keystore_cached = subghz_keystore_alloc();
+    bool loaded = subghz_keystore_load(keystore, KEYSTORE_DIR_NAME);
+    bool first_from_cache = keystore->loaded_from_cache;
+    uint32_t test_start = furi_get_tick();
+    bool loaded_cached = subghz_keystore_load(keystore_cached, KEYSTORE_DIR_NAME);
+    FURI_LOG_I(TAG, "Keystore cache load %lu ms", furi_get_tick() - test_start);
+    bool second_from_cache = keystore_cached->loaded_from_cache;
+
+    SubGhzKeyArray_t* keys = subghz_keystore_get_data(keystore);
+    SubGhzKeyArray_t* keys_cached = subghz_keystore_get_data(keystore_cached);
+    size_t mismatch_count = 0;
+    if(SubGhzKeyArray_size(*keys) == SubGhzKeyArray_size(*keys_cached)) {
+        for(size_t i = 0; i < SubGhzKeyArray_size(*keys); i++) {
+            SubGhzKey* key = SubGhzKeyArray_get(*keys, i);
+            SubGhzKey* key_cached = SubGhzKeyArray_get(*keys_cached, i);
+            if(key->key != key_cached->key || key->type != key_cached->type ||
+               !furi_string_equal(key->name, key_cached->name)) {
+                mismatch_count++;
+            }
+        }
+    }
+    size_t key_count = SubGhzKeyArray_size(*keys);
+    size_t key_cached_count = SubGhzKeyArray_size(*keys_cached);
+
+    subghz_keystore_free(keystore_cached);
+    subghz_keystore_free(keystore);
+
+    mu_assert(loaded, "Test keystore error");
+    mu_assert(loaded_cached, "Test keystore cache error");
+    mu_assert(!first_from_cache, "Keystore loaded from removed cache");
+    mu_assert(second_from_cache, "Keystore cache miss");
+    mu_assert_int_eq(key_count, key_cached_count);
+    mu_assert_int_eq(0, mismatch_count);
+}
+
+MU_TEST(subghz_keystore_cache_unrelated_write_test) {
+    // Writing another file on the card must not invalidate the cache
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    bool written =
+        storage_file_open(file, TEST_UNRELATED_FILE_NAME, FSAM_WRITE, FSOM_CREATE_ALWAYS);
+    written = written && storage_file_write(file, "test", 4) == 4;
+    storage_file_close(file);
+    storage_file_free(file);
+    storage_simply_remove(storage, TEST_UNRELATED_FILE_NAME);
+    furi_record_close(RECORD_STORAGE);
+
+    SubGhzKeystore* keystore = subghz_keystore_alloc();
+    bool loaded = subghz_keystore_load(keystore, KEYSTORE_DIR_NAME);
+    bool from_cache = keystore->loaded_from_cache;
+    subghz_keystore_free(keystore);
+
+    mu_assert(written, "Unrelated file write error");
+    mu_assert(loaded, "Test keystore error");
+    mu_assert(from_cache, "Keystore cache miss after unrelated write");
+}
+
 typedef enum {
     SubGhzHalAsyncTxTestTypeNormal,
     SubGhzHalAsyncTxTestTypeInvalidStart,
@@ -370,6 +442,87 @@ MU_TEST(subghz_hal_async_tx_test) {
 }
 
 //test decoders
+MU_TEST(subghz_calibration_cache_test) {
+    CC1101CalibrationCache* cache = malloc(sizeof(CC1101CalibrationCache));
+    cc1101_calibration_cache_reset(cache, 25);
+
+    CC1101Fscal fscal = {.fscal3 = 0xE9, .fscal2 = 0x2A, .fscal1 = 0x17};
+    CC1101Fscal result = {0};
+
+    mu_assert(!cc1101_calibration_cache_get(cache, 433920000, 25, &result), "Empty cache hit");
+
+    cc1101_calibration_cache_set(cache, 433920000, 25, &fscal);
+    mu_assert(cc1101_calibration_cache_get(cache, 433920000, 27, &result), "Cache miss");
+    mu_assert_mem_eq(&fscal, &result, sizeof(CC1101Fscal));
+    mu_assert(!cc1101_calibration_cache_get(cache, 315000000, 25, &result), "Wrong frequency");
+    mu_assert(
+        !cc1101_calibration_cache_get(
+            cache, 433920000, 25 + CC1101_CALIBRATION_TEMPERATURE_DRIFT, &result),
+        "Temperature drift ignored");
+
+    // Oldest entry is replaced when cache is full
+    for(uint32_t i = 0; i < CC1101_CALIBRATION_CACHE_SIZE; i++) {
+        cc1101_calibration_cache_set(cache, 868000000 + i * 100000, 25, &fscal);
+    }
+    mu_assert(!cc1101_calibration_cache_get(cache, 433920000, 25, &result), "Entry not evicted");
+    mu_assert(cc1101_calibration_cache_get(cache, 868000000, 25, &result), "Entry evicted");
+
+    free(cache);
+}
+
+MU_TEST(subghz_hal_hop_test) {
+    const uint32_t frequencies[] = {310000000, 315000000, 433920000, 434420000, 868350000};
+    const size_t count = COUNT_OF(frequencies);
+    FuriHalSpiBusHandle* handle = &furi_hal_spi_bus_handle_subghz;
+
+    CC1101CalibrationCache* cache = malloc(sizeof(CC1101CalibrationCache));
+    cc1101_calibration_cache_reset(cache, 25);
+
+    furi_hal_subghz_reset();
+    furi_hal_subghz_load_custom_preset(subghz_device_cc1101_preset_ook_650khz_async_regs);
+
+    furi_hal_spi_acquire(handle);
+
+    // First pass calibrates every frequency
+    bool calibrated = true;
+    for(size_t i = 0; i < count; i++) {
+        uint32_t real_frequency = cc1101_set_frequency(handle, frequencies[i]);
+        calibrated &= cc1101_calibrate_cached(handle, cache, real_frequency);
+    }
+    const uint32_t first_calibrate_count = cache->calibrate_count;
+    const uint32_t first_restore_count = cache->restore_count;
+
+    uint8_t mcsm0 = 0;
+    cc1101_read_reg(handle, CC1101_MCSM0, &mcsm0);
+
+    // Second pass only writes cached FSCAL3-1 back
+    for(size_t i = 0; i < count; i++) {
+        uint32_t real_frequency = cc1101_set_frequency(handle, frequencies[i]);
+        calibrated &= cc1101_calibrate_cached(handle, cache, real_frequency);
+    }
+    const uint32_t second_calibrate_count = cache->calibrate_count;
+    const uint32_t second_restore_count = cache->restore_count;
+
+    // Temperature drift forces calibration again
+    cc1101_calibration_cache_set_temperature(cache, 25 + CC1101_CALIBRATION_TEMPERATURE_DRIFT);
+    uint32_t real_frequency = cc1101_set_frequency(handle, frequencies[0]);
+    calibrated &= cc1101_calibrate_cached(handle, cache, real_frequency);
+
+    furi_hal_spi_release(handle);
+    furi_hal_subghz_sleep();
+
+    mu_assert(calibrated, "Calibration timeout");
+    mu_assert_int_eq(count, first_calibrate_count);
+    mu_assert_int_eq(0, first_restore_count);
+    mu_assert((mcsm0 & CC1101_MCSM0_FS_AUTOCAL_MASK) == 0, "FS_AUTOCAL not cleared");
+    mu_assert_int_eq(count, second_calibrate_count);
+    mu_assert_int_eq(count, second_restore_count);
+    mu_assert_int_eq(count + 1, cache->calibrate_count);
+    mu_assert_int_eq(count, cache->restore_count);
+
+    free(cache);
+}
+
 MU_TEST(subghz_decoder_came_atomo_test) {
     mu_assert(
         subghz_decoder_test(
@@ -707,6 +860,59 @@ MU_TEST(subghz_encoder_keeloq_test) {
         "Test encoder " SUBGHZ_PROTOCOL_KEELOQ_NAME " error\r\n");
 }
 
+MU_TEST(subghz_encoder_keeloq_renamed_remote_test) {
+    // AN-Motors hop: counter byte twice, button nibble, 0x404 tail
+    const uint32_t fix = 0x20ABCDEF;
+    const uint32_t hop = 0x12122404;
+    uint64_t key = subghz_protocol_blocks_reverse_key((uint64_t)fix << 32 | hop, 64);
+    uint8_t key_data[sizeof(uint64_t)] = {0};
+    for(size_t i = 0; i < sizeof(uint64_t); i++) {
+        key_data[sizeof(uint64_t) - i - 1] = (key >> (i * 8)) & 0xFF;
+    }
+
+    // No Manufacture in the file, the remote check has to name it
+    FlipperFormat* flipper_format = flipper_format_string_alloc();
+    flipper_format_write_header_cstr(flipper_format, "Flipper SubGhz Key File", 1);
+    flipper_format_write_string_cstr(flipper_format, "Preset", "FuriHalSubGhzPresetOok650Async");
+    flipper_format_write_string_cstr(flipper_format, "Protocol", SUBGHZ_PROTOCOL_KEELOQ_NAME);
+    uint32_t bit = 64;
+    flipper_format_write_uint32(flipper_format, "Bit", &bit, 1);
+    flipper_format_write_hex(flipper_format, "Key", key_data, sizeof(uint64_t));
+    flipper_format_rewind(flipper_format);
+
+    SubGhzKeystore* keystore = subghz_environment_get_keystore(environment_handler);
+    keystore->mfname = "";
+    subghz_custom_btns_reset();
+
+    SubGhzTransmitter* transmitter =
+        subghz_transmitter_alloc_init(environment_handler, SUBGHZ_PROTOCOL_KEELOQ_NAME);
+    mu_assert(
+        subghz_transmitter_deserialize(transmitter, flipper_format) == SubGhzProtocolStatusOk,
+        "KeeLoq deserialize error\r\n");
+
+    flipper_format_rewind(flipper_format);
+    mu_assert(
+        flipper_format_read_hex(flipper_format, "Key", key_data, sizeof(uint64_t)),
+        "KeeLoq key missing\r\n");
+    key = 0;
+    for(size_t i = 0; i < sizeof(uint64_t); i++) {
+        key = key << 8 | key_data[i];
+    }
+    key = subghz_protocol_blocks_reverse_key(key, 64);
+    uint32_t new_fix = key >> 32;
+    uint32_t new_hop = key & 0xFFFFFFFF;
+
+    mu_assert_int_eq(fix, new_fix);
+    mu_assert_int_eq(0x404, new_hop & 0xFFF);
+    mu_assert_int_eq(new_hop >> 24, (new_hop >> 16) & 0xFF);
+    mu_assert_int_eq(new_fix >> 28, (new_hop >> 12) & 0xF);
+    mu_assert(new_hop != hop, "KeeLoq counter not advanced\r\n");
+
+    subghz_transmitter_free(transmitter);
+    flipper_format_free(flipper_format);
+    keystore->mfname = "";
+}
+
 MU_TEST(subghz_encoder_linear_test) {
     mu_assert(
         subghz_encoder_test(EXT_PATH("unit_tests/subghz/linear.sub")),
@@ -837,11 +1043,100 @@ MU_TEST(subghz_random_test) {
     mu_assert(subghz_decode_random_test(TEST_RANDOM_DIR_NAME), "Random test error\r\n");
 }
 
+static void subghz_test_file_device_rx_callback(bool level, uint32_t duration, void* context) {
+    uint32_t* signal_us = context;
+    *signal_us += duration;
+    subghz_receiver_decode(receiver_handler, level, duration);
+}
+
+static bool subghz_test_file_device_replay(const SubGhzDevice* device, const char* path) {
+    uint32_t signal_us = 0;
+    uint32_t test_start = furi_get_tick();
+
+    subghz_device_file_set_rx_path(path);
+    subghz_device_file_set_speed(SUBGHZ_DEVICE_FILE_SPEED_UNLIMITED);
+    subghz_devices_start_async_rx(device, subghz_test_file_device_rx_callback, &signal_us);
+    while(!subghz_device_file_is_rx_complete() &&
+          furi_get_tick() - test_start < TEST_TIMEOUT * 10) {
+        furi_delay_ms(10);
+    }
+    subghz_devices_stop_async_rx(device);
+
+    uint32_t test_time = furi_get_tick() - test_start;
+    FURI_LOG_I(
+        TAG,
+        "Replayed %lu pulses, %lu ms of signal in %lu ms",
+        subghz_device_file_get_rx_pulse_count(),
+        signal_us / 1000,
+        test_time);
+
+    return subghz_device_file_is_rx_complete();
+}
+
+MU_TEST(subghz_file_device_rx_test) {
+    // File device is not registered, tests use it directly
+    const SubGhzDevice* device = &subghz_device_file;
+    mu_assert(subghz_devices_begin(device), "File device begin error\r\n");
+
+    subghz_test_decoder_count = 0;
+    subghz_receiver_reset(receiver_handler);
+    bool replayed = subghz_test_file_device_replay(device, TEST_RANDOM_DIR_NAME);
+
+    subghz_devices_end(device);
+
+    mu_assert(replayed, "File device replay error\r\n");
+    mu_assert_int_eq(TEST_RANDOM_COUNT_PARSE, subghz_test_decoder_count);
+}
+
+static LevelDuration subghz_test_file_device_tx_callback(void* context) {
+    uint32_t* index = context;
+    if(*index >= 1000) return level_duration_reset();
+    LevelDuration level_duration = level_duration_make(*index % 2 == 0, 100 + *index);
+    (*index)++;
+    return level_duration;
+}
+
+MU_TEST(subghz_file_device_tx_test) {
+    const SubGhzDevice* device = &subghz_device_file;
+    mu_assert(subghz_devices_begin(device), "File device begin error\r\n");
+
+    uint32_t index = 0;
+    uint32_t test_start = furi_get_tick();
+    subghz_devices_load_preset(device, FuriHalSubGhzPresetOok650Async, NULL);
+    subghz_devices_set_frequency(device, 433920000);
+    subghz_device_file_set_tx_path(TEST_FILE_DEVICE_TX_NAME);
+    subghz_device_file_set_speed(SUBGHZ_DEVICE_FILE_SPEED_UNLIMITED);
+    bool started =
+        subghz_devices_start_async_tx(device, subghz_test_file_device_tx_callback, &index);
+    while(started && !subghz_devices_is_async_complete_tx(device) &&
+          furi_get_tick() - test_start < TEST_TIMEOUT) {
+        furi_delay_ms(10);
+    }
+    subghz_devices_stop_async_tx(device);
+
+    bool replayed = started && subghz_test_file_device_replay(device, TEST_FILE_DEVICE_TX_NAME);
+    uint32_t pulse_count = subghz_device_file_get_rx_pulse_count();
+
+    subghz_devices_end(device);
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    storage_simply_remove(storage, TEST_FILE_DEVICE_TX_NAME);
+    furi_record_close(RECORD_STORAGE);
+
+    mu_assert(started, "File device TX start error\r\n");
+    mu_assert(replayed, "File device TX replay error\r\n");
+    mu_assert_int_eq(1000, pulse_count);
+}
+
 MU_TEST_SUITE(subghz) {
     subghz_test_init();
     MU_RUN_TEST(subghz_keystore_test);
+    MU_RUN_TEST(subghz_keystore_cache_test);
+    MU_RUN_TEST(subghz_keystore_cache_unrelated_write_test);
 
     MU_RUN_TEST(subghz_hal_async_tx_test);
+    MU_RUN_TEST(subghz_calibration_cache_test);
+    MU_RUN_TEST(subghz_hal_hop_test);
 
     MU_RUN_TEST(subghz_decoder_came_atomo_test);
     MU_RUN_TEST(subghz_decoder_came_test);
@@ -892,6 +1187,7 @@ MU_TEST_SUITE(subghz) {
     MU_RUN_TEST(subghz_encoder_gate_tx_test);
     MU_RUN_TEST(subghz_encoder_nice_flo_test);
     MU_RUN_TEST(subghz_encoder_keeloq_test);
+    MU_RUN_TEST(subghz_encoder_keeloq_renamed_remote_test);
     MU_RUN_TEST(subghz_encoder_linear_test);
     MU_RUN_TEST(subghz_encoder_linear_delta3_test);
     MU_RUN_TEST(subghz_encoder_megacode_test);
@@ -915,6 +1211,8 @@ MU_TEST_SUITE(subghz) {
     MU_RUN_TEST(subghz_encoder_dickert_test);
 
     MU_RUN_TEST(subghz_random_test);
+    MU_RUN_TEST(subghz_file_device_rx_test);
+    MU_RUN_TEST(subghz_file_device_tx_test);
     subghz_test_deinit();
 }
 
@@ -8,6 +8,14 @@
 #include <rpc/rpc_i.h>
 #include <flipper.pb.h>
 #include <core/event_loop.h>
+#include <lib/drivers/cc1101.h>
+#include <lib/subghz/subghz_keystore.h>
+#include <lib/subghz/devices/file/file_interconnect.h>
+#include <mbedtls/md5.h>
+#include <lib/toolbox/md5_cache.h>
+#include <lib/lfrfid/lfrfid_worker_i.h>
+#include <lib/toolbox/stream/file_stream_i.h>
+#include <lib/nfc/nfc_mock.h>
 
 static constexpr auto unit_tests_api_table = sort(create_array_t<sym_entry>(
     API_METHOD(resource_manifest_reader_alloc, ResourceManifestReader*, (Storage*)),
@@ -18,6 +26,25 @@ static constexpr auto unit_tests_api_table = sort(create_array_t<sym_entry>(
     API_METHOD(slix_process_iso15693_3_error, SlixError, (Iso15693_3Error)),
     API_METHOD(iso15693_3_poller_get_data, const Iso15693_3Data*, (Iso15693_3Poller*)),
     API_METHOD(rpc_system_storage_get_error, PB_CommandStatus, (FS_Error)),
+    API_METHOD(mbedtls_md5, int, (const unsigned char*, size_t, unsigned char[16])),
+    API_METHOD(md5_cache_alloc, Md5Cache*, (Storage*, const char*)),
+    API_METHOD(md5_cache_free, void, (Md5Cache*)),
+    API_METHOD(
+        md5_cache_calc_file,
+        bool,
+        (Md5Cache*, File*, const char*, unsigned char[16], FS_Error*)),
+#ifdef FW_CFG_unit_tests
+    API_METHOD(file_stream_set_shift_write_failure, void, (Stream*, size_t)),
+#endif
+    API_METHOD(
+        lfrfid_worker_read_is_modulation_mismatch,
+        bool,
+        (LFRFIDFeature, uint32_t, uint32_t)),
+    API_METHOD(nfc_mock_set_frame_latency, void, (uint32_t)),
+    API_METHOD(nfc_mock_set_transcript, void, (const NfcMockFrame*, size_t)),
+    API_METHOD(nfc_mock_get_transcript_position, size_t, (void)),
+    API_METHOD(nfc_mock_get_stats, void, (NfcMockStats*)),
+    API_METHOD(nfc_mock_reset, void, (void)),
     API_METHOD(xQueueSemaphoreTake, BaseType_t, (QueueHandle_t, TickType_t)),
     API_METHOD(
         xTaskGenericNotify,
@@ -42,4 +69,30 @@ static constexpr auto unit_tests_api_table = sort(create_array_t<sym_entry>(
     API_METHOD(furi_event_loop_unsubscribe, void, (FuriEventLoop*, FuriEventLoopObject*)),
     API_METHOD(furi_event_loop_run, void, (FuriEventLoop*)),
     API_METHOD(furi_event_loop_stop, void, (FuriEventLoop*)),
+    API_METHOD(cc1101_calibration_cache_reset, void, (CC1101CalibrationCache*, int8_t)),
+    API_METHOD(cc1101_calibration_cache_set_temperature, void, (CC1101CalibrationCache*, int8_t)),
+    API_METHOD(
+        cc1101_calibrate_cached,
+        bool,
+        (FuriHalSpiBusHandle*, CC1101CalibrationCache*, uint32_t)),
+    API_METHOD(cc1101_set_frequency, uint32_t, (FuriHalSpiBusHandle*, uint32_t)),
+    API_METHOD(cc1101_read_reg, CC1101Status, (FuriHalSpiBusHandle*, uint8_t, uint8_t*)),
+    API_METHOD(
+        cc1101_calibration_cache_get,
+        bool,
+        (CC1101CalibrationCache*, uint32_t, int8_t, CC1101Fscal*)),
+    API_METHOD(
+        cc1101_calibration_cache_set,
+        void,
+        (CC1101CalibrationCache*, uint32_t, int8_t, const CC1101Fscal*)),
+    API_METHOD(subghz_keystore_alloc, SubGhzKeystore*, (void)),
+    API_METHOD(subghz_keystore_free, void, (SubGhzKeystore*)),
+    API_METHOD(subghz_keystore_load, bool, (SubGhzKeystore*, const char*)),
+    API_METHOD(subghz_keystore_get_data, SubGhzKeyArray_t*, (SubGhzKeystore*)),
+    API_METHOD(subghz_device_file_set_rx_path, void, (const char*)),
+    API_METHOD(subghz_device_file_set_tx_path, void, (const char*)),
+    API_METHOD(subghz_device_file_set_speed, void, (uint32_t)),
+    API_METHOD(subghz_device_file_is_rx_complete, bool, (void)),
+    API_METHOD(subghz_device_file_get_rx_pulse_count, uint32_t, (void)),
+    API_VARIABLE(subghz_device_file, const SubGhzDevice),
     API_VARIABLE(PB_Main_msg, PB_Main_msg_t)));
@@ -7,6 +7,7 @@
 #include <furi_hal_interrupt.h>
 #include <furi_hal_resources.h>
 #include <furi_hal_bus.h>
+#include <furi_hal_power.h>
 
 #include <stm32wbxx_ll_dma.h>
 #include <furi_hal_cortex.h>
@@ -23,6 +24,9 @@
 
 #define SUBGHZ_DEVICE_CC1101_CONFIG_VER 1
 
+/* Battery temperature is used to detect synthesizer calibration drift */
+#define SUBGHZ_DEVICE_CC1101_EXT_TEMPERATURE_UPDATE_MS 10000
+
 /* DMA Channels definition */
 #define SUBGHZ_DEVICE_CC1101_EXT_DMA             (DMA2)
 #define SUBGHZ_DEVICE_CC1101_EXT_DMA_CH3_CHANNEL (LL_DMA_CHANNEL_3)
@@ -94,10 +98,22 @@ typedef struct {
     SubGhzDeviceCC1101ExtAsyncRx async_rx;
     bool power_amp;
     bool extended_range;
+    CC1101CalibrationCache calibration_cache;
+    FuriTimer* temperature_timer;
 } SubGhzDeviceCC1101Ext;
 
 static SubGhzDeviceCC1101Ext* subghz_device_cc1101_ext = NULL;
 
+static int8_t subghz_device_cc1101_ext_get_temperature(void) {
+    return (int8_t)furi_hal_power_get_battery_temperature(FuriHalPowerICFuelGauge);
+}
+
+static void subghz_device_cc1101_ext_temperature_timer_callback(void* context) {
+    CC1101CalibrationCache* calibration_cache = context;
+    cc1101_calibration_cache_set_temperature(
+        calibration_cache, subghz_device_cc1101_ext_get_temperature());
+}
+
 static bool subghz_device_cc1101_ext_check_init(void) {
     furi_assert(subghz_device_cc1101_ext->state == SubGhzDeviceCC1101ExtStateInit);
     subghz_device_cc1101_ext->state = SubGhzDeviceCC1101ExtStateIdle;
@@ -221,6 +237,15 @@ bool subghz_device_cc1101_ext_alloc(SubGhzDeviceConf* conf) {
     subghz_device_cc1101_ext->g0_pin = SUBGHZ_DEVICE_CC1101_EXT_TX_GPIO;
     subghz_device_cc1101_ext->power_amp = false;
     subghz_device_cc1101_ext->extended_range = false;
+    cc1101_calibration_cache_reset(
+        &subghz_device_cc1101_ext->calibration_cache, subghz_device_cc1101_ext_get_temperature());
+    subghz_device_cc1101_ext->temperature_timer = furi_timer_alloc(
+        subghz_device_cc1101_ext_temperature_timer_callback,
+        FuriTimerTypePeriodic,
+        &subghz_device_cc1101_ext->calibration_cache);
+    furi_timer_start(
+        subghz_device_cc1101_ext->temperature_timer,
+        furi_ms_to_ticks(SUBGHZ_DEVICE_CC1101_EXT_TEMPERATURE_UPDATE_MS));
     if(conf) {
         if(conf->ver == SUBGHZ_DEVICE_CC1101_CONFIG_VER) {
             subghz_device_cc1101_ext->power_amp = conf->power_amp;
@@ -243,6 +268,7 @@ bool subghz_device_cc1101_ext_alloc(SubGhzDeviceConf* conf) {
 void subghz_device_cc1101_ext_free(void) {
     furi_assert(subghz_device_cc1101_ext != NULL);
 
+    furi_timer_free(subghz_device_cc1101_ext->temperature_timer);
     furi_hal_spi_bus_handle_deinit(subghz_device_cc1101_ext->spi_bus_handle);
     if(subghz_device_cc1101_ext->power_amp) {
         furi_hal_gpio_init_simple(SUBGHZ_DEVICE_CC1101_EXT_E07_AMP_GPIO, GpioModeAnalog);
@@ -534,11 +560,11 @@ uint32_t subghz_device_cc1101_ext_set_frequency(uint32_t value) {
     furi_hal_spi_acquire(subghz_device_cc1101_ext->spi_bus_handle);
     uint32_t real_frequency =
         cc1101_set_frequency(subghz_device_cc1101_ext->spi_bus_handle, value);
-    cc1101_calibrate(subghz_device_cc1101_ext->spi_bus_handle);
-
-    while(true) {
-        CC1101Status status = cc1101_get_status(subghz_device_cc1101_ext->spi_bus_handle);
-        if(status.STATE == CC1101StateIDLE) break;
+    if(!cc1101_calibrate_cached(
+           subghz_device_cc1101_ext->spi_bus_handle,
+           &subghz_device_cc1101_ext->calibration_cache,
+           real_frequency)) {
+        FURI_LOG_E(TAG, "Calibration timeout");
     }
 
     furi_hal_spi_release(subghz_device_cc1101_ext->spi_bus_handle);
@@ -25,6 +25,7 @@ ArchiveApp* archive_alloc(void) {
     archive->loader = furi_record_open(RECORD_LOADER);
     archive->fav_move_str = furi_string_alloc();
     archive->dst_path = furi_string_alloc();
+    archive_favorites_init();
 
     archive->scene_manager = scene_manager_alloc(&archive_scene_handlers, archive);
     archive->view_dispatcher = view_dispatcher_alloc();
@@ -83,6 +84,7 @@ void archive_free(ArchiveApp* archive) {
     browser_free(archive->browser);
     furi_string_free(archive->fav_move_str);
     furi_string_free(archive->dst_path);
+    archive_favorites_deinit();
 
     furi_record_close(RECORD_DIALOGS);
     archive->dialogs = NULL;
@@ -4,265 +4,242 @@
 #include "archive_apps.h"
 #include "archive_browser.h"
 
-#define ARCHIVE_FAV_FILE_BUF_LEN 32
+#include <m-array.h>
+#include <m-dict.h>
+#include <toolbox/stream/buffered_file_stream.h>
+
+ARRAY_DEF(ArchiveFavoritesList, FuriString*, FURI_STRING_OPLIST) // NOLINT
+DICT_SET_DEF(ArchiveFavoritesSet, FuriString*, FURI_STRING_OPLIST) // NOLINT
+
+typedef struct {
+    /* Favorites in file order */
+    ArchiveFavoritesList_t list;
+    /* Same entries, for membership queries */
+    ArchiveFavoritesSet_t set;
+    bool loaded;
+    /* Favorites file modification time at last load or save, 0 if there is no file */
+    uint32_t mtime;
+} ArchiveFavorites;
+
+static ArchiveFavorites* favorites = NULL;
+
+static uint32_t archive_favorites_file_mtime(Storage* storage) {
+    uint32_t mtime = 0;
+    if(storage_common_mtime(storage, ARCHIVE_FAV_PATH, &mtime) != FSE_OK) {
+        mtime = 0;
+    }
+    return mtime;
+}
 
-static bool archive_favorites_read_line(File* file, FuriString* str_result) {
-    furi_string_reset(str_result);
-    uint8_t buffer[ARCHIVE_FAV_FILE_BUF_LEN];
-    bool result = false;
+static bool archive_favorites_contains(FuriString* path) {
+    return ArchiveFavoritesSet_get(favorites->set, path) != NULL;
+}
 
-    do {
-        size_t read_count = storage_file_read(file, buffer, ARCHIVE_FAV_FILE_BUF_LEN);
-        if(storage_file_get_error(file) != FSE_OK) {
-            return false;
-        }
+static void archive_favorites_push(FuriString* path) {
+    if(!archive_favorites_contains(path)) {
+        ArchiveFavoritesList_push_back(favorites->list, path);
+        ArchiveFavoritesSet_push(favorites->set, path);
+    }
+}
 
-        for(size_t i = 0; i < read_count; i++) {
-            if(buffer[i] == '\n') {
-                uint32_t position = storage_file_tell(file);
-                if(storage_file_get_error(file) != FSE_OK) {
-                    return false;
-                }
+static void archive_favorites_reset(void) {
+    ArchiveFavoritesList_reset(favorites->list);
+    ArchiveFavoritesSet_reset(favorites->set);
+}
 
-                position = position - read_count + i + 1;
+static void archive_favorites_load(Storage* storage) {
+    archive_favorites_reset();
 
-                storage_file_seek(file, position, true);
-                if(storage_file_get_error(file) != FSE_OK) {
-                    return false;
-                }
+    Stream* stream = buffered_file_stream_alloc(storage);
+    FuriString* line = furi_string_alloc();
 
-                result = true;
-                break;
-            } else {
-                furi_string_push_back(str_result, buffer[i]);
+    if(buffered_file_stream_open(stream, ARCHIVE_FAV_PATH, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        while(stream_read_line(stream, line)) {
+            furi_string_trim(line, "\r\n");
+            if(!furi_string_empty(line)) {
+                archive_favorites_push(line);
             }
         }
+    }
 
-        if(result || read_count == 0) {
-            break;
-        }
-    } while(true);
+    furi_string_free(line);
+    buffered_file_stream_close(stream);
+    stream_free(stream);
 
-    return result;
+    favorites->mtime = archive_favorites_file_mtime(storage);
+    favorites->loaded = true;
 }
 
-uint16_t archive_favorites_count(void* context) {
-    furi_assert(context);
-
-    Storage* fs_api = furi_record_open(RECORD_STORAGE);
-    File* file = storage_file_alloc(fs_api);
+/* Load favorites on first use, reload them if the file was changed elsewhere */
+static void archive_favorites_sync(bool check_file) {
+    furi_check(favorites);
 
-    FuriString* buffer;
-    buffer = furi_string_alloc();
+    if(favorites->loaded && !check_file) {
+        return;
+    }
 
-    bool result = storage_file_open(file, ARCHIVE_FAV_PATH, FSAM_READ, FSOM_OPEN_EXISTING);
-    uint16_t lines = 0;
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    if(!favorites->loaded || archive_favorites_file_mtime(storage) != favorites->mtime) {
+        archive_favorites_load(storage);
+    }
+    furi_record_close(RECORD_STORAGE);
+}
 
-    if(result) {
-        while(1) {
-            if(!archive_favorites_read_line(file, buffer)) {
-                break;
-            }
-            if(!furi_string_size(buffer)) {
-                continue; // Skip empty lines
-            }
-            ++lines;
-        }
+static void archive_favorites_persist(void) {
+    FuriString* data = furi_string_alloc();
+    ArchiveFavoritesList_it_t it;
+    for(ArchiveFavoritesList_it(it, favorites->list); !ArchiveFavoritesList_end_p(it);
+        ArchiveFavoritesList_next(it)) {
+        furi_string_cat(data, *ArchiveFavoritesList_cref(it));
+        furi_string_push_back(data, '\n');
     }
 
+    Storage* fs_api = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(fs_api);
+
+    if(storage_file_open(file, ARCHIVE_FAV_TEMP_PATH, FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+        storage_file_write(file, furi_string_get_cstr(data), furi_string_size(data));
+    }
     storage_file_close(file);
 
-    furi_string_free(buffer);
+    storage_common_remove(fs_api, ARCHIVE_FAV_PATH);
+    storage_common_rename(fs_api, ARCHIVE_FAV_TEMP_PATH, ARCHIVE_FAV_PATH);
+    storage_common_remove(fs_api, ARCHIVE_FAV_TEMP_PATH);
+
+    favorites->mtime = archive_favorites_file_mtime(fs_api);
+
     storage_file_free(file);
     furi_record_close(RECORD_STORAGE);
+    furi_string_free(data);
+}
 
-    return lines;
+/* Remove entry at index from both the list and the set */
+static void archive_favorites_remove_at(size_t index) {
+    FuriString* path = *ArchiveFavoritesList_get(favorites->list, index);
+    ArchiveFavoritesSet_erase(favorites->set, path);
+    ArchiveFavoritesList_remove_v(favorites->list, index, index + 1);
 }
 
-static bool archive_favourites_rescan(void) {
-    FuriString* buffer;
-    buffer = furi_string_alloc();
-    Storage* storage = furi_record_open(RECORD_STORAGE);
-    File* file = storage_file_alloc(storage);
+/* Exact match, or an entry inside of the directory */
+static bool archive_favorites_is_under(FuriString* entry, FuriString* path) {
+    size_t path_len = furi_string_size(path);
+    return furi_string_start_with(entry, path) &&
+           (furi_string_size(entry) == path_len ||
+            furi_string_get_char(entry, path_len) == '/');
+}
 
-    bool result = storage_file_open(file, ARCHIVE_FAV_PATH, FSAM_READ, FSOM_OPEN_EXISTING);
-    if(result) {
-        while(1) {
-            if(!archive_favorites_read_line(file, buffer)) {
-                break;
-            }
-            if(!furi_string_size(buffer)) {
-                continue;
-            }
+void archive_favorites_init(void) {
+    furi_check(favorites == NULL);
 
-            if(furi_string_search(buffer, "/app:") == 0) {
-                if(archive_app_is_available(NULL, furi_string_get_cstr(buffer))) {
-                    archive_file_append(
-                        ARCHIVE_FAV_TEMP_PATH, "%s\n", furi_string_get_cstr(buffer));
-                }
-            } else {
-                if(storage_file_exists(storage, furi_string_get_cstr(buffer))) {
-                    archive_file_append(
-                        ARCHIVE_FAV_TEMP_PATH, "%s\n", furi_string_get_cstr(buffer));
-                }
-            }
-        }
-    }
+    favorites = malloc(sizeof(ArchiveFavorites));
+    ArchiveFavoritesList_init(favorites->list);
+    ArchiveFavoritesSet_init(favorites->set);
+    favorites->loaded = false;
+    favorites->mtime = 0;
+}
 
-    furi_string_free(buffer);
+void archive_favorites_deinit(void) {
+    furi_check(favorites);
 
-    storage_file_close(file);
-    storage_common_remove(storage, ARCHIVE_FAV_PATH);
-    storage_common_rename(storage, ARCHIVE_FAV_TEMP_PATH, ARCHIVE_FAV_PATH);
-    storage_common_remove(storage, ARCHIVE_FAV_TEMP_PATH);
+    ArchiveFavoritesList_clear(favorites->list);
+    ArchiveFavoritesSet_clear(favorites->set);
+    free(favorites);
+    favorites = NULL;
+}
 
-    storage_file_free(file);
-    furi_record_close(RECORD_STORAGE);
+uint16_t archive_favorites_count(void* context) {
+    furi_assert(context);
 
-    return result;
+    archive_favorites_sync(true);
+    return ArchiveFavoritesList_size(favorites->list);
 }
 
 bool archive_favorites_read(void* context) {
     furi_assert(context);
 
     ArchiveBrowserView* browser = context;
-    Storage* storage = furi_record_open(RECORD_STORAGE);
-    File* file = storage_file_alloc(storage);
+    archive_favorites_sync(true);
 
-    FuriString* buffer;
+    Storage* storage = furi_record_open(RECORD_STORAGE);
     FileInfo file_info;
-    buffer = furi_string_alloc();
-
     bool need_refresh = false;
     uint16_t file_count = 0;
 
     archive_file_array_rm_all(browser);
 
-    bool result = storage_file_open(file, ARCHIVE_FAV_PATH, FSAM_READ, FSOM_OPEN_EXISTING);
+    // Listing has to stat every entry anyway, so stale ones are dropped right here
+    for(size_t i = 0; i < ArchiveFavoritesList_size(favorites->list);) {
+        FuriString* entry = *ArchiveFavoritesList_get(favorites->list, i);
+        const char* path = furi_string_get_cstr(entry);
 
-    if(result) {
-        while(1) {
-            if(!archive_favorites_read_line(file, buffer)) {
-                break;
-            }
-            if(!furi_string_size(buffer)) {
+        if(furi_string_start_with(entry, "/app:")) {
+            if(archive_app_is_available(browser, path)) {
+                archive_add_app_item(browser, path);
+                file_count++;
+                i++;
                 continue;
             }
-
-            if(furi_string_search(buffer, "/app:") == 0) {
-                if(archive_app_is_available(browser, furi_string_get_cstr(buffer))) {
-                    archive_add_app_item(browser, furi_string_get_cstr(buffer));
-                    file_count++;
-                } else {
-                    need_refresh = true;
-                }
-            } else {
-                if(storage_file_exists(storage, furi_string_get_cstr(buffer))) {
-                    storage_common_stat(storage, furi_string_get_cstr(buffer), &file_info);
-                    archive_add_file_item(
-                        browser, file_info_is_dir(&file_info), furi_string_get_cstr(buffer));
-                    file_count++;
-                } else {
-                    need_refresh = true;
-                }
-            }
-
-            furi_string_reset(buffer);
+        } else if(storage_common_stat(storage, path, &file_info) == FSE_OK) {
+            archive_add_file_item(browser, file_info_is_dir(&file_info), path);
+            file_count++;
+            i++;
+            continue;
         }
+
+        archive_favorites_remove_at(i);
+        need_refresh = true;
     }
-    storage_file_close(file);
-    furi_string_free(buffer);
-    storage_file_free(file);
+
     furi_record_close(RECORD_STORAGE);
 
     archive_set_item_count(browser, file_count);
 
-    if(need_refresh) { //-V547
-        archive_favourites_rescan();
+    if(need_refresh) {
+        archive_favorites_persist();
     }
 
-    return result;
+    // Whether there is a favorites file at all
+    return favorites->mtime != 0;
 }
 
 bool archive_favorites_delete(const char* format, ...) {
-    FuriString* buffer;
     FuriString* filename;
     va_list args;
     va_start(args, format);
     filename = furi_string_alloc_vprintf(format, args);
     va_end(args);
 
-    buffer = furi_string_alloc();
-    Storage* fs_api = furi_record_open(RECORD_STORAGE);
-    File* file = storage_file_alloc(fs_api);
-
-    bool result = storage_file_open(file, ARCHIVE_FAV_PATH, FSAM_READ, FSOM_OPEN_EXISTING);
+    archive_favorites_sync(false);
 
-    if(result) {
-        while(1) {
-            if(!archive_favorites_read_line(file, buffer)) {
-                break;
-            }
-            if(!furi_string_size(buffer)) {
-                continue;
-            }
-
-            if(furi_string_search(buffer, filename)) {
-                archive_file_append(ARCHIVE_FAV_TEMP_PATH, "%s\n", furi_string_get_cstr(buffer));
-            }
+    bool changed = false;
+    for(size_t i = 0; i < ArchiveFavoritesList_size(favorites->list);) {
+        if(archive_favorites_is_under(*ArchiveFavoritesList_get(favorites->list, i), filename)) {
+            archive_favorites_remove_at(i);
+            changed = true;
+        } else {
+            i++;
         }
     }
 
-    furi_string_free(buffer);
-    furi_string_free(filename);
-
-    storage_file_close(file);
-    storage_common_remove(fs_api, ARCHIVE_FAV_PATH);
-    storage_common_rename(fs_api, ARCHIVE_FAV_TEMP_PATH, ARCHIVE_FAV_PATH);
-    storage_common_remove(fs_api, ARCHIVE_FAV_TEMP_PATH);
-
-    storage_file_free(file);
-    furi_record_close(RECORD_STORAGE);
+    if(changed) {
+        archive_favorites_persist();
+    }
 
-    return result;
+    furi_string_free(filename);
+    return changed;
 }
 
 bool archive_is_favorite(const char* format, ...) {
-    FuriString* buffer;
     FuriString* filename;
     va_list args;
     va_start(args, format);
     filename = furi_string_alloc_vprintf(format, args);
     va_end(args);
 
-    buffer = furi_string_alloc();
-    Storage* fs_api = furi_record_open(RECORD_STORAGE);
-    File* file = storage_file_alloc(fs_api);
-
-    bool found = false;
-    bool result = storage_file_open(file, ARCHIVE_FAV_PATH, FSAM_READ, FSOM_OPEN_EXISTING);
+    archive_favorites_sync(false);
+    bool found = archive_favorites_contains(filename);
 
-    if(result) {
-        while(1) {
-            if(!archive_favorites_read_line(file, buffer)) {
-                break;
-            }
-            if(!furi_string_size(buffer)) {
-                continue;
-            }
-            if(!furi_string_search(buffer, filename)) {
-                found = true;
-                break;
-            }
-        }
-    }
-
-    storage_file_close(file);
-    furi_string_free(buffer);
     furi_string_free(filename);
-    storage_file_free(file);
-    furi_record_close(RECORD_STORAGE);
-
     return found;
 }
 
@@ -270,70 +247,68 @@ bool archive_favorites_rename(const char* src, const char* dst) {
     furi_assert(src);
     furi_assert(dst);
 
-    Storage* fs_api = furi_record_open(RECORD_STORAGE);
-    File* file = storage_file_alloc(fs_api);
+    archive_favorites_sync(false);
 
-    FuriString* path;
-    FuriString* buffer;
+    FuriString* path = furi_string_alloc_set(src);
+    FuriString* new_path = furi_string_alloc();
+    bool changed = false;
 
-    buffer = furi_string_alloc();
-    path = furi_string_alloc();
-
-    furi_string_printf(path, "%s", src);
-    bool result = storage_file_open(file, ARCHIVE_FAV_PATH, FSAM_READ, FSOM_OPEN_EXISTING);
+    for(size_t i = 0; i < ArchiveFavoritesList_size(favorites->list);) {
+        FuriString* entry = *ArchiveFavoritesList_get(favorites->list, i);
+        if(!archive_favorites_is_under(entry, path)) {
+            i++;
+            continue;
+        }
 
-    if(result) {
-        while(1) {
-            if(!archive_favorites_read_line(file, buffer)) {
-                break;
-            }
-            if(!furi_string_size(buffer)) {
-                continue;
-            }
+        // Entries inside of a renamed directory keep their relative path
+        furi_string_set(new_path, dst);
+        furi_string_cat_str(new_path, furi_string_get_cstr(entry) + furi_string_size(path));
+        changed = true;
 
-            archive_file_append(
-                ARCHIVE_FAV_TEMP_PATH,
-                "%s\n",
-                furi_string_search(buffer, path) ? furi_string_get_cstr(buffer) : dst);
+        if(archive_favorites_contains(new_path)) {
+            archive_favorites_remove_at(i);
+            continue;
         }
-    }
 
-    furi_string_free(buffer);
-    furi_string_free(path);
-
-    storage_file_close(file);
-    storage_common_remove(fs_api, ARCHIVE_FAV_PATH);
-    storage_common_rename(fs_api, ARCHIVE_FAV_TEMP_PATH, ARCHIVE_FAV_PATH);
-    storage_common_remove(fs_api, ARCHIVE_FAV_TEMP_PATH);
+        ArchiveFavoritesSet_erase(favorites->set, entry);
+        furi_string_set(entry, new_path);
+        ArchiveFavoritesSet_push(favorites->set, entry);
+        i++;
+    }
 
-    storage_file_free(file);
-    furi_record_close(RECORD_STORAGE);
+    if(changed) {
+        archive_favorites_persist();
+    }
 
-    return result;
+    furi_string_free(new_path);
+    furi_string_free(path);
+    return changed;
 }
 
 void archive_add_to_favorites(const char* file_path) {
     furi_assert(file_path);
 
-    archive_file_append(ARCHIVE_FAV_PATH, "%s\n", file_path);
+    archive_favorites_sync(false);
+
+    FuriString* path = furi_string_alloc_set(file_path);
+    if(!archive_favorites_contains(path)) {
+        archive_favorites_push(path);
+        archive_favorites_persist();
+    }
+    furi_string_free(path);
 }
 
 void archive_favorites_save(void* context) {
     furi_assert(context);
 
     ArchiveBrowserView* browser = context;
-    Storage* fs_api = furi_record_open(RECORD_STORAGE);
-    File* file = storage_file_alloc(fs_api);
+    archive_favorites_sync(false);
+    archive_favorites_reset();
 
     for(size_t i = 0; i < archive_file_get_array_size(browser); i++) {
         ArchiveFile_t* item = archive_get_file_at(browser, i);
-        archive_file_append(ARCHIVE_FAV_TEMP_PATH, "%s\n", furi_string_get_cstr(item->path));
+        archive_favorites_push(item->path);
     }
 
-    storage_common_remove(fs_api, ARCHIVE_FAV_PATH);
-    storage_common_rename(fs_api, ARCHIVE_FAV_TEMP_PATH, ARCHIVE_FAV_PATH);
-    storage_common_remove(fs_api, ARCHIVE_FAV_TEMP_PATH);
-
-    storage_file_free(file);
-    furi_record_close(RECORD_STORAGE);
+    archive_favorites_persist();
 }
@@ -5,6 +5,10 @@
 #define ARCHIVE_FAV_PATH      EXT_PATH("favorites.txt")
 #define ARCHIVE_FAV_TEMP_PATH EXT_PATH("favorites.tmp")
 
+/** Set up the in-memory favorites set, the file itself is loaded on first use */
+void archive_favorites_init(void);
+void archive_favorites_deinit(void);
+
 uint16_t archive_favorites_count(void* context);
 bool archive_favorites_read(void* context);
 bool archive_favorites_delete(const char* format, ...) _ATTRIBUTE((__format__(__printf__, 1, 2)));
@@ -20,6 +20,8 @@ typedef struct {
 
     bool (*kb_press)(void* inst, uint16_t button);
     bool (*kb_release)(void* inst, uint16_t button);
+    bool (*kb_press_multiple)(void* inst, const uint16_t* buttons, size_t count);
+    bool (*kb_release_multiple)(void* inst, const uint16_t* buttons, size_t count);
     bool (*consumer_press)(void* inst, uint16_t button);
     bool (*consumer_release)(void* inst, uint16_t button);
     bool (*release_all)(void* inst);
@@ -135,22 +135,48 @@ int32_t ducky_error(BadUsbScript* bad_usb, const char* text, ...) {
     return SCRIPT_STATE_ERROR;
 }
 
+static void ducky_type_keys(BadUsbScript* bad_usb, const uint16_t* keys, size_t keys_nb) {
+    if(keys_nb == 1) {
+        bad_usb->hid->kb_press(bad_usb->hid_inst, keys[0]);
+        bad_usb->hid->kb_release(bad_usb->hid_inst, keys[0]);
+    } else if(keys_nb > 1) {
+        bad_usb->hid->kb_press_multiple(bad_usb->hid_inst, keys, keys_nb);
+        bad_usb->hid->kb_release_multiple(bad_usb->hid_inst, keys, keys_nb);
+    }
+}
+
+static bool ducky_keys_contain(const uint16_t* keys, size_t keys_nb, uint16_t keycode) {
+    for(size_t i = 0; i < keys_nb; i++) {
+        if((keys[i] & 0xFF) == (keycode & 0xFF)) return true;
+    }
+    return false;
+}
+
 bool ducky_string(BadUsbScript* bad_usb, const char* param) {
     uint32_t i = 0;
+    uint16_t keys[HID_KB_MAX_KEYS];
+    size_t keys_nb = 0;
+    // Held keys occupy report slots too
+    size_t keys_max = MIN(bad_usb->key_rollover, HID_KB_MAX_KEYS - bad_usb->key_hold_nb);
+    keys_max = MAX(keys_max, 1U);
 
     while(param[i] != '\0') {
-        if(param[i] != '\n') {
-            uint16_t keycode = BADUSB_ASCII_TO_KEY(bad_usb, param[i]);
-            if(keycode != HID_KEYBOARD_NONE) {
-                bad_usb->hid->kb_press(bad_usb->hid_inst, keycode);
-                bad_usb->hid->kb_release(bad_usb->hid_inst, keycode);
-            }
-        } else {
-            bad_usb->hid->kb_press(bad_usb->hid_inst, HID_KEYBOARD_RETURN);
-            bad_usb->hid->kb_release(bad_usb->hid_inst, HID_KEYBOARD_RETURN);
-        }
+        uint16_t keycode = (param[i] != '\n') ? BADUSB_ASCII_TO_KEY(bad_usb, param[i]) :
+                                                HID_KEYBOARD_RETURN;
         i++;
+        if(keycode == HID_KEYBOARD_NONE) continue;
+
+        // A single report can only carry distinct keys with the same modifiers
+        if(keys_nb > 0 &&
+           ((keys_nb == keys_max) || ((keycode & 0xFF00) != (keys[0] & 0xFF00)) ||
+            ducky_keys_contain(keys, keys_nb, keycode))) {
+            ducky_type_keys(bad_usb, keys, keys_nb);
+            keys_nb = 0;
+        }
+        keys[keys_nb++] = keycode;
     }
+    ducky_type_keys(bad_usb, keys, keys_nb);
+
     bad_usb->stringdelay = 0;
     return true;
 }
@@ -178,19 +204,22 @@ static bool ducky_string_next(BadUsbScript* bad_usb) {
     return false;
 }
 
-static int32_t ducky_parse_line(BadUsbScript* bad_usb, FuriString* line) {
+static int32_t ducky_compile_line(BadUsbScript* bad_usb, FuriString* line, DuckyAction* action) {
     uint32_t line_len = furi_string_size(line);
     const char* line_tmp = furi_string_get_cstr(line);
 
+    action->type = DuckyActionNone;
     if(line_len == 0) {
         return SCRIPT_STATE_NEXT_LINE; // Skip empty lines
     }
     FURI_LOG_D(WORKER_TAG, "line:%s", line_tmp);
 
     // Ducky Lang Functions
-    int32_t cmd_result = ducky_execute_cmd(bad_usb, line_tmp);
-    if(cmd_result != SCRIPT_STATE_CMD_UNKNOWN) {
-        return cmd_result;
+    int32_t cmd_index = ducky_get_command_index(line_tmp);
+    if(cmd_index != SCRIPT_STATE_CMD_UNKNOWN) {
+        action->type = DuckyActionCommand;
+        action->cmd_index = cmd_index;
+        return 0;
     }
 
     // Special keys + modifiers
@@ -207,11 +236,33 @@ static int32_t ducky_parse_line(BadUsbScript* bad_usb, FuriString* line) {
             key |= ducky_get_keycode(bad_usb, line_tmp + offset, true);
         }
     }
-    bad_usb->hid->kb_press(bad_usb->hid_inst, key);
-    bad_usb->hid->kb_release(bad_usb->hid_inst, key);
+    action->type = DuckyActionKey;
+    action->key = key;
     return 0;
 }
 
+static int32_t
+    ducky_execute_action(BadUsbScript* bad_usb, const DuckyAction* action, FuriString* line) {
+    switch(action->type) {
+    case DuckyActionCommand:
+        return ducky_execute_cmd(bad_usb, furi_string_get_cstr(line), action->cmd_index);
+    case DuckyActionKey:
+        bad_usb->hid->kb_press(bad_usb->hid_inst, action->key);
+        bad_usb->hid->kb_release(bad_usb->hid_inst, action->key);
+        return 0;
+    default:
+        return SCRIPT_STATE_NEXT_LINE;
+    }
+}
+
+static int32_t ducky_parse_line(BadUsbScript* bad_usb, FuriString* line, DuckyAction* action) {
+    int32_t state = ducky_compile_line(bad_usb, line, action);
+    if(state != 0) {
+        return state;
+    }
+    return ducky_execute_action(bad_usb, action, line);
+}
+
 static bool ducky_set_usb_id(BadUsbScript* bad_usb, const char* line) {
     if(sscanf(line, "%lX:%lX", &bad_usb->hid_cfg.vid, &bad_usb->hid_cfg.pid) == 2) {
         bad_usb->hid_cfg.manuf[0] = '\0';
@@ -249,8 +300,9 @@ static void bad_usb_hid_state_callback(bool state, void* context) {
 }
 
 static bool ducky_script_preload(BadUsbScript* bad_usb, File* script_file) {
-    uint8_t ret = 0;
+    size_t ret = 0;
     uint32_t line_len = 0;
+    uint32_t start = furi_get_tick();
 
     furi_string_reset(bad_usb->line);
 
@@ -275,6 +327,12 @@ static bool ducky_script_preload(BadUsbScript* bad_usb, File* script_file) {
         }
     } while(ret > 0);
 
+    FURI_LOG_I(
+        WORKER_TAG,
+        "Preloaded %zu lines in %lu ms",
+        bad_usb->st.line_nb,
+        furi_get_tick() - start);
+
     const char* line_tmp = furi_string_get_cstr(bad_usb->line);
     bool id_set = false; // Looking for ID command at first line
     if(strncmp(line_tmp, ducky_cmd_id, strlen(ducky_cmd_id)) == 0) {
@@ -299,7 +357,7 @@ static int32_t ducky_script_execute_next(BadUsbScript* bad_usb, File* script_fil
 
     if(bad_usb->repeat_cnt > 0) {
         bad_usb->repeat_cnt--;
-        delay_val = ducky_parse_line(bad_usb, bad_usb->line_prev);
+        delay_val = ducky_execute_action(bad_usb, &bad_usb->action_prev, bad_usb->line_prev);
         if(delay_val == SCRIPT_STATE_NEXT_LINE) { // Empty line
             return 0;
         } else if(delay_val == SCRIPT_STATE_STRING_START) { // Print string with delays
@@ -316,6 +374,7 @@ static int32_t ducky_script_execute_next(BadUsbScript* bad_usb, File* script_fil
     }
 
     furi_string_set(bad_usb->line_prev, bad_usb->line);
+    bad_usb->action_prev = bad_usb->action;
     furi_string_reset(bad_usb->line);
 
     while(1) {
@@ -332,13 +391,13 @@ static int32_t ducky_script_execute_next(BadUsbScript* bad_usb, File* script_fil
             bad_usb->buf_start = 0;
             if(bad_usb->buf_len == 0) return SCRIPT_STATE_END;
         }
-        for(uint8_t i = bad_usb->buf_start; i < (bad_usb->buf_start + bad_usb->buf_len); i++) {
+        for(uint16_t i = bad_usb->buf_start; i < (bad_usb->buf_start + bad_usb->buf_len); i++) {
             if(bad_usb->file_buf[i] == '\n' && furi_string_size(bad_usb->line) > 0) {
                 bad_usb->st.line_cur++;
                 bad_usb->buf_len = bad_usb->buf_len + bad_usb->buf_start - (i + 1);
                 bad_usb->buf_start = i + 1;
                 furi_string_trim(bad_usb->line);
-                delay_val = ducky_parse_line(bad_usb, bad_usb->line);
+                delay_val = ducky_parse_line(bad_usb, bad_usb->line, &bad_usb->action);
                 if(delay_val == SCRIPT_STATE_NEXT_LINE) { // Empty line
                     return 0;
                 } else if(delay_val == SCRIPT_STATE_STRING_START) { // Print string with delays
@@ -441,6 +500,7 @@ static int32_t bad_usb_worker(void* context) {
                 bad_usb->defstringdelay = 0;
                 bad_usb->repeat_cnt = 0;
                 bad_usb->key_hold_nb = 0;
+                bad_usb->key_rollover = 1;
                 bad_usb->file_end = false;
                 storage_file_seek(script_file, 0, true);
                 worker_state = BadUsbStateRunning;
@@ -464,6 +524,7 @@ static int32_t bad_usb_worker(void* context) {
                 bad_usb->stringdelay = 0;
                 bad_usb->defstringdelay = 0;
                 bad_usb->repeat_cnt = 0;
+                bad_usb->key_rollover = 1;
                 bad_usb->file_end = false;
                 storage_file_seek(script_file, 0, true);
                 // extra time for PC to recognize Flipper as keyboard
@@ -183,6 +183,19 @@ static int32_t ducky_fnc_globe(BadUsbScript* bad_usb, const char* line, int32_t
     return 0;
 }
 
+static int32_t ducky_fnc_rollover(BadUsbScript* bad_usb, const char* line, int32_t param) {
+    UNUSED(param);
+
+    line = &line[ducky_get_command_len(line) + 1];
+    uint32_t rollover = 0;
+    bool state = ducky_get_number(line, &rollover);
+    if((!state) || (rollover == 0) || (rollover > HID_KB_MAX_KEYS)) {
+        return ducky_error(bad_usb, "Invalid number %s", line);
+    }
+    bad_usb->key_rollover = rollover;
+    return 0;
+}
+
 static int32_t ducky_fnc_waitforbutton(BadUsbScript* bad_usb, const char* line, int32_t param) {
     UNUSED(param);
     UNUSED(bad_usb);
@@ -213,13 +226,14 @@ static const DuckyCmd ducky_commands[] = {
     {"WAIT_FOR_BUTTON_PRESS", ducky_fnc_waitforbutton, -1},
     {"MEDIA", ducky_fnc_media, -1},
     {"GLOBE", ducky_fnc_globe, -1},
+    {"KEY_ROLLOVER", ducky_fnc_rollover, -1},
 };
 
 #define TAG "BadUsb"
 
 #define WORKER_TAG TAG "Worker"
 
-int32_t ducky_execute_cmd(BadUsbScript* bad_usb, const char* line) {
+int32_t ducky_get_command_index(const char* line) {
     size_t cmd_word_len = strcspn(line, " ");
     for(size_t i = 0; i < COUNT_OF(ducky_commands); i++) {
         size_t cmd_compare_len = strlen(ducky_commands[i].name);
@@ -229,13 +243,20 @@ int32_t ducky_execute_cmd(BadUsbScript* bad_usb, const char* line) {
         }
 
         if(strncmp(line, ducky_commands[i].name, cmd_compare_len) == 0) {
-            if(ducky_commands[i].callback == NULL) {
-                return 0;
-            } else {
-                return (ducky_commands[i].callback)(bad_usb, line, ducky_commands[i].param);
-            }
+            return i;
         }
     }
 
     return SCRIPT_STATE_CMD_UNKNOWN;
 }
+
+int32_t ducky_execute_cmd(BadUsbScript* bad_usb, const char* line, int32_t cmd_index) {
+    furi_check(cmd_index >= 0 && (size_t)cmd_index < COUNT_OF(ducky_commands));
+    const DuckyCmd* cmd = &ducky_commands[cmd_index];
+
+    if(cmd->callback == NULL) {
+        return 0;
+    } else {
+        return (cmd->callback)(bad_usb, line, cmd->param);
+    }
+}
@@ -16,7 +16,22 @@ extern "C" {
 #define SCRIPT_STATE_STRING_START (-5)
 #define SCRIPT_STATE_WAIT_FOR_BTN (-6)
 
-#define FILE_BUFFER_LEN 16
+#define FILE_BUFFER_LEN 512
+
+typedef enum {
+    DuckyActionNone, /**< Empty line */
+    DuckyActionCommand, /**< Ducky command, arguments are parsed on execution */
+    DuckyActionKey, /**< Key combination */
+} DuckyActionType;
+
+/** Script line resolved once, so REPEAT does not look it up again */
+typedef struct {
+    DuckyActionType type;
+    union {
+        int32_t cmd_index;
+        uint16_t key;
+    };
+} DuckyAction;
 
 struct BadUsbScript {
     FuriHalUsbHidConfig hid_cfg;
@@ -27,8 +42,8 @@ struct BadUsbScript {
 
     FuriString* file_path;
     uint8_t file_buf[FILE_BUFFER_LEN + 1];
-    uint8_t buf_start;
-    uint8_t buf_len;
+    uint16_t buf_start;
+    uint16_t buf_len;
     bool file_end;
 
     uint32_t defdelay;
@@ -38,8 +53,11 @@ struct BadUsbScript {
 
     FuriString* line;
     FuriString* line_prev;
+    DuckyAction action;
+    DuckyAction action_prev;
     uint32_t repeat_cnt;
     uint8_t key_hold_nb;
+    uint8_t key_rollover;
 
     FuriString* string_print;
     size_t string_print_pos;
@@ -67,7 +85,9 @@ bool ducky_altstring(BadUsbScript* bad_usb, const char* param);
 
 bool ducky_string(BadUsbScript* bad_usb, const char* param);
 
-int32_t ducky_execute_cmd(BadUsbScript* bad_usb, const char* line);
+int32_t ducky_get_command_index(const char* line);
+
+int32_t ducky_execute_cmd(BadUsbScript* bad_usb, const char* line, int32_t cmd_index);
 
 int32_t ducky_error(BadUsbScript* bad_usb, const char* text, ...);
 
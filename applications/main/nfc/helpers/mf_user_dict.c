@@ -23,11 +23,9 @@ MfUserDict* mf_user_dict_alloc(size_t max_keys_to_load) {
 
     if(instance->keys_num > 0) {
         instance->keys_arr = malloc(instance->keys_num * sizeof(MfClassicKey));
-        for(size_t i = 0; i < instance->keys_num; i++) {
-            bool key_loaded =
-                keys_dict_get_next_key(dict, instance->keys_arr[i].data, sizeof(MfClassicKey));
-            furi_assert(key_loaded);
-        }
+        // Lines of key length that are not hex are counted in total, but never loaded
+        instance->keys_num = keys_dict_get_next_keys(
+            dict, (uint8_t*)instance->keys_arr, sizeof(MfClassicKey), instance->keys_num);
     }
     keys_dict_free(dict);
 
@@ -37,9 +35,7 @@ MfUserDict* mf_user_dict_alloc(size_t max_keys_to_load) {
 void mf_user_dict_free(MfUserDict* instance) {
     furi_assert(instance);
 
-    if(instance->keys_num > 0) {
-        free(instance->keys_arr);
-    }
+    free(instance->keys_arr);
     free(instance);
 }
 
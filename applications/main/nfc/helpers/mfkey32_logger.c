@@ -1,13 +1,35 @@
 #include "mfkey32_logger.h"
+#include "mf_classic_key_cache.h"
 
 #include <m-array.h>
 
 #include <bit_lib/bit_lib.h>
+#include <nfc/helpers/mfkey32.h>
+#include <toolbox/keys_dict.h>
 #include <stream/stream.h>
 #include <stream/buffered_file_stream.h>
 
+#define TAG "Mfkey32Logger"
+
+#define NFC_APP_FOLDER                    EXT_PATH("nfc")
+#define NFC_APP_MF_CLASSIC_DICT_USER_PATH (NFC_APP_FOLDER "/assets/mf_classic_dict_user.nfc")
+
 #define MFKEY32_LOGGER_MAX_NONCES_SAVED (100)
 
+#define MFKEY32_LOGGER_WORKER_STACK_SIZE (4 * 1024)
+/* Larger lists take fewer passes, but emulation and GUI must keep running meanwhile */
+#define MFKEY32_LOGGER_MEMORY_MAX   (64 * 1024)
+#define MFKEY32_LOGGER_MEMORY_MIN   (32 * 1024)
+#define MFKEY32_LOGGER_HEAP_RESERVE (16 * 1024)
+/* Retry period when there is not enough memory to start recovery */
+#define MFKEY32_LOGGER_MEMORY_RETRY_MS (1000)
+
+typedef enum {
+    Mfkey32LoggerKeyStateUnknown,
+    Mfkey32LoggerKeyStateFound,
+    Mfkey32LoggerKeyStateNotFound,
+} Mfkey32LoggerKeyState;
+
 typedef struct {
     bool is_filled;
     uint32_t cuid;
@@ -19,21 +41,178 @@ typedef struct {
     uint32_t nt1;
     uint32_t nr1;
     uint32_t ar1;
+    Mfkey32LoggerKeyState key_state;
+    MfClassicKey key;
 } Mfkey32LoggerParams;
 
 ARRAY_DEF(Mfkey32LoggerParams, Mfkey32LoggerParams, M_POD_OPLIST);
 
+typedef enum {
+    Mfkey32LoggerFlagUpdate = (1 << 0),
+    Mfkey32LoggerFlagStop = (1 << 1),
+} Mfkey32LoggerFlag;
+
+#define MFKEY32_LOGGER_FLAGS_ALL (Mfkey32LoggerFlagUpdate | Mfkey32LoggerFlagStop)
+
 struct Mfkey32Logger {
     uint32_t cuid;
     Mfkey32LoggerParams_t params_arr;
+    /* Index + 1 of params waiting for the second nonce, 0 if none */
+    uint8_t params_pending[MF_CLASSIC_TOTAL_SECTORS_MAX][MfClassicKeyTypeB + 1];
     size_t nonces_saves;
     size_t params_collected;
+    size_t keys_recovered;
+    Mfkey32LoggerCallback callback;
+    void* context;
+    /* Guards all fields above, params are filled by listener and updated by recovery thread */
+    FuriMutex* mutex;
+
+    /* Used by recovery thread only */
+    MfClassicData* card_data;
+    MfClassicKeyCache* key_cache;
+
+    FuriThread* thread;
+    volatile bool stop;
 };
 
-Mfkey32Logger* mfkey32_logger_alloc(uint32_t cuid) {
+static bool mfkey32_logger_is_stopped(void* context) {
+    Mfkey32Logger* instance = context;
+    return instance->stop;
+}
+
+static Mfkey32* mfkey32_logger_alloc_recovery(void) {
+    size_t max_free_block = memmgr_heap_get_max_free_block();
+    if(max_free_block < MFKEY32_LOGGER_MEMORY_MIN + MFKEY32_LOGGER_HEAP_RESERVE) {
+        return NULL;
+    }
+
+    size_t memory_size =
+        MIN(max_free_block - MFKEY32_LOGGER_HEAP_RESERVE, (size_t)MFKEY32_LOGGER_MEMORY_MAX);
+    FURI_LOG_D(TAG, "Recovery memory: %zu", memory_size);
+    return mfkey32_alloc(memory_size);
+}
+
+/* Find filled params recovery wasn't run for */
+static bool
+    mfkey32_logger_get_next_pair(Mfkey32Logger* instance, size_t* index, Mfkey32Nonces* nonces) {
+    bool pair_found = false;
+
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    for(size_t i = 0; i < Mfkey32LoggerParams_size(instance->params_arr); i++) {
+        const Mfkey32LoggerParams* params = Mfkey32LoggerParams_cget(instance->params_arr, i);
+        if(!params->is_filled || (params->key_state != Mfkey32LoggerKeyStateUnknown)) continue;
+
+        *index = i;
+        *nonces = (Mfkey32Nonces){
+            .cuid = params->cuid,
+            .nt0 = params->nt0,
+            .nr0 = params->nr0,
+            .ar0 = params->ar0,
+            .nt1 = params->nt1,
+            .nr1 = params->nr1,
+            .ar1 = params->ar1,
+        };
+        pair_found = true;
+        break;
+    }
+    furi_mutex_release(instance->mutex);
+
+    return pair_found;
+}
+
+static void mfkey32_logger_save_key(
+    Mfkey32Logger* instance,
+    uint8_t sector_num,
+    MfClassicKeyType key_type,
+    const MfClassicKey* key) {
+    KeysDict* dict = keys_dict_alloc(
+        NFC_APP_MF_CLASSIC_DICT_USER_PATH, KeysDictModeOpenAlways, sizeof(MfClassicKey));
+    if(!keys_dict_is_key_present(dict, key->data, sizeof(MfClassicKey))) {
+        keys_dict_add_key(dict, key->data, sizeof(MfClassicKey));
+    }
+    keys_dict_free(dict);
+
+    if(instance->card_data) {
+        uint64_t key_num = bit_lib_bytes_to_num_be(key->data, sizeof(MfClassicKey));
+        mf_classic_set_key_found(instance->card_data, sector_num, key_type, key_num);
+        mf_classic_key_cache_save(instance->key_cache, instance->card_data);
+    }
+}
+
+static int32_t mfkey32_logger_worker(void* context) {
+    Mfkey32Logger* instance = context;
+    uint32_t timeout = FuriWaitForever;
+
+    while(true) {
+        uint32_t flags =
+            furi_thread_flags_wait(MFKEY32_LOGGER_FLAGS_ALL, FuriFlagWaitAny, timeout);
+        if(!(flags & FuriFlagError) && (flags & Mfkey32LoggerFlagStop)) break;
+        timeout = FuriWaitForever;
+
+        Mfkey32* mfkey32 = NULL;
+        size_t index = 0;
+        Mfkey32Nonces nonces = {};
+        while(!instance->stop && mfkey32_logger_get_next_pair(instance, &index, &nonces)) {
+            if(!mfkey32) {
+                mfkey32 = mfkey32_logger_alloc_recovery();
+                if(!mfkey32) {
+                    timeout = MFKEY32_LOGGER_MEMORY_RETRY_MS;
+                    break;
+                }
+                mfkey32_set_cancel_callback(mfkey32, mfkey32_logger_is_stopped, instance);
+            }
+
+            uint64_t key_num = 0;
+            uint32_t start = furi_get_tick();
+            Mfkey32Error error = mfkey32_recover(mfkey32, &nonces, &key_num);
+            if(error == Mfkey32ErrorCancelled) break;
+            FURI_LOG_I(TAG, "Pair %zu: error %d in %lu ms", index, error, furi_get_tick() - start);
+
+            furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+            Mfkey32LoggerParams* params = Mfkey32LoggerParams_get(instance->params_arr, index);
+            if(error == Mfkey32ErrorNone) {
+                params->key_state = Mfkey32LoggerKeyStateFound;
+                bit_lib_num_to_bytes_be(key_num, sizeof(MfClassicKey), params->key.data);
+                instance->keys_recovered++;
+            } else {
+                params->key_state = Mfkey32LoggerKeyStateNotFound;
+            }
+            Mfkey32LoggerParams result = *params;
+            Mfkey32LoggerCallback callback = instance->callback;
+            void* callback_context = instance->context;
+            furi_mutex_release(instance->mutex);
+
+            if(result.key_state == Mfkey32LoggerKeyStateFound) {
+                mfkey32_logger_save_key(instance, result.sector_num, result.key_type, &result.key);
+            }
+            if(callback) {
+                callback(callback_context);
+            }
+        }
+
+        if(mfkey32) {
+            mfkey32_free(mfkey32);
+        }
+    }
+
+    return 0;
+}
+
+Mfkey32Logger* mfkey32_logger_alloc(uint32_t cuid, const MfClassicData* card_data) {
     Mfkey32Logger* instance = malloc(sizeof(Mfkey32Logger));
     instance->cuid = cuid;
     Mfkey32LoggerParams_init(instance->params_arr);
+    if(card_data) {
+        instance->card_data = mf_classic_alloc();
+        mf_classic_copy(instance->card_data, card_data);
+        instance->key_cache = mf_classic_key_cache_alloc();
+    }
+    instance->mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+
+    instance->thread = furi_thread_alloc_ex(
+        "Mfkey32Worker", MFKEY32_LOGGER_WORKER_STACK_SIZE, mfkey32_logger_worker, instance);
+    furi_thread_set_priority(instance->thread, FuriThreadPriorityLow);
+    furi_thread_start(instance->thread);
 
     return instance;
 }
@@ -42,60 +221,77 @@ void mfkey32_logger_free(Mfkey32Logger* instance) {
     furi_assert(instance);
     furi_assert(instance->params_arr);
 
+    instance->stop = true;
+    furi_thread_flags_set(furi_thread_get_id(instance->thread), Mfkey32LoggerFlagStop);
+    furi_thread_join(instance->thread);
+    furi_thread_free(instance->thread);
+
+    if(instance->card_data) {
+        mf_classic_key_cache_free(instance->key_cache);
+        mf_classic_free(instance->card_data);
+    }
+    furi_mutex_free(instance->mutex);
     Mfkey32LoggerParams_clear(instance->params_arr);
     free(instance);
 }
 
-static bool mfkey32_logger_add_nonce_to_existing_params(
+void mfkey32_logger_set_callback(
     Mfkey32Logger* instance,
-    MfClassicAuthContext* auth_context) {
-    bool nonce_added = false;
-    do {
-        if(Mfkey32LoggerParams_size(instance->params_arr) == 0) break;
-
-        Mfkey32LoggerParams_it_t it;
-        for(Mfkey32LoggerParams_it(it, instance->params_arr); !Mfkey32LoggerParams_end_p(it);
-            Mfkey32LoggerParams_next(it)) {
-            Mfkey32LoggerParams* params = Mfkey32LoggerParams_ref(it);
-            if(params->is_filled) continue;
-
-            uint8_t sector_num = mf_classic_get_sector_by_block(auth_context->block_num);
-            if(params->sector_num != sector_num) continue;
-            if(params->key_type != auth_context->key_type) continue;
-
-            params->nt1 = bit_lib_bytes_to_num_be(auth_context->nt.data, sizeof(MfClassicNt));
-            params->nr1 = bit_lib_bytes_to_num_be(auth_context->nr.data, sizeof(MfClassicNr));
-            params->ar1 = bit_lib_bytes_to_num_be(auth_context->ar.data, sizeof(MfClassicAr));
-            params->is_filled = true;
-
-            instance->params_collected++;
-            nonce_added = true;
-            break;
-        }
-
-    } while(false);
+    Mfkey32LoggerCallback callback,
+    void* context) {
+    furi_assert(instance);
 
-    return nonce_added;
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    instance->callback = callback;
+    instance->context = context;
+    furi_mutex_release(instance->mutex);
 }
 
 void mfkey32_logger_add_nonce(Mfkey32Logger* instance, MfClassicAuthContext* auth_context) {
     furi_assert(instance);
     furi_assert(auth_context);
 
-    bool nonce_added = mfkey32_logger_add_nonce_to_existing_params(instance, auth_context);
-    if(!nonce_added && (instance->nonces_saves < MFKEY32_LOGGER_MAX_NONCES_SAVED)) {
-        uint8_t sector_num = mf_classic_get_sector_by_block(auth_context->block_num);
+    uint8_t sector_num = mf_classic_get_sector_by_block(auth_context->block_num);
+    if((sector_num >= MF_CLASSIC_TOTAL_SECTORS_MAX) ||
+       (auth_context->key_type > MfClassicKeyTypeB)) {
+        return;
+    }
+
+    uint32_t nt = bit_lib_bytes_to_num_be(auth_context->nt.data, sizeof(MfClassicNt));
+    uint32_t nr = bit_lib_bytes_to_num_be(auth_context->nr.data, sizeof(MfClassicNr));
+    uint32_t ar = bit_lib_bytes_to_num_be(auth_context->ar.data, sizeof(MfClassicAr));
+    bool pair_filled = false;
+
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    uint8_t* pending = &instance->params_pending[sector_num][auth_context->key_type];
+    if(*pending) {
+        Mfkey32LoggerParams* params = Mfkey32LoggerParams_get(instance->params_arr, *pending - 1);
+        params->nt1 = nt;
+        params->nr1 = nr;
+        params->ar1 = ar;
+        params->is_filled = true;
+        *pending = 0;
+
+        instance->params_collected++;
+        pair_filled = true;
+    } else if(instance->nonces_saves < MFKEY32_LOGGER_MAX_NONCES_SAVED) {
         Mfkey32LoggerParams params = {
             .is_filled = false,
             .cuid = instance->cuid,
             .sector_num = sector_num,
             .key_type = auth_context->key_type,
-            .nt0 = bit_lib_bytes_to_num_be(auth_context->nt.data, sizeof(MfClassicNt)),
-            .nr0 = bit_lib_bytes_to_num_be(auth_context->nr.data, sizeof(MfClassicNr)),
-            .ar0 = bit_lib_bytes_to_num_be(auth_context->ar.data, sizeof(MfClassicAr)),
+            .nt0 = nt,
+            .nr0 = nr,
+            .ar0 = ar,
         };
         Mfkey32LoggerParams_push_back(instance->params_arr, params);
         instance->nonces_saves++;
+        *pending = Mfkey32LoggerParams_size(instance->params_arr);
+    }
+    furi_mutex_release(instance->mutex);
+
+    if(pair_filled) {
+        furi_thread_flags_set(furi_thread_get_id(instance->thread), Mfkey32LoggerFlagUpdate);
     }
 }
 
@@ -105,6 +301,12 @@ size_t mfkey32_logger_get_params_num(Mfkey32Logger* instance) {
     return instance->params_collected;
 }
 
+size_t mfkey32_logger_get_keys_num(Mfkey32Logger* instance) {
+    furi_assert(instance);
+
+    return instance->keys_recovered;
+}
+
 bool mfkey32_logger_save_params(Mfkey32Logger* instance, const char* path) {
     furi_assert(instance);
     furi_assert(path);
@@ -116,6 +318,7 @@ bool mfkey32_logger_save_params(Mfkey32Logger* instance, const char* path) {
     Stream* stream = buffered_file_stream_alloc(storage);
     FuriString* temp_str = furi_string_alloc();
 
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
     do {
         if(!buffered_file_stream_open(stream, path, FSAM_WRITE, FSOM_OPEN_APPEND)) break;
 
@@ -146,6 +349,7 @@ bool mfkey32_logger_save_params(Mfkey32Logger* instance, const char* path) {
 
         params_saved = true;
     } while(false);
+    furi_mutex_release(instance->mutex);
 
     furi_string_free(temp_str);
     buffered_file_stream_close(stream);
@@ -161,6 +365,7 @@ void mfkey32_logger_get_params_data(Mfkey32Logger* instance, FuriString* str) {
     furi_assert(instance->params_collected > 0);
 
     furi_string_reset(str);
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
     Mfkey32LoggerParams_it_t it;
     for(Mfkey32LoggerParams_it(it, instance->params_arr); !Mfkey32LoggerParams_end_p(it);
         Mfkey32LoggerParams_next(it)) {
@@ -168,6 +373,17 @@ void mfkey32_logger_get_params_data(Mfkey32Logger* instance, FuriString* str) {
         if(!params->is_filled) continue;
 
         char key_char = params->key_type == MfClassicKeyTypeA ? 'A' : 'B';
-        furi_string_cat_printf(str, "Sector %d, key %c\n", params->sector_num, key_char);
+        furi_string_cat_printf(str, "Sector %d, key %c: ", params->sector_num, key_char);
+        if(params->key_state == Mfkey32LoggerKeyStateFound) {
+            for(size_t i = 0; i < sizeof(MfClassicKey); i++) {
+                furi_string_cat_printf(str, "%02X", params->key.data[i]);
+            }
+        } else if(params->key_state == Mfkey32LoggerKeyStateNotFound) {
+            furi_string_cat_str(str, "not found");
+        } else {
+            furi_string_cat_str(str, "...");
+        }
+        furi_string_push_back(str, '\n');
     }
+    furi_mutex_release(instance->mutex);
 }
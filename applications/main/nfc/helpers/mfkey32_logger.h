@@ -8,14 +8,53 @@ extern "C" {
 
 typedef struct Mfkey32Logger Mfkey32Logger;
 
-Mfkey32Logger* mfkey32_logger_alloc(uint32_t cuid);
+/**
+ * Callback called from the recovery thread when a nonce pair is done with.
+ */
+typedef void (*Mfkey32LoggerCallback)(void* context);
 
+/**
+ * Allocate logger and start recovering keys of nonce pairs as they are collected.
+ * Recovered keys are added to the user dictionary. When card data is given,
+ * they are also saved to the key cache of the card.
+ *
+ * @cuid        card UID reported to the reader
+ * @card_data   data of the card being emulated, NULL for a generated card
+ * @return      logger instance
+ */
+Mfkey32Logger* mfkey32_logger_alloc(uint32_t cuid, const MfClassicData* card_data);
+
+/**
+ * Stop key recovery and free logger.
+ *
+ * @instance    logger instance
+ */
 void mfkey32_logger_free(Mfkey32Logger* instance);
 
+/**
+ * Set callback to track key recovery.
+ *
+ * @instance    logger instance
+ * @callback    callback, NULL to disable
+ * @context     context passed to the callback
+ */
+void mfkey32_logger_set_callback(
+    Mfkey32Logger* instance,
+    Mfkey32LoggerCallback callback,
+    void* context);
+
 void mfkey32_logger_add_nonce(Mfkey32Logger* instance, MfClassicAuthContext* auth_context);
 
 size_t mfkey32_logger_get_params_num(Mfkey32Logger* instance);
 
+/**
+ * Get number of nonce pairs keys were recovered from.
+ *
+ * @instance    logger instance
+ * @return      number of recovered keys
+ */
+size_t mfkey32_logger_get_keys_num(Mfkey32Logger* instance);
+
 bool mfkey32_logger_save_params(Mfkey32Logger* instance, const char* path);
 
 void mfkey32_logger_get_params_data(Mfkey32Logger* instance, FuriString* str);
@@ -59,6 +59,7 @@ NfcApp* nfc_app_alloc(void) {
     // Nfc device
     instance->nfc_device = nfc_device_alloc();
     nfc_device_set_loading_callback(instance->nfc_device, nfc_show_loading_popup, instance);
+    nfc_device_set_cache_path(instance->nfc_device, NFC_APP_CACHE_FOLDER);
 
     // Open GUI record
     instance->gui = furi_record_open(RECORD_GUI);
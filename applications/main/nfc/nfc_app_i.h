@@ -72,12 +72,16 @@
 #define NFC_APP_SHADOW_EXTENSION  ".shd"
 #define NFC_APP_FILENAME_PREFIX   "NFC"
 
+#define NFC_APP_CACHE_FOLDER (NFC_APP_FOLDER "/.cache")
+
 #define NFC_APP_MFKEY32_LOGS_FILE_NAME ".mfkey32.log"
 #define NFC_APP_MFKEY32_LOGS_FILE_PATH (NFC_APP_FOLDER "/" NFC_APP_MFKEY32_LOGS_FILE_NAME)
 
 #define NFC_APP_MF_CLASSIC_DICT_USER_PATH   (NFC_APP_FOLDER "/assets/mf_classic_dict_user.nfc")
 #define NFC_APP_MF_CLASSIC_DICT_SYSTEM_PATH (NFC_APP_FOLDER "/assets/mf_classic_dict.nfc")
 
+#define NFC_APP_MF_CLASSIC_DICT_BATCH_SIZE (32U)
+
 typedef enum {
     NfcRpcStateIdle,
     NfcRpcStateEmulating,
@@ -85,6 +89,9 @@ typedef enum {
 
 typedef struct {
     KeysDict* dict;
+    MfClassicKey dict_batch[NFC_APP_MF_CLASSIC_DICT_BATCH_SIZE];
+    size_t dict_batch_num;
+    size_t dict_batch_pos;
     uint8_t sectors_total;
     uint8_t sectors_read;
     uint8_t current_sector;
@@ -46,6 +46,7 @@ void nfc_scene_mf_classic_timer_callback(void* context) {
 void nfc_scene_mf_classic_detect_reader_on_enter(void* context) {
     NfcApp* instance = context;
 
+    bool card_generated = false;
     if(nfc_device_get_protocol(instance->nfc_device) == NfcProtocolInvalid) {
         Iso14443_3aData iso3_data = {
             .uid_len = 7,
@@ -62,13 +63,17 @@ void nfc_scene_mf_classic_detect_reader_on_enter(void* context) {
         nfc_device_set_data(instance->nfc_device, NfcProtocolMfClassic, mfc_data);
 
         mf_classic_free(mfc_data);
+        card_generated = true;
     }
 
     const Iso14443_3aData* iso3_data =
         nfc_device_get_data(instance->nfc_device, NfcProtocolIso14443_3a);
     uint32_t cuid = iso14443_3a_get_cuid(iso3_data);
 
-    instance->mfkey32_logger = mfkey32_logger_alloc(cuid);
+    // Key cache is only useful for a real card, not for a random UID
+    const MfClassicData* mfc_data =
+        nfc_device_get_data(instance->nfc_device, NfcProtocolMfClassic);
+    instance->mfkey32_logger = mfkey32_logger_alloc(cuid, card_generated ? NULL : mfc_data);
     instance->timer =
         furi_timer_alloc(nfc_scene_mf_classic_timer_callback, FuriTimerTypeOnce, instance);
 
@@ -10,6 +10,31 @@ typedef enum {
     DictAttackStateSystemDictInProgress,
 } DictAttackState;
 
+static bool nfc_scene_mf_classic_dict_attack_next_key(
+    NfcMfClassicDictAttackContext* dict_context,
+    MfClassicKey* key) {
+    // Keys are decoded in batches, the poller asks for them one at a time
+    if(dict_context->dict_batch_pos == dict_context->dict_batch_num) {
+        dict_context->dict_batch_num = keys_dict_get_next_keys(
+            dict_context->dict,
+            (uint8_t*)dict_context->dict_batch,
+            sizeof(MfClassicKey),
+            COUNT_OF(dict_context->dict_batch));
+        dict_context->dict_batch_pos = 0;
+    }
+
+    if(dict_context->dict_batch_pos == dict_context->dict_batch_num) return false;
+
+    *key = dict_context->dict_batch[dict_context->dict_batch_pos++];
+    return true;
+}
+
+static void nfc_scene_mf_classic_dict_attack_rewind(NfcMfClassicDictAttackContext* dict_context) {
+    keys_dict_rewind(dict_context->dict);
+    dict_context->dict_batch_num = 0;
+    dict_context->dict_batch_pos = 0;
+}
+
 NfcCommand nfc_dict_attack_worker_callback(NfcGenericEvent event, void* context) {
     furi_assert(context);
     furi_assert(event.event_data);
@@ -41,8 +66,7 @@ NfcCommand nfc_dict_attack_worker_callback(NfcGenericEvent event, void* context)
             instance->view_dispatcher, NfcCustomEventDictAttackDataUpdate);
     } else if(mfc_event->type == MfClassicPollerEventTypeRequestKey) {
         MfClassicKey key = {};
-        if(keys_dict_get_next_key(
-               instance->nfc_dict_context.dict, key.data, sizeof(MfClassicKey))) {
+        if(nfc_scene_mf_classic_dict_attack_next_key(&instance->nfc_dict_context, &key)) {
             mfc_event->data->key_request_data.key = key;
             mfc_event->data->key_request_data.key_provided = true;
             instance->nfc_dict_context.dict_keys_current++;
@@ -61,7 +85,7 @@ NfcCommand nfc_dict_attack_worker_callback(NfcGenericEvent event, void* context)
         view_dispatcher_send_custom_event(
             instance->view_dispatcher, NfcCustomEventDictAttackDataUpdate);
     } else if(mfc_event->type == MfClassicPollerEventTypeNextSector) {
-        keys_dict_rewind(instance->nfc_dict_context.dict);
+        nfc_scene_mf_classic_dict_attack_rewind(&instance->nfc_dict_context);
         instance->nfc_dict_context.dict_keys_current = 0;
         instance->nfc_dict_context.current_sector =
             mfc_event->data->next_sector_data.current_sector;
@@ -80,7 +104,7 @@ NfcCommand nfc_dict_attack_worker_callback(NfcGenericEvent event, void* context)
         view_dispatcher_send_custom_event(
             instance->view_dispatcher, NfcCustomEventDictAttackDataUpdate);
     } else if(mfc_event->type == MfClassicPollerEventTypeKeyAttackStop) {
-        keys_dict_rewind(instance->nfc_dict_context.dict);
+        nfc_scene_mf_classic_dict_attack_rewind(&instance->nfc_dict_context);
         instance->nfc_dict_context.is_key_attack = false;
         instance->nfc_dict_context.dict_keys_current = 0;
         view_dispatcher_send_custom_event(
@@ -152,6 +176,8 @@ static void nfc_scene_mf_classic_dict_attack_prepare_view(NfcApp* instance) {
     dict_attack_set_total_dict_keys(
         instance->dict_attack, instance->nfc_dict_context.dict_keys_total);
     instance->nfc_dict_context.dict_keys_current = 0;
+    instance->nfc_dict_context.dict_batch_num = 0;
+    instance->nfc_dict_context.dict_batch_pos = 0;
 
     dict_attack_set_callback(
         instance->dict_attack, nfc_dict_attack_dict_attack_result_callback, instance);
@@ -272,6 +298,8 @@ void nfc_scene_mf_classic_dict_attack_on_exit(void* context) {
     instance->nfc_dict_context.keys_found = 0;
     instance->nfc_dict_context.dict_keys_total = 0;
     instance->nfc_dict_context.dict_keys_current = 0;
+    instance->nfc_dict_context.dict_batch_num = 0;
+    instance->nfc_dict_context.dict_batch_pos = 0;
     instance->nfc_dict_context.is_key_attack = false;
     instance->nfc_dict_context.key_attack_current_sector = 0;
     instance->nfc_dict_context.is_card_present = false;
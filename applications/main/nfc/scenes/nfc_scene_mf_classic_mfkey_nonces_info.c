@@ -11,17 +11,32 @@ void nfc_scene_mf_classic_mfkey_nonces_info_callback(
     }
 }
 
-void nfc_scene_mf_classic_mfkey_nonces_info_on_enter(void* context) {
+static void nfc_scene_mf_classic_mfkey_nonces_info_logger_callback(void* context) {
     NfcApp* instance = context;
 
+    view_dispatcher_send_custom_event(instance->view_dispatcher, NfcCustomEventWorkerUpdate);
+}
+
+static void nfc_scene_mf_classic_mfkey_nonces_info_setup_widget(NfcApp* instance) {
     FuriString* temp_str = furi_string_alloc();
 
     size_t mfkey_params_saved = mfkey32_logger_get_params_num(instance->mfkey32_logger);
     furi_string_printf(temp_str, "Nonce pairs saved: %zu\n", mfkey_params_saved);
     widget_add_string_element(
         instance->widget, 0, 0, AlignLeft, AlignTop, FontPrimary, furi_string_get_cstr(temp_str));
+    furi_string_printf(
+        temp_str,
+        "Keys recovered: %zu/%zu",
+        mfkey32_logger_get_keys_num(instance->mfkey32_logger),
+        mfkey_params_saved);
     widget_add_string_element(
-        instance->widget, 0, 12, AlignLeft, AlignTop, FontSecondary, "Authenticated sectors:");
+        instance->widget,
+        0,
+        12,
+        AlignLeft,
+        AlignTop,
+        FontSecondary,
+        furi_string_get_cstr(temp_str));
 
     mfkey32_logger_get_params_data(instance->mfkey32_logger, temp_str);
     widget_add_text_scroll_element(
@@ -34,6 +49,17 @@ void nfc_scene_mf_classic_mfkey_nonces_info_on_enter(void* context) {
         instance);
 
     furi_string_free(temp_str);
+}
+
+void nfc_scene_mf_classic_mfkey_nonces_info_on_enter(void* context) {
+    NfcApp* instance = context;
+
+    nfc_scene_mf_classic_mfkey_nonces_info_setup_widget(instance);
+    // Keys keep being recovered in the background while the scene is shown
+    mfkey32_logger_set_callback(
+        instance->mfkey32_logger,
+        nfc_scene_mf_classic_mfkey_nonces_info_logger_callback,
+        instance);
 
     view_dispatcher_switch_to_view(instance->view_dispatcher, NfcViewWidget);
 }
@@ -52,6 +78,10 @@ bool nfc_scene_mf_classic_mfkey_nonces_info_on_event(void* context, SceneManager
                     instance->scene_manager, NfcSceneStart);
             }
             consumed = true;
+        } else if(event.event == NfcCustomEventWorkerUpdate) {
+            widget_reset(instance->widget);
+            nfc_scene_mf_classic_mfkey_nonces_info_setup_widget(instance);
+            consumed = true;
         }
     } else if(event.type == SceneManagerEventTypeBack) {
         const uint32_t prev_scenes[] = {NfcSceneSavedMenu, NfcSceneStart};
@@ -65,6 +95,7 @@ bool nfc_scene_mf_classic_mfkey_nonces_info_on_event(void* context, SceneManager
 void nfc_scene_mf_classic_mfkey_nonces_info_on_exit(void* context) {
     NfcApp* instance = context;
 
+    mfkey32_logger_set_callback(instance->mfkey32_logger, NULL, NULL);
     mfkey32_logger_free(instance->mfkey32_logger);
 
     // Clear view
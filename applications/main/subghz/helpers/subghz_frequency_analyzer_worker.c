@@ -8,6 +8,8 @@
 
 #define SUBGHZ_FREQUENCY_ANALYZER_THRESHOLD -97.0f
 
+#define SUBGHZ_FREQUENCY_ANALYZER_TEMPERATURE_UPDATE_MS 10000
+
 static const uint8_t subghz_preset_ook_58khz[][2] = {
     {CC1101_MDMCFG4, 0b11110111}, // Rx BW filter is 58.035714kHz
     /* End  */
@@ -35,10 +37,23 @@ struct SubGhzFrequencyAnalyzerWorker {
     float filVal;
     float trigger_level;
 
+    CC1101CalibrationCache calibration_cache;
+    FuriTimer* temperature_timer;
+
     SubGhzFrequencyAnalyzerWorkerPairCallback pair_callback;
     void* context;
 };
 
+static int8_t subghz_frequency_analyzer_worker_get_temperature(void) {
+    return (int8_t)furi_hal_power_get_battery_temperature(FuriHalPowerICFuelGauge);
+}
+
+static void subghz_frequency_analyzer_worker_temperature_timer_callback(void* context) {
+    SubGhzFrequencyAnalyzerWorker* instance = context;
+    cc1101_calibration_cache_set_temperature(
+        &instance->calibration_cache, subghz_frequency_analyzer_worker_get_temperature());
+}
+
 static void subghz_frequency_analyzer_worker_load_registers(
     FuriHalSpiBusHandle* spi_bus,
     const uint8_t data[][2]) {
@@ -138,9 +153,8 @@ static int32_t subghz_frequency_analyzer_worker_thread(void* context) {
                 cc1101_switch_to_idle(spi_bus);
                 frequency = cc1101_set_frequency(spi_bus, current_frequency);
 
-                cc1101_calibrate(spi_bus);
-
-                furi_check(cc1101_wait_status_state(spi_bus, CC1101StateIDLE, 10000));
+                furi_check(cc1101_calibrate_cached(
+                    spi_bus, &instance->calibration_cache, frequency));
 
                 cc1101_switch_to_rx(spi_bus);
                 furi_hal_spi_release(spi_bus);
@@ -185,9 +199,8 @@ static int32_t subghz_frequency_analyzer_worker_thread(void* context) {
                     cc1101_switch_to_idle(spi_bus);
                     frequency = cc1101_set_frequency(spi_bus, i);
 
-                    cc1101_calibrate(spi_bus);
-
-                    furi_check(cc1101_wait_status_state(spi_bus, CC1101StateIDLE, 10000));
+                    furi_check(cc1101_calibrate_cached(
+                        spi_bus, &instance->calibration_cache, frequency));
 
                     cc1101_switch_to_rx(spi_bus);
                     furi_hal_spi_release(spi_bus);
@@ -294,12 +307,19 @@ SubGhzFrequencyAnalyzerWorker* subghz_frequency_analyzer_worker_alloc(void* cont
     instance->setting = subghz_txrx_get_setting(subghz->txrx);
     instance->trigger_level = subghz->last_settings->frequency_analyzer_trigger;
     //instance->trigger_level = SUBGHZ_FREQUENCY_ANALYZER_THRESHOLD;
+    cc1101_calibration_cache_reset(
+        &instance->calibration_cache, subghz_frequency_analyzer_worker_get_temperature());
+    instance->temperature_timer = furi_timer_alloc(
+        subghz_frequency_analyzer_worker_temperature_timer_callback,
+        FuriTimerTypePeriodic,
+        instance);
     return instance;
 }
 
 void subghz_frequency_analyzer_worker_free(SubGhzFrequencyAnalyzerWorker* instance) {
     furi_assert(instance);
 
+    furi_timer_free(instance->temperature_timer);
     furi_thread_free(instance->thread);
     free(instance);
 }
@@ -339,6 +359,9 @@ void subghz_frequency_analyzer_worker_start(
 
     instance->worker_running = true;
 
+    furi_timer_start(
+        instance->temperature_timer,
+        furi_ms_to_ticks(SUBGHZ_FREQUENCY_ANALYZER_TEMPERATURE_UPDATE_MS));
     furi_thread_start(instance->thread);
 }
 
@@ -349,6 +372,7 @@ void subghz_frequency_analyzer_worker_stop(SubGhzFrequencyAnalyzerWorker* instan
     instance->worker_running = false;
 
     furi_thread_join(instance->thread);
+    furi_timer_stop(instance->temperature_timer);
 }
 
 bool subghz_frequency_analyzer_worker_is_running(SubGhzFrequencyAnalyzerWorker* instance) {
@@ -0,0 +1,278 @@
+#include "animation_frame_stream.h"
+
+#include <furi.h>
+#include <storage/storage.h>
+
+#define TAG "AnimationFrameStream"
+
+#define ANIMATION_FRAME_STREAM_STACK_SIZE 2048
+
+typedef enum {
+    AnimationFrameStreamFlagUpdate = (1 << 0),
+    AnimationFrameStreamFlagStop = (1 << 1),
+} AnimationFrameStreamFlag;
+
+#define ANIMATION_FRAME_STREAM_FLAGS_ALL \
+    (AnimationFrameStreamFlagUpdate | AnimationFrameStreamFlagStop)
+
+#define ANIMATION_FRAME_STREAM_SLOT_FREE (-1)
+
+struct AnimationFrameStream {
+    const BubbleAnimation* animation;
+    const uint8_t** frames;
+    FuriString* path;
+    size_t frame_size;
+    uint8_t* slots[ANIMATION_FRAME_STREAM_SLOTS];
+    int16_t slot_frames[ANIMATION_FRAME_STREAM_SLOTS];
+    FuriThread* thread;
+    volatile bool stop;
+    /* Guards frames table and fields below */
+    FuriMutex* mutex;
+    uint8_t position;
+    uint8_t last_frame;
+    uint32_t misses;
+};
+
+static uint8_t
+    animation_frame_stream_next_position(const BubbleAnimation* animation, uint8_t position) {
+    if(position < animation->passive_frames) {
+        return (position + 1) % animation->passive_frames;
+    } else {
+        return animation->passive_frames +
+               (position - animation->passive_frames + 1) % animation->active_frames;
+    }
+}
+
+static void animation_frame_stream_want(uint8_t* wanted, size_t* count, uint8_t frame) {
+    for(size_t i = 0; i < *count; ++i) {
+        if(wanted[i] == frame) return;
+    }
+    if(*count < ANIMATION_FRAME_STREAM_SLOTS) {
+        wanted[(*count)++] = frame;
+    }
+}
+
+/* Frames to keep in memory, most important first */
+static size_t animation_frame_stream_get_wanted(AnimationFrameStream* stream, uint8_t* wanted) {
+    const BubbleAnimation* animation = stream->animation;
+    size_t count = 0;
+
+    /* Frame on screen, frame used on freeze, and frames phases start from */
+    animation_frame_stream_want(wanted, &count, stream->last_frame);
+    animation_frame_stream_want(wanted, &count, 0);
+    animation_frame_stream_want(wanted, &count, animation->frame_order[0]);
+    if(animation->active_frames) {
+        animation_frame_stream_want(
+            wanted, &count, animation->frame_order[animation->passive_frames]);
+    }
+
+    uint8_t position = stream->position;
+    uint16_t order_count = animation->passive_frames + animation->active_frames;
+    for(uint16_t i = 0; (i < order_count) && (count < ANIMATION_FRAME_STREAM_SLOTS); ++i) {
+        animation_frame_stream_want(wanted, &count, animation->frame_order[position]);
+        position = animation_frame_stream_next_position(animation, position);
+    }
+
+    return count;
+}
+
+static bool animation_frame_stream_read_frame(
+    AnimationFrameStream* stream,
+    File* file,
+    FuriString* filename,
+    uint8_t frame,
+    uint8_t* buffer) {
+    furi_string_printf(filename, "%s/frame_%d.bm", furi_string_get_cstr(stream->path), frame);
+
+    bool success = false;
+    if(storage_file_open(file, furi_string_get_cstr(filename), FSAM_READ, FSOM_OPEN_EXISTING)) {
+        uint64_t size = storage_file_size(file);
+        success = (size <= stream->frame_size) &&
+                  (storage_file_read(file, buffer, size) == size);
+    }
+    storage_file_close(file);
+
+    if(!success) {
+        FURI_LOG_E(TAG, "Can't load \'%s\'", furi_string_get_cstr(filename));
+    }
+
+    return success;
+}
+
+static void
+    animation_frame_stream_update(AnimationFrameStream* stream, File* file, FuriString* filename) {
+    uint8_t wanted[ANIMATION_FRAME_STREAM_SLOTS];
+
+    /* Evict frames which are not going to be shown soon */
+    furi_check(furi_mutex_acquire(stream->mutex, FuriWaitForever) == FuriStatusOk);
+    size_t count = animation_frame_stream_get_wanted(stream, wanted);
+    for(size_t slot = 0; slot < ANIMATION_FRAME_STREAM_SLOTS; ++slot) {
+        int16_t frame = stream->slot_frames[slot];
+        if(frame == ANIMATION_FRAME_STREAM_SLOT_FREE) continue;
+
+        bool keep = false;
+        for(size_t i = 0; i < count; ++i) {
+            keep |= (wanted[i] == frame);
+        }
+        if(!keep) {
+            stream->frames[frame] = NULL;
+            stream->slot_frames[slot] = ANIMATION_FRAME_STREAM_SLOT_FREE;
+        }
+    }
+    furi_mutex_release(stream->mutex);
+
+    /* Only this function changes the frames table, no need to lock for reading it */
+    for(size_t i = 0; i < count; ++i) {
+        if(stream->frames[wanted[i]]) continue;
+        if(stream->stop) break;
+
+        size_t slot = 0;
+        while(stream->slot_frames[slot] != ANIMATION_FRAME_STREAM_SLOT_FREE) {
+            ++slot;
+        }
+        furi_check(slot < ANIMATION_FRAME_STREAM_SLOTS);
+
+        /* Free slot is not referenced by the frames table, fill it unlocked */
+        uint8_t* buffer = stream->slots[slot];
+        if(!animation_frame_stream_read_frame(stream, file, filename, wanted[i], buffer)) continue;
+
+        furi_check(furi_mutex_acquire(stream->mutex, FuriWaitForever) == FuriStatusOk);
+        stream->slot_frames[slot] = wanted[i];
+        stream->frames[wanted[i]] = buffer;
+        furi_mutex_release(stream->mutex);
+    }
+}
+
+static int32_t animation_frame_stream_worker(void* context) {
+    AnimationFrameStream* stream = context;
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    FuriString* filename = furi_string_alloc();
+
+    while(true) {
+        uint32_t flags = furi_thread_flags_wait(
+            ANIMATION_FRAME_STREAM_FLAGS_ALL, FuriFlagWaitAny, FuriWaitForever);
+        furi_check(!(flags & FuriFlagError));
+        if(flags & AnimationFrameStreamFlagStop) break;
+
+        animation_frame_stream_update(stream, file, filename);
+    }
+
+    furi_string_free(filename);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    return 0;
+}
+
+AnimationFrameStream* animation_frame_stream_alloc(BubbleAnimation* animation, const char* path) {
+    furi_assert(animation);
+    furi_assert(path);
+
+    const Icon* icon = &animation->icon_animation;
+    AnimationFrameStream* stream = malloc(sizeof(AnimationFrameStream));
+    stream->animation = animation;
+    stream->frames = (const uint8_t**)icon->frames;
+    stream->path = furi_string_alloc_set(path);
+    /* Compressed bitmap is never larger than uncompressed one plus header */
+    stream->frame_size = ROUND_UP_TO(icon->width, 8) * icon->height + 1;
+    for(size_t slot = 0; slot < ANIMATION_FRAME_STREAM_SLOTS; ++slot) {
+        stream->slots[slot] = malloc(stream->frame_size);
+        stream->slot_frames[slot] = ANIMATION_FRAME_STREAM_SLOT_FREE;
+    }
+    stream->thread = NULL;
+    stream->stop = false;
+    stream->mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+    stream->position = 0;
+    stream->last_frame = animation->frame_order[0];
+    stream->misses = 0;
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    FuriString* filename = furi_string_alloc();
+    FileInfo file_info;
+
+    /* Check every frame up front, so a broken animation is rejected right away */
+    bool success = true;
+    for(int i = 0; i < icon->frame_count; ++i) {
+        furi_string_printf(filename, "%s/frame_%d.bm", path, i);
+        if(storage_common_stat(storage, furi_string_get_cstr(filename), &file_info) != FSE_OK ||
+           file_info.size > stream->frame_size) {
+            FURI_LOG_E(TAG, "Bad frame \'%s\'", furi_string_get_cstr(filename));
+            success = false;
+            break;
+        }
+    }
+
+    if(success) {
+        animation_frame_stream_update(stream, file, filename);
+        success = stream->frames[0] && stream->frames[stream->last_frame];
+    }
+
+    furi_string_free(filename);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    if(!success) {
+        animation_frame_stream_free(stream);
+        return NULL;
+    }
+
+    stream->thread = furi_thread_alloc_ex(
+        "AnimFrameStream",
+        ANIMATION_FRAME_STREAM_STACK_SIZE,
+        animation_frame_stream_worker,
+        stream);
+    furi_thread_start(stream->thread);
+
+    return stream;
+}
+
+void animation_frame_stream_free(AnimationFrameStream* stream) {
+    furi_assert(stream);
+
+    if(stream->thread) {
+        stream->stop = true;
+        furi_thread_flags_set(furi_thread_get_id(stream->thread), AnimationFrameStreamFlagStop);
+        furi_thread_join(stream->thread);
+        furi_thread_free(stream->thread);
+        FURI_LOG_D(TAG, "Frames not ready in time: %lu", stream->misses);
+    }
+
+    for(size_t slot = 0; slot < ANIMATION_FRAME_STREAM_SLOTS; ++slot) {
+        if(stream->slot_frames[slot] != ANIMATION_FRAME_STREAM_SLOT_FREE) {
+            stream->frames[stream->slot_frames[slot]] = NULL;
+        }
+        free(stream->slots[slot]);
+    }
+
+    furi_mutex_free(stream->mutex);
+    furi_string_free(stream->path);
+    free(stream);
+}
+
+const uint8_t* animation_frame_stream_acquire(AnimationFrameStream* stream, uint8_t position) {
+    furi_assert(stream);
+
+    furi_check(furi_mutex_acquire(stream->mutex, FuriWaitForever) == FuriStatusOk);
+
+    uint8_t frame = stream->animation->frame_order[position];
+    if(stream->frames[frame]) {
+        stream->last_frame = frame;
+    } else {
+        stream->misses++;
+    }
+
+    if(stream->position != position) {
+        stream->position = position;
+        furi_thread_flags_set(furi_thread_get_id(stream->thread), AnimationFrameStreamFlagUpdate);
+    }
+
+    return stream->frames[stream->last_frame];
+}
+
+void animation_frame_stream_release(AnimationFrameStream* stream) {
+    furi_assert(stream);
+
+    furi_mutex_release(stream->mutex);
+}
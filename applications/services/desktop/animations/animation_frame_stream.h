@@ -0,0 +1,51 @@
+#pragma once
+#include <stdint.h>
+#include "animation_manager.h"
+
+/** Maximum number of frames kept in memory by a frame stream */
+#define ANIMATION_FRAME_STREAM_SLOTS 8
+
+/**
+ * Streams frames of an external animation from the SD-card.
+ * Only a window of frames around the current playback position is kept in
+ * memory, the following frames are prefetched by a worker thread. Frames are
+ * cached by frame index, so frames repeated in the frame order are loaded once.
+ * First frame, and first frames of passive and active phases are always kept.
+ */
+typedef struct AnimationFrameStream AnimationFrameStream;
+
+/**
+ * Allocate frame stream and load frames needed to start playback.
+ * Frame order, phases and frames table of animation must be initialized,
+ * frames table is filled by the stream, frames not in memory are NULL.
+ *
+ * @animation   animation to stream frames of
+ * @path        animation directory with frame files
+ * @return      frame stream, NULL if frames can't be loaded
+ */
+AnimationFrameStream* animation_frame_stream_alloc(BubbleAnimation* animation, const char* path);
+
+/**
+ * Stop prefetching and free frame stream together with loaded frames.
+ *
+ * @stream      frame stream instance
+ */
+void animation_frame_stream_free(AnimationFrameStream* stream);
+
+/**
+ * Get frame to draw at the position in frame order and prefetch following
+ * frames. Returns previously drawn frame if requested one is not loaded yet.
+ * Frame stays valid until animation_frame_stream_release() is called.
+ *
+ * @stream      frame stream instance
+ * @position    position in frame order
+ * @return      frame bitmap
+ */
+const uint8_t* animation_frame_stream_acquire(AnimationFrameStream* stream, uint8_t position);
+
+/**
+ * Release frame acquired with animation_frame_stream_acquire().
+ *
+ * @stream      frame stream instance
+ */
+void animation_frame_stream_release(AnimationFrameStream* stream);
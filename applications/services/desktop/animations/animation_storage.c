@@ -8,6 +8,7 @@
 
 #include "animation_manager.h"
 #include "animation_storage.h"
+#include "animation_frame_stream.h"
 #include <assets_dolphin_internal.h>
 #include <assets_dolphin_blocking.h>
 
@@ -248,14 +249,20 @@ static bool animation_storage_cast_align(FuriString* align_str, Align* align) {
 static void animation_storage_free_frames(BubbleAnimation* animation) {
     furi_assert(animation);
 
-    const Icon* icon = &animation->icon_animation;
-    for(int i = 0; i < icon->frame_count; ++i) {
-        if(icon->frames[i]) {
-            free((void*)icon->frames[i]);
+    Icon* icon = (Icon*)&animation->icon_animation;
+    if(animation->frame_stream) {
+        animation_frame_stream_free(animation->frame_stream);
+        animation->frame_stream = NULL;
+    } else {
+        for(int i = 0; i < icon->frame_count; ++i) {
+            if(icon->frames[i]) {
+                free((void*)icon->frames[i]);
+            }
         }
     }
 
     free((void*)icon->frames);
+    icon->frames = NULL;
 }
 
 static bool animation_storage_load_frames(
@@ -284,6 +291,21 @@ static bool animation_storage_load_frames(
     FURI_CONST_ASSIGN(icon->width, width);
     icon->frames = malloc(sizeof(const uint8_t*) * icon->frame_count);
 
+    /* Long animations are not loaded at once, heap use is bounded by the stream */
+    if(icon->frame_count > ANIMATION_FRAME_STREAM_SLOTS) {
+        FuriString* path = furi_string_alloc_printf(ANIMATION_DIR "/%s", name);
+        animation->frame_stream =
+            animation_frame_stream_alloc(animation, furi_string_get_cstr(path));
+        furi_string_free(path);
+
+        if(!animation->frame_stream) {
+            FURI_LOG_E(TAG, "Load \'%s\' failed, %ux%u", name, width, height);
+            animation_storage_free_frames(animation);
+            return false;
+        }
+        return true;
+    }
+
     bool frames_ok = false;
     File* file = storage_file_alloc(storage);
     FileInfo file_info;
@@ -425,6 +447,8 @@ static bool animation_storage_load_bubbles(BubbleAnimation* animation, FlipperFo
 
 static BubbleAnimation* animation_storage_load_animation(const char* name) {
     furi_assert(name);
+    uint32_t start_tick = furi_get_tick();
+    size_t free_heap = memmgr_get_free_heap();
     BubbleAnimation* animation = malloc(sizeof(BubbleAnimation));
 
     uint32_t height = 0;
@@ -495,11 +519,23 @@ static BubbleAnimation* animation_storage_load_animation(const char* name) {
     }
 
     if(!success) { //-V547
+        /* Frame stream must be stopped before animation is gone */
+        if(animation->icon_animation.frames) {
+            animation_storage_free_frames(animation);
+        }
         if(animation->frame_order) {
             free((void*)animation->frame_order);
         }
         free(animation);
         animation = NULL;
+    } else {
+        FURI_LOG_I(
+            TAG,
+            "Loaded \'%s\' in %lu ms, %zu bytes of heap%s",
+            name,
+            furi_get_tick() - start_tick,
+            free_heap - memmgr_get_free_heap(),
+            animation->frame_stream ? ", streaming frames" : "");
     }
 
     return animation;
@@ -1,5 +1,6 @@
 
 #include "../animation_manager.h"
+#include "../animation_frame_stream.h"
 #include "bubble_animation_view.h"
 
 #include <furi_hal.h>
@@ -36,7 +37,8 @@ struct BubbleAnimationView {
 static void bubble_animation_activate(BubbleAnimationView* view, bool force);
 static void bubble_animation_activate_right_now(BubbleAnimationView* view);
 
-static uint8_t bubble_animation_get_frame_index(BubbleAnimationViewModel* model) {
+/* Position in frame order */
+static uint8_t bubble_animation_get_frame_position(BubbleAnimationViewModel* model) {
     furi_assert(model);
     uint8_t icon_index = 0;
     const BubbleAnimation* animation = model->current;
@@ -50,7 +52,7 @@ static uint8_t bubble_animation_get_frame_index(BubbleAnimationViewModel* model)
     }
     furi_assert(icon_index < (animation->passive_frames + animation->active_frames));
 
-    return animation->frame_order[icon_index];
+    return icon_index;
 }
 
 static void bubble_animation_draw_callback(Canvas* canvas, void* model_) {
@@ -72,12 +74,19 @@ static void bubble_animation_draw_callback(Canvas* canvas, void* model_) {
 
     furi_assert(model->current_frame < 255);
 
-    uint8_t index = bubble_animation_get_frame_index(model);
+    uint8_t position = bubble_animation_get_frame_position(model);
     uint8_t width = icon_get_width(&animation->icon_animation);
     uint8_t height = icon_get_height(&animation->icon_animation);
     uint8_t y_offset = canvas_height(canvas) - height;
-    canvas_draw_bitmap(
-        canvas, 0, y_offset, width, height, animation->icon_animation.frames[index]);
+    if(animation->frame_stream) {
+        const uint8_t* frame = animation_frame_stream_acquire(animation->frame_stream, position);
+        canvas_draw_bitmap(canvas, 0, y_offset, width, height, frame);
+        animation_frame_stream_release(animation->frame_stream);
+    } else {
+        uint8_t index = animation->frame_order[position];
+        canvas_draw_bitmap(
+            canvas, 0, y_offset, width, height, animation->icon_animation.frames[index]);
+    }
 
     const FrameBubble* bubble = model->current_bubble;
     if(bubble) {
@@ -5,7 +5,8 @@
 #include <rpc/rpc_i.h>
 #include <storage/filesystem_api_defines.h>
 #include <storage/storage.h>
-#include <lib/toolbox/md5_calc.h>
+#include <lib/toolbox/md5_cache.h>
+#include <lib/toolbox/file_read_pipeline.h>
 #include <lib/toolbox/path.h>
 #include <update_util/int_backup.h>
 #include <toolbox/tar/tar_archive.h>
@@ -19,6 +20,8 @@
 #define MAX_NAME_LENGTH 255
 
 static const size_t MAX_DATA_SIZE = 512;
+/* Storage is accessed in blocks this large, and split into MAX_DATA_SIZE frames */
+static const size_t STORAGE_BLOCK_SIZE = FILE_READ_PIPELINE_BLOCK_SIZE;
 
 typedef enum {
     RpcStorageStateIdle = 0,
@@ -29,10 +32,26 @@ typedef struct {
     RpcSession* session;
     Storage* api;
     File* file;
+    uint8_t* write_buffer;
+    size_t write_buffer_used;
+    Md5Cache* md5_cache;
     RpcStorageState state;
     uint32_t current_command_id;
 } RpcStorageSystem;
 
+static bool rpc_system_storage_write_flush(RpcStorageSystem* rpc_storage) {
+    bool success = true;
+
+    if(rpc_storage->write_buffer_used) {
+        size_t written_size = storage_file_write(
+            rpc_storage->file, rpc_storage->write_buffer, rpc_storage->write_buffer_used);
+        success = (written_size == rpc_storage->write_buffer_used);
+        rpc_storage->write_buffer_used = 0;
+    }
+
+    return success;
+}
+
 static void rpc_system_storage_reset_state(
     RpcStorageSystem* rpc_storage,
     RpcSession* session,
@@ -49,8 +68,11 @@ static void rpc_system_storage_reset_state(
         }
 
         if(rpc_storage->state == RpcStorageStateWriting) {
+            rpc_system_storage_write_flush(rpc_storage);
             storage_file_close(rpc_storage->file);
             storage_file_free(rpc_storage->file);
+            free(rpc_storage->write_buffer);
+            rpc_storage->write_buffer = NULL;
         }
 
         rpc_storage->state = RpcStorageStateIdle;
@@ -313,7 +335,12 @@ static void rpc_system_storage_list_process(const PB_Main* request, void* contex
                 if(include_md5 && !file_info_is_dir(&fileinfo)) {
                     furi_string_printf(md5_path, "%s/%s", list_request->path, name); //-V576
 
-                    if(md5_string_calc_file(file, furi_string_get_cstr(md5_path), md5, NULL)) {
+                    if(md5_cache_string_calc_file(
+                           rpc_storage->md5_cache,
+                           file,
+                           furi_string_get_cstr(md5_path),
+                           md5,
+                           NULL)) {
                         char* md5sum = list->file[i].md5sum;
                         size_t md5sum_size = sizeof(list->file[i].md5sum);
                         snprintf(md5sum, md5sum_size, "%s", furi_string_get_cstr(md5));
@@ -341,6 +368,33 @@ static void rpc_system_storage_list_process(const PB_Main* request, void* contex
     storage_file_free(file);
 }
 
+typedef struct {
+    RpcSession* session;
+    PB_Main* response;
+    size_t size_left;
+} RpcStorageReadContext;
+
+static bool rpc_system_storage_read_block(const uint8_t* data, size_t size, void* context) {
+    RpcStorageReadContext* read_context = context;
+    PB_Main* response = read_context->response;
+    pb_bytes_array_t* frame = response->content.storage_read_response.file.data;
+
+    if(size > read_context->size_left) return false;
+
+    while(size) {
+        frame->size = MIN(size, MAX_DATA_SIZE);
+        memcpy(frame->bytes, data, frame->size);
+        data += frame->size;
+        size -= frame->size;
+        read_context->size_left -= frame->size;
+
+        response->has_next = (read_context->size_left > 0);
+        rpc_send(read_context->session, response);
+    }
+
+    return true;
+}
+
 static void rpc_system_storage_read_process(const PB_Main* request, void* context) {
     furi_assert(request);
     furi_assert(context);
@@ -354,53 +408,50 @@ static void rpc_system_storage_read_process(const PB_Main* request, void* contex
 
     rpc_system_storage_reset_state(rpc_storage, session, true);
 
-    /* use same message memory to send response */
+    /* use same message and frame memory for all responses */
     PB_Main* response = malloc(sizeof(PB_Main));
     const char* path = request->content.storage_read_request.path;
     File* file = storage_file_alloc(rpc_storage->api);
     bool fs_operation_success = storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING);
 
     if(fs_operation_success) {
-        size_t size_left = storage_file_size(file);
-        do {
-            response->command_id = request->command_id;
-            response->which_content = PB_Main_storage_read_response_tag;
-            response->command_status = PB_CommandStatus_OK;
-
-            size_t read_size = MIN(size_left, MAX_DATA_SIZE);
-            if(read_size) {
-                response->content.storage_read_response.has_file = true;
-                response->content.storage_read_response.file.data =
-                    malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(read_size));
-                uint8_t* buffer = &response->content.storage_read_response.file.data->bytes[0];
-                uint16_t* read_size_msg = &response->content.storage_read_response.file.data->size;
-
-                *read_size_msg = storage_file_read(file, buffer, read_size);
-                size_left -= *read_size_msg;
-                fs_operation_success = (*read_size_msg == read_size);
-
-                response->has_next = fs_operation_success && (size_left > 0);
-            } else {
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Warray-bounds"
-                response->content.storage_read_response.file.data =
-                    malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(0));
-                response->content.storage_read_response.file.data->size = 0;
-#pragma GCC diagnostic pop
-                response->content.storage_read_response.has_file = true;
-                response->has_next = false;
-                fs_operation_success = true;
-            }
+        response->command_id = request->command_id;
+        response->which_content = PB_Main_storage_read_response_tag;
+        response->command_status = PB_CommandStatus_OK;
+        response->content.storage_read_response.has_file = true;
+        response->content.storage_read_response.file.data =
+            malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(MAX_DATA_SIZE));
+
+        RpcStorageReadContext read_context = {
+            .session = session,
+            .response = response,
+            .size_left = storage_file_size(file),
+        };
 
-            if(fs_operation_success) {
-                rpc_send_and_release(session, response);
-            }
-        } while((size_left != 0) && fs_operation_success);
+        if(read_context.size_left == 0) {
+            response->content.storage_read_response.file.data->size = 0;
+            response->has_next = false;
+            rpc_send(session, response);
+        } else {
+            /* Next block is read from the storage while the current one is being sent */
+            fs_operation_success = file_read_pipeline_run(
+                                       file,
+                                       STORAGE_BLOCK_SIZE,
+                                       rpc_system_storage_read_block,
+                                       &read_context) &&
+                                   (read_context.size_left == 0);
+        }
+
+        free(response->content.storage_read_response.file.data);
     }
 
     if(!fs_operation_success) {
-        rpc_send_and_release_empty(
-            session, request->command_id, rpc_system_storage_get_file_error(file));
+        PB_CommandStatus status = rpc_system_storage_get_file_error(file);
+        if(status == PB_CommandStatus_OK) {
+            // File size changed while reading
+            status = PB_CommandStatus_ERROR_STORAGE_INTERNAL;
+        }
+        rpc_send_and_release_empty(session, request->command_id, status);
     }
 
     free(response);
@@ -436,6 +487,8 @@ static void rpc_system_storage_write_process(const PB_Main* request, void* conte
 
     if(rpc_storage->state != RpcStorageStateWriting) {
         rpc_storage->file = storage_file_alloc(rpc_storage->api);
+        rpc_storage->write_buffer = malloc(STORAGE_BLOCK_SIZE);
+        rpc_storage->write_buffer_used = 0;
         rpc_storage->current_command_id = request->command_id;
         rpc_storage->state = RpcStorageStateWriting;
         const char* path = request->content.storage_write_request.path;
@@ -450,10 +503,27 @@ static void rpc_system_storage_write_process(const PB_Main* request, void* conte
         if(request->content.storage_write_request.has_file &&
            request->content.storage_write_request.file.data &&
            request->content.storage_write_request.file.data->size) {
-            uint8_t* buffer = request->content.storage_write_request.file.data->bytes;
+            const uint8_t* buffer = request->content.storage_write_request.file.data->bytes;
             size_t buffer_size = request->content.storage_write_request.file.data->size;
-            size_t written_size = storage_file_write(file, buffer, buffer_size);
-            fs_operation_success = (written_size == buffer_size);
+
+            /* Frames are collected into storage sized blocks */
+            while(buffer_size && fs_operation_success) {
+                size_t chunk_size =
+                    MIN(buffer_size, STORAGE_BLOCK_SIZE - rpc_storage->write_buffer_used);
+                uint8_t* block = rpc_storage->write_buffer;
+                memcpy(&block[rpc_storage->write_buffer_used], buffer, chunk_size);
+                rpc_storage->write_buffer_used += chunk_size;
+                buffer += chunk_size;
+                buffer_size -= chunk_size;
+
+                if(rpc_storage->write_buffer_used == STORAGE_BLOCK_SIZE) {
+                    fs_operation_success = rpc_system_storage_write_flush(rpc_storage);
+                }
+            }
+        }
+
+        if(fs_operation_success && !request->has_next) {
+            fs_operation_success = rpc_system_storage_write_flush(rpc_storage);
         }
 
         send_response = !request->has_next;
@@ -592,7 +662,7 @@ static void rpc_system_storage_md5sum_process(const PB_Main* request, void* cont
     FuriString* md5 = furi_string_alloc();
     FS_Error file_error;
 
-    if(md5_string_calc_file(file, filename, md5, &file_error)) {
+    if(md5_cache_string_calc_file(rpc_storage->md5_cache, file, filename, md5, &file_error)) {
         PB_Main response = {
             .command_id = request->command_id,
             .command_status = PB_CommandStatus_OK,
@@ -729,6 +799,9 @@ void* rpc_system_storage_alloc(RpcSession* session) {
 
     RpcStorageSystem* rpc_storage = malloc(sizeof(RpcStorageSystem));
     rpc_storage->api = furi_record_open(RECORD_STORAGE);
+    rpc_storage->write_buffer = NULL;
+    rpc_storage->write_buffer_used = 0;
+    rpc_storage->md5_cache = md5_cache_alloc(rpc_storage->api, MD5_CACHE_DEFAULT_PATH);
     rpc_storage->session = session;
     rpc_storage->state = RpcStorageStateIdle;
 
@@ -788,6 +861,7 @@ void rpc_system_storage_free(void* context) {
 
     rpc_system_storage_reset_state(rpc_storage, session, false);
 
+    md5_cache_free(rpc_storage->md5_cache);
     furi_record_close(RECORD_STORAGE);
     rpc_storage->api = NULL;
     free(rpc_storage);
@@ -53,6 +53,7 @@ typedef enum {
     StorageEventTypeCardMountError, /**< An error occurred during mounting of an SD card. */
     StorageEventTypeFileClose, /**< A file was closed. */
     StorageEventTypeDirClose, /**< A directory was closed. */
+    StorageEventTypeFileChange, /**< A file was opened for writing or removed. */
 } StorageEventType;
 
 /**
@@ -60,6 +61,7 @@ typedef enum {
  */
 typedef struct {
     StorageEventType type; /**< Type of the event. */
+    const char* path; /**< Changed file path for FileChange, valid in the callback only. */
 } StorageEvent;
 
 /**
@@ -275,6 +277,19 @@ bool storage_dir_exists(Storage* storage, const char* path);
  */
 FS_Error storage_common_timestamp(Storage* storage, const char* path, uint32_t* timestamp);
 
+/**
+ * @brief Get the modification time of a file or a directory in UNIX format.
+ *
+ * Unlike storage_common_timestamp(), the value belongs to the item itself and
+ * persists across reboots. The resolution is 2 seconds on FAT filesystems.
+ *
+ * @param storage pointer to a storage API instance.
+ * @param path pointer to a zero-terminated string containing the path of the item in question.
+ * @param mtime pointer to a value to contain the modification time.
+ * @return FSE_OK if the time has been successfully received, any other error code on failure.
+ */
+FS_Error storage_common_mtime(Storage* storage, const char* path, uint32_t* mtime);
+
 /**
  * @brief Get information about a file or a directory.
  *
@@ -444,6 +444,23 @@ FS_Error storage_common_timestamp(Storage* storage, const char* path, uint32_t*
     return S_RETURN_ERROR;
 }
 
+FS_Error storage_common_mtime(Storage* storage, const char* path, uint32_t* mtime) {
+    furi_check(storage);
+    furi_check(mtime);
+    S_API_PROLOGUE;
+
+    SAData data = {
+        .ctimestamp = {
+            .path = path,
+            .timestamp = mtime,
+            .thread_id = furi_thread_get_current_id(),
+        }};
+
+    S_API_MESSAGE(StorageCommandCommonMtime);
+    S_API_EPILOGUE;
+    return S_RETURN_ERROR;
+}
+
 FS_Error storage_common_stat(Storage* storage, const char* path, FileInfo* fileinfo) {
     furi_check(storage);
 
@@ -151,6 +151,7 @@ typedef enum {
     StorageCommandCommonResolvePath,
     StorageCommandSDMount,
     StorageCommandCommonEquivalentPath,
+    StorageCommandCommonMtime,
 } StorageCommand;
 
 typedef struct {
@@ -117,6 +117,12 @@ bool storage_process_file_open(
         } else {
             if(access_mode & FSAM_WRITE) {
                 storage_data_timestamp(storage);
+
+                StorageEvent event = {
+                    .type = StorageEventTypeFileChange,
+                    .path = furi_string_get_cstr(path),
+                };
+                furi_pubsub_publish(app->pubsub, &event);
             }
             storage_push_storage_file(file, path, storage);
 
@@ -342,6 +348,21 @@ static FS_Error
     return ret;
 }
 
+static FS_Error storage_process_common_mtime(Storage* app, FuriString* path, uint32_t* mtime) {
+    StorageData* storage;
+    FS_Error ret = storage_get_data(app, path, &storage);
+
+    if(ret == FSE_OK) {
+        if(storage->fs_api->common.mtime) {
+            FS_CALL(storage, common.mtime(storage, cstr_path_without_vfs_prefix(path), mtime));
+        } else {
+            ret = FSE_NOT_IMPLEMENTED;
+        }
+    }
+
+    return ret;
+}
+
 static FS_Error storage_process_common_stat(Storage* app, FuriString* path, FileInfo* fileinfo) {
     StorageData* storage;
     FS_Error ret = storage_get_data(app, path, &storage);
@@ -367,6 +388,14 @@ static FS_Error storage_process_common_remove(Storage* app, FuriString* path) {
 
         storage_data_timestamp(storage);
         FS_CALL(storage, common.remove(storage, cstr_path_without_vfs_prefix(path)));
+
+        if(ret == FSE_OK) {
+            StorageEvent event = {
+                .type = StorageEventTypeFileChange,
+                .path = furi_string_get_cstr(path),
+            };
+            furi_pubsub_publish(app->pubsub, &event);
+        }
     } while(false);
 
     return ret;
@@ -660,6 +689,12 @@ void storage_process_message_internal(Storage* app, StorageMessage* message) {
         message->return_data->error_value =
             storage_process_common_timestamp(app, path, message->data->ctimestamp.timestamp);
         break;
+    case StorageCommandCommonMtime:
+        path = furi_string_alloc_set(message->data->ctimestamp.path);
+        storage_process_alias(app, path, message->data->ctimestamp.thread_id, false);
+        message->return_data->error_value =
+            storage_process_common_mtime(app, path, message->data->ctimestamp.timestamp);
+        break;
     case StorageCommandCommonStat:
         path = furi_string_alloc_set(message->data->cstat.path);
         storage_process_alias(app, path, message->data->cstat.thread_id, false);
@@ -605,6 +605,26 @@ static FS_Error storage_ext_common_stat(void* ctx, const char* path, FileInfo* f
     return storage_ext_parse_error(result);
 }
 
+static FS_Error storage_ext_common_mtime(void* ctx, const char* path, uint32_t* mtime) {
+    UNUSED(ctx);
+    SDFileInfo _fileinfo;
+    SDError result = f_stat(path, &_fileinfo);
+
+    if(result == FR_OK) {
+        DateTime datetime = {
+            .year = 1980 + (_fileinfo.fdate >> 9),
+            .month = (_fileinfo.fdate >> 5) & 0xF,
+            .day = _fileinfo.fdate & 0x1F,
+            .hour = _fileinfo.ftime >> 11,
+            .minute = (_fileinfo.ftime >> 5) & 0x3F,
+            .second = (_fileinfo.ftime & 0x1F) * 2,
+        };
+        *mtime = datetime_datetime_to_timestamp(&datetime);
+    }
+
+    return storage_ext_parse_error(result);
+}
+
 static FS_Error storage_ext_common_remove(void* ctx, const char* path) {
     UNUSED(ctx);
 #ifdef FURI_RAM_EXEC
@@ -707,6 +727,7 @@ static const FS_Api fs_api = {
             .remove = storage_ext_common_remove,
             .fs_info = storage_ext_common_fs_info,
             .equivalent_path = storage_ext_common_equivalent_path,
+            .mtime = storage_ext_common_mtime,
         },
 };
 
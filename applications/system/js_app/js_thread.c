@@ -359,7 +359,12 @@ static int32_t js_thread(void* arg) {
 
     mjs_set_exec_flags_poller(mjs, js_exit_flag_poll);
 
+    // Reuse precompiled bytecode cached in apps_data/js_app/.cache
+    mjs_set_generate_jsc(mjs, 1);
+
+    uint32_t start_tick = furi_get_tick();
     mjs_err_t err = mjs_exec_file(mjs, furi_string_get_cstr(worker->path), NULL);
+    FURI_LOG_I(TAG, "Script finished in %lu ms", furi_get_tick() - start_tick);
 
 #ifdef JS_DEBUG
     if(furi_hal_rtc_is_flag_set(FuriHalRtcFlagDebug)) {
@@ -15,6 +15,11 @@
 
 #define TAG "UpdWorkerBackup"
 
+#define UPDATE_TASK_NEW_MANIFEST_NAME "Manifest.new"
+
+/* FNV-1a 64-bit offset basis */
+#define UPDATE_TASK_FINGERPRINT_INIT (0xCBF29CE484222325ULL)
+
 static bool update_task_pre_update(UpdateTask* update_task) {
     bool success = false;
     FuriString* backup_file_path;
@@ -35,23 +40,213 @@ static bool update_task_pre_update(UpdateTask* update_task) {
     furi_string_free(backup_file_path);
     return success;
 }
+/**
+ * Resource delta: sorted fingerprints of entry names from the new manifest
+ * that are already installed. Such files are neither removed nor unpacked.
+ */
+typedef struct {
+    uint64_t* kept;
+    size_t kept_count;
+} UpdateTaskResourceDelta;
+
 typedef struct {
     UpdateTask* update_task;
     TarArchive* archive;
+    const UpdateTaskResourceDelta* delta;
+    uint32_t files_written;
+    uint32_t files_skipped;
 } TarUnpackProgress;
 
+static uint64_t
+    update_task_fingerprint_update(uint64_t fingerprint, const void* data, size_t size) {
+    const uint8_t* bytes = data;
+    for(size_t i = 0; i < size; i++) {
+        fingerprint ^= bytes[i];
+        fingerprint *= 0x100000001B3ULL;
+    }
+    return fingerprint;
+}
+
+static uint64_t update_task_fingerprint_name(const char* name) {
+    return update_task_fingerprint_update(UPDATE_TASK_FINGERPRINT_INIT, name, strlen(name));
+}
+
+static uint64_t update_task_fingerprint_file(const ResourceManifestEntry* entry) {
+    uint64_t fingerprint = update_task_fingerprint_name(furi_string_get_cstr(entry->name));
+    return update_task_fingerprint_update(fingerprint, entry->hash, sizeof(entry->hash));
+}
+
+static int update_task_fingerprint_cmp(const void* a, const void* b) {
+    const uint64_t fingerprint_a = *(const uint64_t*)a;
+    const uint64_t fingerprint_b = *(const uint64_t*)b;
+    return (fingerprint_a > fingerprint_b) - (fingerprint_a < fingerprint_b);
+}
+
+static bool
+    update_task_fingerprint_find(const uint64_t* fingerprints, size_t count, uint64_t key) {
+    return bsearch(&key, fingerprints, count, sizeof(uint64_t), update_task_fingerprint_cmp);
+}
+
+static bool
+    update_task_resource_delta_is_kept(const UpdateTaskResourceDelta* delta, const char* name) {
+    return delta && update_task_fingerprint_find(
+                        delta->kept, delta->kept_count, update_task_fingerprint_name(name));
+}
+
+/* Collects sorted name and content fingerprints of all files in the manifest */
+static uint64_t* update_task_manifest_file_fingerprints(
+    ResourceManifestReader* manifest_reader,
+    size_t* count) {
+    ResourceManifestEntry* entry_ptr = NULL;
+    size_t n_file_entries = 0;
+    while((entry_ptr = resource_manifest_reader_next(manifest_reader))) {
+        if(entry_ptr->type == ResourceManifestEntryTypeFile) {
+            n_file_entries++;
+        }
+    }
+    resource_manifest_rewind(manifest_reader);
+
+    uint64_t* fingerprints = malloc(sizeof(uint64_t) * (n_file_entries + 1));
+    size_t n_fingerprints = 0;
+    while((entry_ptr = resource_manifest_reader_next(manifest_reader)) &&
+          (n_fingerprints < n_file_entries)) {
+        if(entry_ptr->type == ResourceManifestEntryTypeFile) {
+            fingerprints[n_fingerprints++] = update_task_fingerprint_file(entry_ptr);
+        }
+    }
+
+    qsort(fingerprints, n_fingerprints, sizeof(uint64_t), update_task_fingerprint_cmp);
+    *count = n_fingerprints;
+    return fingerprints;
+}
+
+/* Checks that the manifest file entry is present on the SD card in full */
+static bool update_task_resource_is_installed(
+    UpdateTask* update_task,
+    const ResourceManifestEntry* entry,
+    FuriString* file_path) {
+    FileInfo file_info;
+    path_concat(STORAGE_EXT_PATH_PREFIX, furi_string_get_cstr(entry->name), file_path);
+    FS_Error result =
+        storage_common_stat(update_task->storage, furi_string_get_cstr(file_path), &file_info);
+    return (result == FSE_OK) && !file_info_is_dir(&file_info) &&
+           (file_info.size == entry->size);
+}
+
+/**
+ * Compares the installed resource manifest with the one in the resource bundle.
+ * Files that have the same name and hash in both, and are still present on the
+ * SD card, are kept as is. Directories of the new bundle are always kept.
+ */
+static bool update_task_prepare_resource_delta(
+    UpdateTask* update_task,
+    TarArchive* archive,
+    UpdateTaskResourceDelta* delta) {
+    bool success = false;
+    uint64_t* installed = NULL;
+    size_t installed_count = 0;
+    FuriString* file_path = furi_string_alloc();
+    FuriString* new_manifest_path = furi_string_alloc();
+    path_concat(
+        furi_string_get_cstr(update_task->update_path),
+        UPDATE_TASK_NEW_MANIFEST_NAME,
+        new_manifest_path);
+
+    ResourceManifestReader* manifest_reader = resource_manifest_reader_alloc(update_task->storage);
+    do {
+        if(!resource_manifest_reader_open(manifest_reader, EXT_PATH("Manifest"))) {
+            FURI_LOG_W(TAG, "No existing manifest, full install");
+            break;
+        }
+        installed = update_task_manifest_file_fingerprints(manifest_reader, &installed_count);
+
+        if(!tar_archive_unpack_file(
+               archive, "Manifest", furi_string_get_cstr(new_manifest_path))) {
+            FURI_LOG_W(TAG, "No manifest in resource bundle, full install");
+            break;
+        }
+
+        resource_manifest_reader_free(manifest_reader);
+        manifest_reader = resource_manifest_reader_alloc(update_task->storage);
+        if(!resource_manifest_reader_open(
+               manifest_reader, furi_string_get_cstr(new_manifest_path))) {
+            break;
+        }
+
+        ResourceManifestEntry* entry_ptr = NULL;
+        size_t n_entries = 0;
+        while((entry_ptr = resource_manifest_reader_next(manifest_reader))) {
+            if(entry_ptr->type == ResourceManifestEntryTypeFile ||
+               entry_ptr->type == ResourceManifestEntryTypeDirectory) {
+                n_entries++;
+            }
+        }
+        resource_manifest_rewind(manifest_reader);
+
+        delta->kept = malloc(sizeof(uint64_t) * (n_entries + 1));
+        delta->kept_count = 0;
+        size_t n_kept_files = 0;
+        while((entry_ptr = resource_manifest_reader_next(manifest_reader)) &&
+              (delta->kept_count < n_entries)) {
+            bool kept = false;
+            if(entry_ptr->type == ResourceManifestEntryTypeDirectory) {
+                kept = true;
+            } else if(entry_ptr->type == ResourceManifestEntryTypeFile) {
+                kept = update_task_fingerprint_find(
+                           installed, installed_count, update_task_fingerprint_file(entry_ptr)) &&
+                       update_task_resource_is_installed(update_task, entry_ptr, file_path);
+                n_kept_files += kept;
+            }
+
+            if(kept) {
+                delta->kept[delta->kept_count++] =
+                    update_task_fingerprint_name(furi_string_get_cstr(entry_ptr->name));
+            }
+        }
+        qsort(delta->kept, delta->kept_count, sizeof(uint64_t), update_task_fingerprint_cmp);
+
+        FURI_LOG_I(TAG, "Delta install: %zu files unchanged", n_kept_files);
+        success = true;
+    } while(false);
+    resource_manifest_reader_free(manifest_reader);
+
+    storage_common_remove(update_task->storage, furi_string_get_cstr(new_manifest_path));
+
+    if(!success) {
+        free(delta->kept);
+        delta->kept = NULL;
+        delta->kept_count = 0;
+    }
+
+    free(installed);
+    furi_string_free(new_manifest_path);
+    furi_string_free(file_path);
+    return success;
+}
+
 static bool update_task_resource_unpack_cb(const char* name, bool is_directory, void* context) {
-    UNUSED(name);
-    UNUSED(is_directory);
     TarUnpackProgress* unpack_progress = context;
     int32_t progress = 0, total = 0;
     tar_archive_get_read_progress(unpack_progress->archive, &progress, &total);
     update_task_set_progress(
         unpack_progress->update_task, UpdateTaskStageProgress, (progress * 100) / (total + 1));
+
+    if(is_directory) {
+        return true;
+    }
+
+    if(update_task_resource_delta_is_kept(unpack_progress->delta, name)) {
+        unpack_progress->files_skipped++;
+        return false;
+    }
+
+    unpack_progress->files_written++;
     return true;
 }
 
-static void update_task_cleanup_resources(UpdateTask* update_task) {
+static void update_task_cleanup_resources(
+    UpdateTask* update_task,
+    const UpdateTaskResourceDelta* delta) {
     ResourceManifestReader* manifest_reader = resource_manifest_reader_alloc(update_task->storage);
     do {
         FURI_LOG_D(TAG, "Cleaning up old manifest");
@@ -81,6 +276,11 @@ static void update_task_cleanup_resources(UpdateTask* update_task) {
                     UpdateTaskStageProgress,
                     (n_processed_file_entries++ * 100) / n_file_entries);
 
+                if(update_task_resource_delta_is_kept(
+                       delta, furi_string_get_cstr(entry_ptr->name))) {
+                    continue;
+                }
+
                 FuriString* file_path = furi_string_alloc();
                 path_concat(
                     STORAGE_EXT_PATH_PREFIX, furi_string_get_cstr(entry_ptr->name), file_path);
@@ -108,6 +308,11 @@ static void update_task_cleanup_resources(UpdateTask* update_task) {
                     UpdateTaskStageProgress,
                     (n_processed_dir_entries++ * 100) / n_dir_entries);
 
+                if(update_task_resource_delta_is_kept(
+                       delta, furi_string_get_cstr(entry_ptr->name))) {
+                    continue;
+                }
+
                 FuriString* folder_path = furi_string_alloc();
 
                 do {
@@ -141,6 +346,8 @@ static bool update_task_post_update(UpdateTask* update_task) {
     FuriString* file_path;
     file_path = furi_string_alloc();
 
+    uint32_t start_tick = furi_get_tick();
+    UpdateTaskResourceDelta delta = {0};
     TarArchive* archive = tar_archive_alloc(update_task->storage);
     do {
         path_concat(
@@ -156,6 +363,9 @@ static bool update_task_post_update(UpdateTask* update_task) {
             TarUnpackProgress progress = {
                 .update_task = update_task,
                 .archive = archive,
+                .delta = NULL,
+                .files_written = 0,
+                .files_skipped = 0,
             };
 
             path_concat(
@@ -166,11 +376,21 @@ static bool update_task_post_update(UpdateTask* update_task) {
             CHECK_RESULT(tar_archive_open(
                 archive, furi_string_get_cstr(file_path), TarOpenModeReadHeatshrink));
 
-            update_task_cleanup_resources(update_task);
+            if(update_task_prepare_resource_delta(update_task, archive, &delta)) {
+                progress.delta = &delta;
+            }
+
+            update_task_cleanup_resources(update_task, progress.delta);
 
             update_task_set_progress(update_task, UpdateTaskStageResourcesFileUnpack, 0);
             tar_archive_set_file_callback(archive, update_task_resource_unpack_cb, &progress);
             CHECK_RESULT(tar_archive_unpack_to(archive, STORAGE_EXT_PATH_PREFIX, NULL));
+
+            FURI_LOG_I(
+                TAG,
+                "Resources: %lu files written, %lu unchanged",
+                progress.files_written,
+                progress.files_skipped);
         }
 
         if(update_task->state.groups & UpdateTaskStageGroupSplashscreen) {
@@ -190,6 +410,9 @@ static bool update_task_post_update(UpdateTask* update_task) {
         success = true;
     } while(false);
 
+    FURI_LOG_I(TAG, "Post-update took %lu ms", furi_get_tick() - start_tick);
+
+    free(delta.kept);
     tar_archive_free(archive);
     furi_string_free(file_path);
     return success;
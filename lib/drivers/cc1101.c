@@ -100,6 +100,102 @@ CC1101Status cc1101_calibrate(FuriHalSpiBusHandle* handle) {
     return cc1101_strobe(handle, CC1101_STROBE_SCAL);
 }
 
+void cc1101_calibration_cache_reset(CC1101CalibrationCache* cache, int8_t temperature) {
+    memset(cache, 0, sizeof(CC1101CalibrationCache));
+    cache->temperature = temperature;
+}
+
+void cc1101_calibration_cache_set_temperature(CC1101CalibrationCache* cache, int8_t temperature) {
+    cache->temperature = temperature;
+}
+
+static CC1101CalibrationCacheEntry*
+    cc1101_calibration_cache_find(CC1101CalibrationCache* cache, uint32_t frequency) {
+    for(size_t i = 0; i < CC1101_CALIBRATION_CACHE_SIZE; i++) {
+        CC1101CalibrationCacheEntry* entry = &cache->entries[i];
+        if(entry->frequency == frequency) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+bool cc1101_calibration_cache_get(
+    CC1101CalibrationCache* cache,
+    uint32_t frequency,
+    int8_t temperature,
+    CC1101Fscal* fscal) {
+    if(frequency == 0) return false;
+
+    CC1101CalibrationCacheEntry* entry = cc1101_calibration_cache_find(cache, frequency);
+    if(!entry) return false;
+
+    int32_t drift = (int32_t)temperature - entry->temperature;
+    if(drift >= CC1101_CALIBRATION_TEMPERATURE_DRIFT ||
+       drift <= -CC1101_CALIBRATION_TEMPERATURE_DRIFT) {
+        return false;
+    }
+
+    *fscal = entry->fscal;
+    return true;
+}
+
+void cc1101_calibration_cache_set(
+    CC1101CalibrationCache* cache,
+    uint32_t frequency,
+    int8_t temperature,
+    const CC1101Fscal* fscal) {
+    CC1101CalibrationCacheEntry* entry = cc1101_calibration_cache_find(cache, frequency);
+    if(!entry) {
+        entry = &cache->entries[cache->next];
+        cache->next = (cache->next + 1) % CC1101_CALIBRATION_CACHE_SIZE;
+    }
+
+    entry->frequency = frequency;
+    entry->fscal = *fscal;
+    entry->temperature = temperature;
+}
+
+bool cc1101_calibrate_cached(
+    FuriHalSpiBusHandle* handle,
+    CC1101CalibrationCache* cache,
+    uint32_t frequency) {
+    if(!cache) {
+        cc1101_calibrate(handle);
+        return cc1101_wait_status_state(handle, CC1101StateIDLE, 10000);
+    }
+
+    const int8_t temperature = cache->temperature;
+    CC1101Fscal fscal;
+
+    if(cc1101_calibration_cache_get(cache, frequency, temperature, &fscal)) {
+        cc1101_write_reg(handle, CC1101_FSCAL3, fscal.fscal3);
+        cc1101_write_reg(handle, CC1101_FSCAL2, fscal.fscal2);
+        cc1101_write_reg(handle, CC1101_FSCAL1, fscal.fscal1);
+        cache->restore_count++;
+    } else {
+        cc1101_calibrate(handle);
+        cache->calibrate_count++;
+        if(!cc1101_wait_status_state(handle, CC1101StateIDLE, 10000)) {
+            return false;
+        }
+
+        cc1101_read_reg(handle, CC1101_FSCAL3, &fscal.fscal3);
+        cc1101_read_reg(handle, CC1101_FSCAL2, &fscal.fscal2);
+        cc1101_read_reg(handle, CC1101_FSCAL1, &fscal.fscal1);
+        cc1101_calibration_cache_set(cache, frequency, temperature, &fscal);
+    }
+
+    // Synthesizer is calibrated for this frequency, don't redo it on every idle-to-rx/tx
+    uint8_t mcsm0 = 0;
+    cc1101_read_reg(handle, CC1101_MCSM0, &mcsm0);
+    if(mcsm0 & CC1101_MCSM0_FS_AUTOCAL_MASK) {
+        cc1101_write_reg(handle, CC1101_MCSM0, mcsm0 & ~CC1101_MCSM0_FS_AUTOCAL_MASK);
+    }
+
+    return true;
+}
+
 CC1101Status cc1101_switch_to_idle(FuriHalSpiBusHandle* handle) {
     return cc1101_strobe(handle, CC1101_STROBE_SIDLE);
 }
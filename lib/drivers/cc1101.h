@@ -3,6 +3,7 @@
 #include "cc1101_regs.h"
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <furi_hal_spi.h>
 
@@ -10,6 +11,39 @@
 extern "C" {
 #endif
 
+/** Calibration cache size, enough for the hopper and analyzer frequency sets */
+#define CC1101_CALIBRATION_CACHE_SIZE 64
+
+/** Temperature change in degree C after which cached calibration is redone */
+#define CC1101_CALIBRATION_TEMPERATURE_DRIFT 5
+
+/** Frequency synthesizer calibration result */
+typedef struct {
+    uint8_t fscal3;
+    uint8_t fscal2;
+    uint8_t fscal1;
+} CC1101Fscal;
+
+typedef struct {
+    uint32_t frequency; /** Real frequency, 0 if entry is empty */
+    CC1101Fscal fscal;
+    int8_t temperature;
+} CC1101CalibrationCacheEntry;
+
+/** Frequency synthesizer calibration cache
+ *
+ * Keeps FSCAL3-1 results for recently used frequencies, so retuning to
+ * a known frequency is a register write instead of a ~720us calibration.
+ * Owner updates temperature periodically outside of the retune path.
+ */
+typedef struct {
+    CC1101CalibrationCacheEntry entries[CC1101_CALIBRATION_CACHE_SIZE];
+    size_t next;
+    volatile int8_t temperature; /** Current temperature in degree C */
+    uint32_t calibrate_count; /** SCAL strobes issued, for tests */
+    uint32_t restore_count; /** FSCAL3-1 writes from cache, for tests */
+} CC1101CalibrationCache;
+
 /* Low level API */
 
 /** Strobe command to the device
@@ -109,6 +143,74 @@ uint8_t cc1101_get_rssi(FuriHalSpiBusHandle* handle);
  */
 CC1101Status cc1101_calibrate(FuriHalSpiBusHandle* handle);
 
+/** Calibrate frequency synthesizer for current frequency using cache
+ *
+ * Writes back cached calibration if frequency was calibrated before at
+ * a temperature close to the cache one, otherwise runs calibration and
+ * stores the result. Chip must be in IDLE state.
+ *
+ * @warning    With a cache, FS_AUTOCAL in MCSM0 is cleared, so the chip no
+ *             longer calibrates on idle-to-rx/tx. It stays cleared until
+ *             MCSM0 is written again, i.e. the next preset load. Pass NULL
+ *             cache to calibrate without touching FS_AUTOCAL.
+ *
+ * @param      handle     - pointer to FuriHalSpiHandle
+ * @param      cache      - pointer to CC1101CalibrationCache or NULL
+ * @param      frequency  - real frequency returned by cc1101_set_frequency
+ *
+ * @return     true on success, false if calibration timed out
+ */
+bool cc1101_calibrate_cached(
+    FuriHalSpiBusHandle* handle,
+    CC1101CalibrationCache* cache,
+    uint32_t frequency);
+
+/** Reset calibration cache
+ *
+ * @param      cache        - pointer to CC1101CalibrationCache
+ * @param      temperature  - current temperature in degree C
+ */
+void cc1101_calibration_cache_reset(CC1101CalibrationCache* cache, int8_t temperature);
+
+/** Update current temperature of calibration cache
+ *
+ * Entries calibrated at a temperature differing by
+ * CC1101_CALIBRATION_TEMPERATURE_DRIFT or more are recalibrated on next use.
+ * Meant to be called from a timer, not on every retune.
+ *
+ * @param      cache        - pointer to CC1101CalibrationCache
+ * @param      temperature  - current temperature in degree C
+ */
+void cc1101_calibration_cache_set_temperature(CC1101CalibrationCache* cache, int8_t temperature);
+
+/** Find cached calibration
+ *
+ * @param      cache        - pointer to CC1101CalibrationCache
+ * @param      frequency    - real frequency
+ * @param      temperature  - current temperature in degree C
+ * @param[out] fscal        - calibration result
+ *
+ * @return     true if valid calibration was found
+ */
+bool cc1101_calibration_cache_get(
+    CC1101CalibrationCache* cache,
+    uint32_t frequency,
+    int8_t temperature,
+    CC1101Fscal* fscal);
+
+/** Store calibration in cache, replacing the oldest entry if cache is full
+ *
+ * @param      cache        - pointer to CC1101CalibrationCache
+ * @param      frequency    - real frequency
+ * @param      temperature  - temperature in degree C at calibration time
+ * @param      fscal        - calibration result
+ */
+void cc1101_calibration_cache_set(
+    CC1101CalibrationCache* cache,
+    uint32_t frequency,
+    int8_t temperature,
+    const CC1101Fscal* fscal);
+
 /** Switch to idle
  *
  * @param      handle  - pointer to FuriHalSpiHandle
@@ -118,6 +118,8 @@ extern "C" {
 #define CC1101_FIFO \
     0x3F /** FIFO register nunmber, can be combined with CC1101_WRITE and/or CC1101_BURST */
 #define CC1101_IOCFG_INV (1 << 6) /** IOCFG inversion */
+#define CC1101_MCSM0_FS_AUTOCAL_MASK \
+    (0b11 << 4) /** MCSM0 FS_AUTOCAL field, 0 disables automatic synthesizer calibration */
 
 typedef enum {
     CC1101IocfgRxFifoThreshold = 0x00,
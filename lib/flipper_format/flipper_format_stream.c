@@ -14,19 +14,6 @@ static bool flipper_format_stream_write(Stream* stream, const void* data, size_t
     return bytes_written == data_size;
 }
 
-static bool flipper_format_stream_write_key(Stream* stream, const char* key) {
-    bool result = false;
-
-    do {
-        if(!flipper_format_stream_write(stream, key, strlen(key))) break;
-        if(!flipper_format_stream_write(stream, &flipper_format_delimiter, 1)) break;
-        if(!flipper_format_stream_write(stream, " ", 1)) break;
-        result = true;
-    } while(false);
-
-    return result;
-}
-
 bool flipper_format_stream_write_eol(Stream* stream) {
     return flipper_format_stream_write(stream, &flipper_format_eoln, 1);
 }
@@ -266,75 +253,128 @@ static bool flipper_format_stream_seek_to_next_line(Stream* stream) {
     return result;
 }
 
+static const char flipper_format_hex_digits[] = "0123456789ABCDEF";
+
+static void flipper_format_stream_cat_hex(FuriString* line, uint8_t value) {
+    furi_string_push_back(line, flipper_format_hex_digits[value >> 4]);
+    furi_string_push_back(line, flipper_format_hex_digits[value & 0x0F]);
+}
+
+static void flipper_format_stream_cat_uint32(FuriString* line, uint32_t value) {
+    char digits[10];
+    size_t count = 0;
+
+    do {
+        digits[count++] = '0' + value % 10;
+        value /= 10;
+    } while(value);
+
+    while(count) {
+        furi_string_push_back(line, digits[--count]);
+    }
+}
+
+static void flipper_format_stream_cat_int32(FuriString* line, int32_t value) {
+    if(value < 0) {
+        furi_string_push_back(line, '-');
+        flipper_format_stream_cat_uint32(line, 0U - (uint32_t)value);
+    } else {
+        flipper_format_stream_cat_uint32(line, value);
+    }
+}
+
+static void flipper_format_stream_cat_hex_uint64(FuriString* line, uint64_t value) {
+    for(int8_t shift = 60; shift >= 0; shift -= 4) {
+        furi_string_push_back(line, flipper_format_hex_digits[(value >> shift) & 0x0F]);
+    }
+}
+
+/** Upper bound of formatted value length, separator included */
+static size_t flipper_format_stream_value_width(FlipperStreamWriteData* write_data) {
+    switch(write_data->type) {
+    case FlipperStreamValueStr:
+        return strlen(write_data->data);
+    case FlipperStreamValueHex:
+        return 3;
+    case FlipperStreamValueInt32:
+    case FlipperStreamValueUint32:
+        return 12;
+    case FlipperStreamValueHexUint64:
+        return 17;
+    case FlipperStreamValueBool:
+        return 6;
+    default:
+        return 16;
+    }
+}
+
 bool flipper_format_stream_write_value_line(Stream* stream, FlipperStreamWriteData* write_data) {
     bool result = false;
 
     if(write_data->type == FlipperStreamValueIgnore) {
         result = true;
     } else {
-        FuriString* value;
-        value = furi_string_alloc();
-
-        do {
-            if(!flipper_format_stream_write_key(stream, write_data->key)) break;
-
-            if(write_data->type == FlipperStreamValueStr) write_data->data_size = 1;
-
-            bool cycle_error = false;
-            for(uint16_t i = 0; i < write_data->data_size; i++) {
-                switch(write_data->type) {
-                case FlipperStreamValueStr: {
-                    const char* data = write_data->data;
-                    furi_string_printf(value, "%s", data);
-                }; break;
-                case FlipperStreamValueHex: {
-                    const uint8_t* data = write_data->data;
-                    furi_string_printf(value, "%02X", data[i]);
-                }; break;
+        if(write_data->type == FlipperStreamValueStr) write_data->data_size = 1;
+
+        // Whole line is formatted in memory and written at once: on a file stream
+        // every write is a round trip to the storage thread
+        FuriString* line = furi_string_alloc();
+        furi_string_reserve(
+            line,
+            strlen(write_data->key) + 3 +
+                write_data->data_size * flipper_format_stream_value_width(write_data));
+
+        furi_string_set_str(line, write_data->key);
+        furi_string_push_back(line, flipper_format_delimiter);
+        furi_string_push_back(line, ' ');
+
+        for(uint16_t i = 0; i < write_data->data_size; i++) {
+            switch(write_data->type) {
+            case FlipperStreamValueStr: {
+                const char* data = write_data->data;
+                furi_string_cat_str(line, data);
+            }; break;
+            case FlipperStreamValueHex: {
+                const uint8_t* data = write_data->data;
+                flipper_format_stream_cat_hex(line, data[i]);
+            }; break;
 #ifndef FLIPPER_STREAM_LITE
-                case FlipperStreamValueFloat: {
-                    const float* data = write_data->data;
-                    furi_string_printf(value, "%f", (double)data[i]);
-                }; break;
+            case FlipperStreamValueFloat: {
+                const float* data = write_data->data;
+                furi_string_cat_printf(line, "%f", (double)data[i]);
+            }; break;
 #endif
-                case FlipperStreamValueInt32: {
-                    const int32_t* data = write_data->data;
-                    furi_string_printf(value, "%" PRIi32, data[i]);
-                }; break;
-                case FlipperStreamValueUint32: {
-                    const uint32_t* data = write_data->data;
-                    furi_string_printf(value, "%" PRIu32, data[i]);
-                }; break;
-                case FlipperStreamValueHexUint64: {
-                    const uint64_t* data = write_data->data;
-                    furi_string_printf(
-                        value, "%08lX%08lX", (uint32_t)(data[i] >> 32), (uint32_t)data[i]);
-                }; break;
-                case FlipperStreamValueBool: {
-                    const bool* data = write_data->data;
-                    furi_string_printf(value, data[i] ? "true" : "false");
-                }; break;
-                default:
-                    furi_crash("Unknown FF type");
-                }
-
-                if(((size_t)i + 1) < write_data->data_size) {
-                    furi_string_cat(value, " ");
-                }
+            case FlipperStreamValueInt32: {
+                const int32_t* data = write_data->data;
+                flipper_format_stream_cat_int32(line, data[i]);
+            }; break;
+            case FlipperStreamValueUint32: {
+                const uint32_t* data = write_data->data;
+                flipper_format_stream_cat_uint32(line, data[i]);
+            }; break;
+            case FlipperStreamValueHexUint64: {
+                const uint64_t* data = write_data->data;
+                flipper_format_stream_cat_hex_uint64(line, data[i]);
+            }; break;
+            case FlipperStreamValueBool: {
+                const bool* data = write_data->data;
+                furi_string_cat_str(line, data[i] ? "true" : "false");
+            }; break;
+            default:
+                furi_crash("Unknown FF type");
+            }
 
-                if(!flipper_format_stream_write(
-                       stream, furi_string_get_cstr(value), furi_string_size(value))) {
-                    cycle_error = true;
-                    break;
-                }
+            if(((size_t)i + 1) < write_data->data_size) {
+                furi_string_push_back(line, ' ');
             }
-            if(cycle_error) break;
+        }
 
-            if(!flipper_format_stream_write_eol(stream)) break;
-            result = true;
-        } while(false);
+        furi_string_push_back(line, flipper_format_eoln);
+
+        result = flipper_format_stream_write(
+            stream, furi_string_get_cstr(line), furi_string_size(line));
 
-        furi_string_free(value);
+        furi_string_free(line);
     }
 
     return result;
@@ -374,10 +414,7 @@ bool flipper_format_stream_read_value_line(
                         uint8_t* data = _data;
                         if(furi_string_size(value) >= 2) {
                             // sscanf "%02X" does not work here
-                            if(hex_char_to_uint8(
-                                   furi_string_get_char(value, 0),
-                                   furi_string_get_char(value, 1),
-                                   &data[i])) {
+                            if(hex_decode(furi_string_get_cstr(value), 2, &data[i])) {
                                 scan_values = 1;
                             }
                         }
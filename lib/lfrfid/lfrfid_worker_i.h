@@ -14,6 +14,9 @@
 extern "C" {
 #endif
 
+/** Pulses per averaging window of the read mode */
+#define LFRFID_WORKER_READ_AVERAGE_COUNT 64
+
 typedef struct {
     void (*const process)(LFRFIDWorker* worker);
 } LFRFIDWorkerModeType;
@@ -38,6 +41,7 @@ struct LFRFIDWorker {
     FuriThread* thread;
 
     LFRFIDWorkerReadType read_type;
+    LFRFIDFeature read_feature_hint;
 
     LFRFIDWorkerReadCallback read_cb;
     LFRFIDWorkerWriteCallback write_cb;
@@ -60,6 +64,19 @@ extern const LFRFIDWorkerModeType lfrfid_worker_modes[];
  */
 bool lfrfid_worker_check_for_stop(LFRFIDWorker* worker);
 
+/**
+ * @brief Check if an averaging window of the read mode does not fit the modulation
+ * 
+ * @param feature read modulation
+ * @param average_duration sum of LFRFID_WORKER_READ_AVERAGE_COUNT pulse periods, us
+ * @param noise_count noise spikes dropped in the window
+ * @return bool 
+ */
+bool lfrfid_worker_read_is_modulation_mismatch(
+    LFRFIDFeature feature,
+    uint32_t average_duration,
+    uint32_t noise_count);
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,13 +22,20 @@
 #define LFRFID_WORKER_READ_DEBUG_GPIO_LOAD  &gpio_ext_pa6
 #endif
 
-#define LFRFID_WORKER_READ_AVERAGE_COUNT 64
-#define LFRFID_WORKER_READ_MIN_TIME_US   16
+#define LFRFID_WORKER_READ_MIN_TIME_US 16
 
 #define LFRFID_WORKER_READ_DROP_TIME_MS      50
 #define LFRFID_WORKER_READ_STABILIZE_TIME_MS 450
 #define LFRFID_WORKER_READ_SWITCH_TIME_MS    2000
 
+/**
+ * In auto mode the modulation is switched early if nothing was decoded and
+ * no averaging window fitted the current modulation for a quarter of the
+ * switch time. A window fits if its average edge is not shorter than the
+ * shortest edge the decoders of the modulation accept.
+ */
+#define LFRFID_WORKER_READ_MISMATCH_TIME_MS (LFRFID_WORKER_READ_SWITCH_TIME_MS / 4)
+
 #define LFRFID_WORKER_WRITE_VERIFY_TIME_MS   2000
 #define LFRFID_WORKER_WRITE_DROP_TIME_MS     50
 #define LFRFID_WORKER_WRITE_TOO_LONG_TIME_MS 10000
@@ -67,6 +74,7 @@ typedef struct {
     BufferStream* stream;
     VarintPair* pair;
     bool ignore_next_pulse;
+    volatile uint32_t noise_count;
 } LFRFIDWorkerReadContext;
 
 static void lfrfid_worker_read_capture(bool level, uint32_t duration, void* context) {
@@ -83,6 +91,7 @@ static void lfrfid_worker_read_capture(bool level, uint32_t duration, void* cont
         if(level) {
             ctx->ignore_next_pulse = true;
         }
+        ctx->noise_count++;
         varint_pair_reset(ctx->pair);
         return;
     }
@@ -105,10 +114,26 @@ typedef enum {
     LFRFIDWorkerReadTimeout,
 } LFRFIDWorkerReadState;
 
+bool lfrfid_worker_read_is_modulation_mismatch(
+    LFRFIDFeature feature,
+    uint32_t average_duration,
+    uint32_t noise_count) {
+    // FSK decoders time a whole subcarrier period, PSK decoders a single level
+    uint32_t min_edge = (feature & LFRFIDFeatureASK) ? LFRFID_FSK_MIN_TIME_US / 2 :
+                                                        LFRFID_PSK_MIN_TIME_US;
+
+    // every pulse period is made of two edges
+    uint32_t average_edge = average_duration / (LFRFID_WORKER_READ_AVERAGE_COUNT * 2);
+
+    // too short edges or more noise spikes than valid edges
+    return average_edge < min_edge || noise_count > LFRFID_WORKER_READ_AVERAGE_COUNT;
+}
+
 static LFRFIDWorkerReadState lfrfid_worker_read_internal(
     LFRFIDWorker* worker,
     LFRFIDFeature feature,
     uint32_t timeout,
+    bool switch_early,
     ProtocolId* result_protocol) {
     LFRFIDWorkerReadState state = LFRFIDWorkerReadTimeout;
 
@@ -140,6 +165,8 @@ static LFRFIDWorkerReadState lfrfid_worker_read_internal(
 
     LFRFIDWorkerReadContext ctx;
     ctx.pair = varint_pair_alloc();
+    ctx.ignore_next_pulse = false;
+    ctx.noise_count = 0;
     ctx.stream =
         buffer_stream_alloc(LFRFID_WORKER_READ_BUFFER_SIZE, LFRFID_WORKER_READ_BUFFER_COUNT);
 
@@ -152,13 +179,18 @@ static LFRFIDWorkerReadState lfrfid_worker_read_internal(
     uint8_t* protocol_data = malloc(last_size);
     size_t last_read_count = 0;
 
-    uint32_t switch_os_tick_last = furi_get_tick();
+    uint32_t read_os_tick_start = furi_get_tick();
+    uint32_t switch_os_tick_last = read_os_tick_start;
 
     uint32_t average_duration = 0;
     uint32_t average_pulse = 0;
     size_t average_index = 0;
     bool card_detected = false;
 
+    uint32_t noise_count_last = 0;
+    uint32_t fit_os_tick_last = read_os_tick_start;
+    bool mismatch = false;
+
     FURI_LOG_D(TAG, "Read started");
     while(true) {
         if(lfrfid_worker_check_for_stop(worker)) {
@@ -208,6 +240,15 @@ static LFRFIDWorkerReadState lfrfid_worker_read_internal(
                 average_index++;
                 if(average_index >= LFRFID_WORKER_READ_AVERAGE_COUNT) {
                     float average = (float)average_pulse / (float)average_duration;
+
+                    uint32_t noise_count = ctx.noise_count;
+                    mismatch = lfrfid_worker_read_is_modulation_mismatch(
+                        feature, average_duration, noise_count - noise_count_last);
+                    if(!mismatch) {
+                        fit_os_tick_last = furi_get_tick();
+                    }
+                    noise_count_last = noise_count;
+
                     average_pulse = 0;
                     average_duration = 0;
                     average_index = 0;
@@ -310,6 +351,17 @@ static LFRFIDWorkerReadState lfrfid_worker_read_internal(
             state = LFRFIDWorkerReadTimeout;
             break;
         }
+
+        if(switch_early && last_protocol == PROTOCOL_NO && mismatch &&
+           (furi_get_tick() - fit_os_tick_last) > LFRFID_WORKER_READ_MISMATCH_TIME_MS) {
+            FURI_LOG_D(TAG, "Modulation mismatch, switching early");
+            state = LFRFIDWorkerReadTimeout;
+            break;
+        }
+    }
+
+    if(state == LFRFIDWorkerReadOK) {
+        FURI_LOG_D(TAG, "Read done in %lu ms", furi_get_tick() - read_os_tick_start);
     }
 
     FURI_LOG_D(TAG, "Read stopped");
@@ -349,6 +401,9 @@ static void lfrfid_worker_mode_read_process(LFRFIDWorker* worker) {
 
     if(worker->read_type == LFRFIDWorkerReadTypePSKOnly) {
         feature = LFRFIDFeaturePSK;
+    } else if(worker->read_type == LFRFIDWorkerReadTypeAuto) {
+        // start with the modulation that was read last time
+        feature = worker->read_feature_hint;
     } else {
         feature = LFRFIDFeatureASK;
     }
@@ -357,9 +412,12 @@ static void lfrfid_worker_mode_read_process(LFRFIDWorker* worker) {
         while(1) {
             // read for a while
             state = lfrfid_worker_read_internal(
-                worker, feature, LFRFID_WORKER_READ_SWITCH_TIME_MS, &read_result);
+                worker, feature, LFRFID_WORKER_READ_SWITCH_TIME_MS, true, &read_result);
 
-            if(state == LFRFIDWorkerReadOK || state == LFRFIDWorkerReadExit) {
+            if(state == LFRFIDWorkerReadOK) {
+                worker->read_feature_hint = feature;
+                break;
+            } else if(state == LFRFIDWorkerReadExit) {
                 break;
             }
 
@@ -375,10 +433,11 @@ static void lfrfid_worker_mode_read_process(LFRFIDWorker* worker) {
     } else {
         while(1) {
             if(worker->read_type == LFRFIDWorkerReadTypeASKOnly) {
-                state = lfrfid_worker_read_internal(worker, feature, UINT32_MAX, &read_result);
+                state =
+                    lfrfid_worker_read_internal(worker, feature, UINT32_MAX, false, &read_result);
             } else {
                 state = lfrfid_worker_read_internal(
-                    worker, feature, LFRFID_WORKER_READ_SWITCH_TIME_MS, &read_result);
+                    worker, feature, LFRFID_WORKER_READ_SWITCH_TIME_MS, false, &read_result);
             }
 
             if(state == LFRFIDWorkerReadOK || state == LFRFIDWorkerReadExit) {
@@ -533,6 +592,7 @@ static void lfrfid_worker_mode_write_process(LFRFIDWorker* worker) {
                 worker,
                 protocol_dict_get_features(worker->protocols, protocol),
                 LFRFID_WORKER_WRITE_VERIFY_TIME_MS,
+                false,
                 &read_result);
 
             if(state == LFRFIDWorkerReadOK) {
@@ -624,6 +684,7 @@ static void lfrfid_worker_mode_write_and_set_pass_process(LFRFIDWorker* worker)
                 worker,
                 protocol_dict_get_features(worker->protocols, protocol),
                 LFRFID_WORKER_WRITE_VERIFY_TIME_MS,
+                false,
                 &read_result);
 
             if(state == LFRFIDWorkerReadOK) {
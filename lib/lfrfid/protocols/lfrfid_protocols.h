@@ -7,6 +7,16 @@ typedef enum {
     LFRFIDFeaturePSK = 1 << 1, /** PSK Demodulation */
 } LFRFIDFeature;
 
+/** FSK subcarrier periods (RF/8 and RF/10) with jitter, shared by the FSK decoders, us */
+#define LFRFID_FSK_JITTER_TIME_US (20)
+#define LFRFID_FSK_MIN_TIME_US    (64 - LFRFID_FSK_JITTER_TIME_US)
+#define LFRFID_FSK_MAX_TIME_US    (80 + LFRFID_FSK_JITTER_TIME_US)
+
+/** PSK bit period (RF/32), shared by the PSK decoders, us */
+#define LFRFID_PSK_US_PER_BIT (255)
+/** Shortest phase run the PSK decoders accept, us */
+#define LFRFID_PSK_MIN_TIME_US (LFRFID_PSK_US_PER_BIT / 4)
+
 typedef enum {
     LFRFIDProtocolEM4100,
     LFRFIDProtocolEM4100_32,
@@ -5,9 +5,8 @@
 #include <bit_lib/bit_lib.h>
 #include "lfrfid_protocols.h"
 
-#define JITTER_TIME (20)
-#define MIN_TIME    (64 - JITTER_TIME)
-#define MAX_TIME    (80 + JITTER_TIME)
+#define MIN_TIME (LFRFID_FSK_MIN_TIME_US)
+#define MAX_TIME (LFRFID_FSK_MAX_TIME_US)
 
 #define AWID_DECODED_DATA_SIZE (9)
 
@@ -31,14 +30,18 @@ typedef struct {
     uint8_t data[AWID_DECODED_DATA_SIZE];
 } ProtocolAwid;
 
-ProtocolAwid* protocol_awid_alloc(void) {
+ProtocolAwid* protocol_awid_alloc_shared(ProtocolShared* shared) {
     ProtocolAwid* protocol = malloc(sizeof(ProtocolAwid));
-    protocol->decoder.fsk_demod = fsk_demod_alloc(MIN_TIME, 6, MAX_TIME, 5);
+    protocol->decoder.fsk_demod = fsk_demod_alloc_shared(shared, MIN_TIME, 6, MAX_TIME, 5);
     protocol->encoder.fsk_osc = fsk_osc_alloc(8, 10, 50);
 
     return protocol;
 }
 
+ProtocolAwid* protocol_awid_alloc(void) {
+    return protocol_awid_alloc_shared(NULL);
+}
+
 void protocol_awid_free(ProtocolAwid* protocol) {
     fsk_demod_free(protocol->decoder.fsk_demod);
     fsk_osc_free(protocol->encoder.fsk_osc);
@@ -248,6 +251,7 @@ const ProtocolBase protocol_awid = {
     .features = LFRFIDFeatureASK,
     .validate_count = 3,
     .alloc = (ProtocolAlloc)protocol_awid_alloc,
+    .alloc_shared = (ProtocolAllocShared)protocol_awid_alloc_shared,
     .free = (ProtocolFree)protocol_awid_free,
     .get_data = (ProtocolGetData)protocol_awid_get_data,
     .decoder =
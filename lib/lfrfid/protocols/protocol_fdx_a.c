@@ -5,9 +5,8 @@
 #include "lfrfid_protocols.h"
 #include <bit_lib/bit_lib.h>
 
-#define JITTER_TIME (20)
-#define MIN_TIME    (64 - JITTER_TIME)
-#define MAX_TIME    (80 + JITTER_TIME)
+#define MIN_TIME (LFRFID_FSK_MIN_TIME_US)
+#define MAX_TIME (LFRFID_FSK_MAX_TIME_US)
 
 #define FDXA_DATA_SIZE     10
 #define FDXA_PREAMBLE_SIZE 2
@@ -38,14 +37,18 @@ typedef struct {
     size_t protocol_size;
 } ProtocolFDXA;
 
-ProtocolFDXA* protocol_fdx_a_alloc(void) {
+ProtocolFDXA* protocol_fdx_a_alloc_shared(ProtocolShared* shared) {
     ProtocolFDXA* protocol = malloc(sizeof(ProtocolFDXA));
-    protocol->decoder.fsk_demod = fsk_demod_alloc(MIN_TIME, 6, MAX_TIME, 5);
+    protocol->decoder.fsk_demod = fsk_demod_alloc_shared(shared, MIN_TIME, 6, MAX_TIME, 5);
     protocol->encoder.fsk_osc = fsk_osc_alloc(8, 10, 50);
 
     return protocol;
 }
 
+ProtocolFDXA* protocol_fdx_a_alloc(void) {
+    return protocol_fdx_a_alloc_shared(NULL);
+}
+
 void protocol_fdx_a_free(ProtocolFDXA* protocol) {
     fsk_demod_free(protocol->decoder.fsk_demod);
     fsk_osc_free(protocol->encoder.fsk_osc);
@@ -230,6 +233,7 @@ const ProtocolBase protocol_fdx_a = {
     .features = LFRFIDFeatureASK,
     .validate_count = 3,
     .alloc = (ProtocolAlloc)protocol_fdx_a_alloc,
+    .alloc_shared = (ProtocolAllocShared)protocol_fdx_a_alloc_shared,
     .free = (ProtocolFree)protocol_fdx_a_free,
     .get_data = (ProtocolGetData)protocol_fdx_a_get_data,
     .decoder =
@@ -4,9 +4,8 @@
 #include <lfrfid/tools/fsk_osc.h>
 #include "lfrfid_protocols.h"
 
-#define JITTER_TIME (20)
-#define MIN_TIME    (64 - JITTER_TIME)
-#define MAX_TIME    (80 + JITTER_TIME)
+#define MIN_TIME (LFRFID_FSK_MIN_TIME_US)
+#define MAX_TIME (LFRFID_FSK_MAX_TIME_US)
 
 #define H10301_DECODED_DATA_SIZE     (3)
 #define H10301_ENCODED_DATA_SIZE_U32 (3)
@@ -32,14 +31,18 @@ typedef struct {
     uint8_t data[H10301_DECODED_DATA_SIZE];
 } ProtocolH10301;
 
-ProtocolH10301* protocol_h10301_alloc(void) {
+ProtocolH10301* protocol_h10301_alloc_shared(ProtocolShared* shared) {
     ProtocolH10301* protocol = malloc(sizeof(ProtocolH10301));
-    protocol->decoder.fsk_demod = fsk_demod_alloc(MIN_TIME, 6, MAX_TIME, 5);
+    protocol->decoder.fsk_demod = fsk_demod_alloc_shared(shared, MIN_TIME, 6, MAX_TIME, 5);
     protocol->encoder.fsk_osc = fsk_osc_alloc(8, 10, 50);
 
     return protocol;
 }
 
+ProtocolH10301* protocol_h10301_alloc(void) {
+    return protocol_h10301_alloc_shared(NULL);
+}
+
 void protocol_h10301_free(ProtocolH10301* protocol) {
     fsk_demod_free(protocol->decoder.fsk_demod);
     fsk_osc_free(protocol->encoder.fsk_osc);
@@ -372,6 +375,7 @@ const ProtocolBase protocol_h10301 = {
     .features = LFRFIDFeatureASK,
     .validate_count = 3,
     .alloc = (ProtocolAlloc)protocol_h10301_alloc,
+    .alloc_shared = (ProtocolAllocShared)protocol_h10301_alloc_shared,
     .free = (ProtocolFree)protocol_h10301_free,
     .get_data = (ProtocolGetData)protocol_h10301_get_data,
     .decoder =
@@ -5,9 +5,8 @@
 #include "lfrfid_protocols.h"
 #include <bit_lib/bit_lib.h>
 
-#define JITTER_TIME (20)
-#define MIN_TIME    (64 - JITTER_TIME)
-#define MAX_TIME    (80 + JITTER_TIME)
+#define MIN_TIME (LFRFID_FSK_MIN_TIME_US)
+#define MAX_TIME (LFRFID_FSK_MAX_TIME_US)
 
 #define HID_DATA_SIZE             11
 #define HID_PREAMBLE_SIZE         1
@@ -37,14 +36,18 @@ typedef struct {
     uint8_t data[HID_DECODED_DATA_SIZE];
 } ProtocolHID;
 
-ProtocolHID* protocol_hid_generic_alloc(void) {
+ProtocolHID* protocol_hid_generic_alloc_shared(ProtocolShared* shared) {
     ProtocolHID* protocol = malloc(sizeof(ProtocolHID));
-    protocol->decoder.fsk_demod = fsk_demod_alloc(MIN_TIME, 6, MAX_TIME, 5);
+    protocol->decoder.fsk_demod = fsk_demod_alloc_shared(shared, MIN_TIME, 6, MAX_TIME, 5);
     protocol->encoder.fsk_osc = fsk_osc_alloc(8, 10, 50);
 
     return protocol;
 }
 
+ProtocolHID* protocol_hid_generic_alloc(void) {
+    return protocol_hid_generic_alloc_shared(NULL);
+}
+
 void protocol_hid_generic_free(ProtocolHID* protocol) {
     fsk_demod_free(protocol->decoder.fsk_demod);
     fsk_osc_free(protocol->encoder.fsk_osc);
@@ -270,6 +273,7 @@ const ProtocolBase protocol_hid_generic = {
     .features = LFRFIDFeatureASK,
     .validate_count = 6,
     .alloc = (ProtocolAlloc)protocol_hid_generic_alloc,
+    .alloc_shared = (ProtocolAllocShared)protocol_hid_generic_alloc_shared,
     .free = (ProtocolFree)protocol_hid_generic_free,
     .get_data = (ProtocolGetData)protocol_hid_generic_get_data,
     .decoder =
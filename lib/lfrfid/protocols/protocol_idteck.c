@@ -18,7 +18,7 @@
 #define IDTECK_DECODED_BIT_SIZE  (64)
 #define IDTECK_DECODED_DATA_SIZE (8)
 
-#define IDTECK_US_PER_BIT             (255)
+#define IDTECK_US_PER_BIT             (LFRFID_PSK_US_PER_BIT)
 #define IDTECK_ENCODER_PULSES_PER_BIT (16)
 
 typedef struct {
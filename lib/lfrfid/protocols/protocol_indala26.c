@@ -14,7 +14,7 @@
 #define INDALA26_DECODED_BIT_SIZE  (28)
 #define INDALA26_DECODED_DATA_SIZE (4)
 
-#define INDALA26_US_PER_BIT             (255)
+#define INDALA26_US_PER_BIT             (LFRFID_PSK_US_PER_BIT)
 #define INDALA26_ENCODER_PULSES_PER_BIT (16)
 
 typedef struct {
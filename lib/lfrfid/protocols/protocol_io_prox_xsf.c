@@ -5,9 +5,8 @@
 #include <bit_lib/bit_lib.h>
 #include "lfrfid_protocols.h"
 
-#define JITTER_TIME (20)
-#define MIN_TIME    (64 - JITTER_TIME)
-#define MAX_TIME    (80 + JITTER_TIME)
+#define MIN_TIME (LFRFID_FSK_MIN_TIME_US)
+#define MAX_TIME (LFRFID_FSK_MAX_TIME_US)
 
 #define IOPROXXSF_DECODED_DATA_SIZE (4)
 #define IOPROXXSF_ENCODED_DATA_SIZE (8)
@@ -31,13 +30,17 @@ typedef struct {
     uint8_t data[IOPROXXSF_DECODED_DATA_SIZE];
 } ProtocolIOProxXSF;
 
-ProtocolIOProxXSF* protocol_io_prox_xsf_alloc(void) {
+ProtocolIOProxXSF* protocol_io_prox_xsf_alloc_shared(ProtocolShared* shared) {
     ProtocolIOProxXSF* protocol = malloc(sizeof(ProtocolIOProxXSF));
-    protocol->decoder.fsk_demod = fsk_demod_alloc(MIN_TIME, 8, MAX_TIME, 6);
+    protocol->decoder.fsk_demod = fsk_demod_alloc_shared(shared, MIN_TIME, 8, MAX_TIME, 6);
     protocol->encoder.fsk_osc = fsk_osc_alloc(8, 10, 64);
     return protocol;
 }
 
+ProtocolIOProxXSF* protocol_io_prox_xsf_alloc(void) {
+    return protocol_io_prox_xsf_alloc_shared(NULL);
+}
+
 void protocol_io_prox_xsf_free(ProtocolIOProxXSF* protocol) {
     fsk_demod_free(protocol->decoder.fsk_demod);
     fsk_osc_free(protocol->encoder.fsk_osc);
@@ -283,6 +286,7 @@ const ProtocolBase protocol_io_prox_xsf = {
     .features = LFRFIDFeatureASK,
     .validate_count = 3,
     .alloc = (ProtocolAlloc)protocol_io_prox_xsf_alloc,
+    .alloc_shared = (ProtocolAllocShared)protocol_io_prox_xsf_alloc_shared,
     .free = (ProtocolFree)protocol_io_prox_xsf_free,
     .get_data = (ProtocolGetData)protocol_io_prox_xsf_get_data,
     .decoder =
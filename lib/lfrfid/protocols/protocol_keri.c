@@ -13,7 +13,7 @@
 #define KERI_DECODED_BIT_SIZE  (28)
 #define KERI_DECODED_DATA_SIZE (4)
 
-#define KERI_US_PER_BIT             (255)
+#define KERI_US_PER_BIT             (LFRFID_PSK_US_PER_BIT)
 #define KERI_ENCODER_PULSES_PER_BIT (16)
 
 typedef struct {
@@ -12,7 +12,7 @@
 #define NEXWATCH_DECODED_BIT_SIZE  (NEXWATCH_DECODED_DATA_SIZE * 8)
 #define NEXWATCH_DECODED_DATA_SIZE (8)
 
-#define NEXWATCH_US_PER_BIT             (255)
+#define NEXWATCH_US_PER_BIT             (LFRFID_PSK_US_PER_BIT)
 #define NEXWATCH_ENCODER_PULSES_PER_BIT (16)
 
 typedef struct {
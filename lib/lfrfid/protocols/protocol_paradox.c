@@ -5,9 +5,8 @@
 #include <bit_lib/bit_lib.h>
 #include "lfrfid_protocols.h"
 
-#define JITTER_TIME (20)
-#define MIN_TIME    (64 - JITTER_TIME)
-#define MAX_TIME    (80 + JITTER_TIME)
+#define MIN_TIME (LFRFID_FSK_MIN_TIME_US)
+#define MAX_TIME (LFRFID_FSK_MAX_TIME_US)
 
 #define PARADOX_DECODED_DATA_SIZE (6)
 
@@ -32,14 +31,18 @@ typedef struct {
     uint8_t data[PARADOX_DECODED_DATA_SIZE];
 } ProtocolParadox;
 
-ProtocolParadox* protocol_paradox_alloc(void) {
+ProtocolParadox* protocol_paradox_alloc_shared(ProtocolShared* shared) {
     ProtocolParadox* protocol = malloc(sizeof(ProtocolParadox));
-    protocol->decoder.fsk_demod = fsk_demod_alloc(MIN_TIME, 6, MAX_TIME, 5);
+    protocol->decoder.fsk_demod = fsk_demod_alloc_shared(shared, MIN_TIME, 6, MAX_TIME, 5);
     protocol->encoder.fsk_osc = fsk_osc_alloc(8, 10, 50);
 
     return protocol;
 }
 
+ProtocolParadox* protocol_paradox_alloc(void) {
+    return protocol_paradox_alloc_shared(NULL);
+}
+
 void protocol_paradox_free(ProtocolParadox* protocol) {
     fsk_demod_free(protocol->decoder.fsk_demod);
     fsk_osc_free(protocol->encoder.fsk_osc);
@@ -231,6 +234,7 @@ const ProtocolBase protocol_paradox = {
     .features = LFRFIDFeatureASK,
     .validate_count = 3,
     .alloc = (ProtocolAlloc)protocol_paradox_alloc,
+    .alloc_shared = (ProtocolAllocShared)protocol_paradox_alloc_shared,
     .free = (ProtocolFree)protocol_paradox_free,
     .get_data = (ProtocolGetData)protocol_paradox_get_data,
     .decoder =
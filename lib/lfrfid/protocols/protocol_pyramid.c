@@ -5,9 +5,8 @@
 #include "lfrfid_protocols.h"
 #include <bit_lib/bit_lib.h>
 
-#define JITTER_TIME (20)
-#define MIN_TIME    (64 - JITTER_TIME)
-#define MAX_TIME    (80 + JITTER_TIME)
+#define MIN_TIME (LFRFID_FSK_MIN_TIME_US)
+#define MAX_TIME (LFRFID_FSK_MAX_TIME_US)
 
 #define PYRAMID_DATA_SIZE     13
 #define PYRAMID_PREAMBLE_SIZE 3
@@ -35,14 +34,18 @@ typedef struct {
     uint8_t data[PYRAMID_DECODED_DATA_SIZE];
 } ProtocolPyramid;
 
-ProtocolPyramid* protocol_pyramid_alloc(void) {
+ProtocolPyramid* protocol_pyramid_alloc_shared(ProtocolShared* shared) {
     ProtocolPyramid* protocol = malloc(sizeof(ProtocolPyramid));
-    protocol->decoder.fsk_demod = fsk_demod_alloc(MIN_TIME, 6, MAX_TIME, 5);
+    protocol->decoder.fsk_demod = fsk_demod_alloc_shared(shared, MIN_TIME, 6, MAX_TIME, 5);
     protocol->encoder.fsk_osc = fsk_osc_alloc(8, 10, 50);
 
     return protocol;
 }
 
+ProtocolPyramid* protocol_pyramid_alloc(void) {
+    return protocol_pyramid_alloc_shared(NULL);
+}
+
 void protocol_pyramid_free(ProtocolPyramid* protocol) {
     fsk_demod_free(protocol->decoder.fsk_demod);
     fsk_osc_free(protocol->encoder.fsk_osc);
@@ -265,6 +268,7 @@ const ProtocolBase protocol_pyramid = {
     .features = LFRFIDFeatureASK,
     .validate_count = 3,
     .alloc = (ProtocolAlloc)protocol_pyramid_alloc,
+    .alloc_shared = (ProtocolAllocShared)protocol_pyramid_alloc_shared,
     .free = (ProtocolFree)protocol_pyramid_free,
     .get_data = (ProtocolGetData)protocol_pyramid_get_data,
     .decoder =
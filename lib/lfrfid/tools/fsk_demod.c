@@ -1,7 +1,19 @@
 #include <furi.h>
 #include "fsk_demod.h"
 
-struct FSKDemod {
+/**
+ * Demodulator state shared by the FSKDemod instances of one ProtocolDict that were allocated
+ * with the same timings. The dict feeds its protocols the same sample one after another, so
+ * the first instance that sees a sample runs the demodulator and the rest reuse its result.
+ */
+typedef struct FSKDemodCore FSKDemodCore;
+
+typedef struct {
+    ProtocolShared* shared;
+    FSKDemodCore* cores;
+} FSKDemodCoreList;
+
+struct FSKDemodCore {
     uint32_t low_time;
     uint32_t low_pulses;
     uint32_t hi_time;
@@ -12,12 +24,66 @@ struct FSKDemod {
     uint32_t time;
     uint32_t count;
     bool last_pulse;
+
+    // last processed sample number and its result
+    uint32_t sample;
+    bool output_value;
+    uint32_t output_count;
+
+    // NULL for a standalone instance
+    FSKDemodCoreList* list;
+    size_t ref_count;
+    FSKDemodCore* next;
+};
+
+struct FSKDemod {
+    FSKDemodCore* core;
 };
 
+static const char fsk_demod_shared_key = 0;
+
+static void fsk_demod_core_list_free(FSKDemodCoreList* list) {
+    // Protocols, and so their demodulators, are freed before the shared state
+    furi_check(list->cores == NULL);
+    free(list);
+}
+
+static FSKDemodCoreList* fsk_demod_core_list_get(ProtocolShared* shared) {
+    FSKDemodCoreList* list = protocol_shared_get(shared, &fsk_demod_shared_key);
+
+    if(!list) {
+        list = malloc(sizeof(FSKDemodCoreList));
+        list->shared = shared;
+        protocol_shared_set(
+            shared, &fsk_demod_shared_key, list, (ProtocolSharedFree)fsk_demod_core_list_free);
+    }
+
+    return list;
+}
+
+static bool fsk_demod_core_match(
+    const FSKDemodCore* core,
+    uint32_t low_time,
+    uint32_t low_pulses,
+    uint32_t hi_time,
+    uint32_t hi_pulses) {
+    return core->low_time == low_time && core->low_pulses == low_pulses &&
+           core->hi_time == hi_time && core->hi_pulses == hi_pulses;
+}
+
 FSKDemod*
     fsk_demod_alloc(uint32_t low_time, uint32_t low_pulses, uint32_t hi_time, uint32_t hi_pulses) {
+    return fsk_demod_alloc_shared(NULL, low_time, low_pulses, hi_time, hi_pulses);
+}
+
+FSKDemod* fsk_demod_alloc_shared(
+    ProtocolShared* shared,
+    uint32_t low_time,
+    uint32_t low_pulses,
+    uint32_t hi_time,
+    uint32_t hi_pulses) {
     FSKDemod* demod = malloc(sizeof(FSKDemod));
-    demod->invert = false;
+    bool invert = false;
 
     if(low_time > hi_time) {
         uint32_t tmp;
@@ -29,65 +95,130 @@ FSKDemod*
         hi_pulses = low_pulses;
         low_pulses = tmp;
 
-        demod->invert = true;
+        invert = true;
     }
 
-    demod->low_time = low_time;
-    demod->low_pulses = low_pulses;
-    demod->hi_time = hi_time;
-    demod->hi_pulses = hi_pulses;
+    FSKDemodCoreList* list = shared ? fsk_demod_core_list_get(shared) : NULL;
+
+    if(list) {
+        for(FSKDemodCore* core = list->cores; core; core = core->next) {
+            if(fsk_demod_core_match(core, low_time, low_pulses, hi_time, hi_pulses) &&
+               core->invert == invert) {
+                core->ref_count++;
+                demod->core = core;
+                return demod;
+            }
+        }
+    }
 
-    demod->mid_time = (hi_time - low_time) / 2 + low_time;
-    demod->time = 0;
-    demod->count = 0;
-    demod->last_pulse = false;
+    FSKDemodCore* core = malloc(sizeof(FSKDemodCore));
+    core->invert = invert;
+
+    core->low_time = low_time;
+    core->low_pulses = low_pulses;
+    core->hi_time = hi_time;
+    core->hi_pulses = hi_pulses;
+
+    core->mid_time = (hi_time - low_time) / 2 + low_time;
+    core->time = 0;
+    core->count = 0;
+    core->last_pulse = false;
+
+    core->sample = list ? protocol_shared_get_sample(shared) : 0;
+    core->output_value = false;
+    core->output_count = 0;
+
+    core->list = list;
+    core->ref_count = 1;
+    core->next = NULL;
+
+    if(list) {
+        core->next = list->cores;
+        list->cores = core;
+    }
+
+    demod->core = core;
 
     return demod;
 }
 
 void fsk_demod_free(FSKDemod* demod) {
+    FSKDemodCore* core = demod->core;
+
+    core->ref_count--;
+    if(core->ref_count == 0) {
+        if(core->list) {
+            FSKDemodCore** item = &core->list->cores;
+            while(*item != core) {
+                item = &(*item)->next;
+            }
+            *item = core->next;
+        }
+        free(core);
+    }
+
     free(demod);
 }
 
-void fsk_demod_feed(FSKDemod* demod, bool polarity, uint32_t time, bool* value, uint32_t* count) {
-    *count = 0;
+static void fsk_demod_core_feed(FSKDemodCore* core, bool polarity, uint32_t time) {
+    core->output_count = 0;
 
     if(polarity) {
         // accumulate time
-        demod->time = time;
+        core->time = time;
     } else {
-        demod->time += time;
+        core->time += time;
 
         // check for valid pulse
-        if(demod->time >= demod->low_time && demod->time < demod->hi_time) {
+        if(core->time >= core->low_time && core->time < core->hi_time) {
             bool pulse;
 
-            if(demod->time < demod->mid_time) {
+            if(core->time < core->mid_time) {
                 pulse = false;
             } else {
                 pulse = true;
             }
 
-            demod->count++;
+            core->count++;
 
             // check for edge transition
-            if(demod->last_pulse != pulse) {
-                uint32_t data_count = demod->count + 1;
+            if(core->last_pulse != pulse) {
+                uint32_t data_count = core->count + 1;
 
-                if(demod->last_pulse) {
-                    data_count /= demod->hi_pulses;
-                    *value = !demod->invert;
+                if(core->last_pulse) {
+                    data_count /= core->hi_pulses;
+                    core->output_value = !core->invert;
                 } else {
-                    data_count /= demod->low_pulses;
-                    *value = demod->invert;
+                    data_count /= core->low_pulses;
+                    core->output_value = core->invert;
                 }
 
-                *count = data_count;
-                demod->count = 0;
-                demod->last_pulse = pulse;
+                core->output_count = data_count;
+                core->count = 0;
+                core->last_pulse = pulse;
             }
         } else {
-            demod->count = 0;
+            core->count = 0;
+        }
+    }
+}
+
+void fsk_demod_feed(FSKDemod* demod, bool polarity, uint32_t time, bool* value, uint32_t* count) {
+    FSKDemodCore* core = demod->core;
+
+    if(!core->list) {
+        fsk_demod_core_feed(core, polarity, time);
+    } else {
+        // reuse the result if another protocol of the dict already processed this sample
+        const uint32_t sample = protocol_shared_get_sample(core->list->shared);
+        if(core->sample != sample) {
+            fsk_demod_core_feed(core, polarity, time);
+            core->sample = sample;
         }
     }
+
+    *count = core->output_count;
+    if(core->output_count) {
+        *value = core->output_value;
+    }
 }
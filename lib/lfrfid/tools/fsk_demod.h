@@ -1,6 +1,7 @@
 #pragma once
 #include <stdint.h>
 #include <stdbool.h>
+#include <toolbox/protocols/protocol.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -21,6 +22,28 @@ typedef struct FSKDemod FSKDemod;
 FSKDemod*
     fsk_demod_alloc(uint32_t low_time, uint32_t low_pulses, uint32_t hi_time, uint32_t hi_pulses);
 
+/**
+ * @brief Allocate a new FSKDemod instance for a protocol of a ProtocolDict
+ * 
+ * Instances of one ProtocolDict with the same timings share one demodulator
+ * state, so the signal is demodulated once per sample no matter how many
+ * protocols listen to it. Such instances must only be fed through the
+ * ProtocolDict decoders.
+ * 
+ * @param shared ProtocolShared instance of the ProtocolDict, NULL for a standalone instance
+ * @param low_time time between rising edges for the 0 bit
+ * @param low_pulses rising edges count for the 0 bit
+ * @param hi_time time between rising edges for the 1 bit
+ * @param hi_pulses rising edges count for the 1 bit
+ * @return FSKDemod* 
+ */
+FSKDemod* fsk_demod_alloc_shared(
+    ProtocolShared* shared,
+    uint32_t low_time,
+    uint32_t low_pulses,
+    uint32_t hi_time,
+    uint32_t hi_pulses);
+
 /**
  * @brief Free a FSKDemod instance
  * 
@@ -19,6 +19,7 @@
 #define CS_COMMON_CS_FILE_H_
 
 #include "platform.h"
+#include "mg_str.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -33,6 +34,25 @@ extern "C" {
  */
 char *cs_read_file(const char *path, size_t *size);
 
+/*
+ * Write `chunks_cnt` memory chunks to file `path`, replacing its contents.
+ * Return: 1 on success, 0 on error.
+ */
+int cs_write_file(const char *path, const struct mg_str *chunks, size_t chunks_cnt);
+
+/*
+ * Calculate MD5 hash of file `path` without reading it in memory at once.
+ * Return: 1 on success, 0 on error.
+ */
+int cs_hash_file(const char *path, unsigned char hash[16]);
+
+/*
+ * Return allocated path of the bytecode cache file for the script `path`.
+ * Caller has to `free()` it.
+ * Return: allocated memory, or NULL if the script can't be cached.
+ */
+char *cs_jsc_path(const char *path);
+
 #ifdef CS_MMAP
 /*
  * Only on platforms which support mmapping: mmap file `path` to the returned
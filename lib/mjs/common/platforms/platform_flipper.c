@@ -1,5 +1,9 @@
 #include <furi.h>
 #include <toolbox/stream/file_stream.h>
+#include <toolbox/md5_calc.h>
+#include <toolbox/crc32_calc.h>
+#include "../cs_crc32.h"
+#include "../cs_file.h"
 #include "../cs_dbg.h"
 #include "../frozen/frozen.h"
 
@@ -29,6 +33,54 @@ char* cs_read_file(const char* path, size_t* size) {
     return data;
 }
 
+int cs_write_file(const char* path, const struct mg_str* chunks, size_t chunks_cnt) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    bool result = storage_file_open(file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS);
+    for(size_t i = 0; result && i < chunks_cnt; i++) {
+        result = storage_file_write(file, chunks[i].p, chunks[i].len) == chunks[i].len;
+    }
+    storage_file_close(file);
+    if(!result) {
+        storage_common_remove(storage, path);
+    }
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+    return result;
+}
+
+int cs_hash_file(const char* path, unsigned char hash[16]) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    bool result = md5_calc_file(file, path, hash, NULL);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+    return result;
+}
+
+#define CS_JSC_APP_DIR   EXT_PATH("apps_data/js_app")
+#define CS_JSC_CACHE_DIR CS_JSC_APP_DIR "/.cache"
+
+char* cs_jsc_path(const char* path) {
+    // Keep caches out of the script folders, one file per script path
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    bool result = storage_simply_mkdir(storage, EXT_PATH("apps_data")) &&
+                  storage_simply_mkdir(storage, CS_JSC_APP_DIR) &&
+                  storage_simply_mkdir(storage, CS_JSC_CACHE_DIR);
+    furi_record_close(RECORD_STORAGE);
+    if(!result) return NULL;
+
+    uint32_t path_hash = crc32_calc_buffer(0, path, strlen(path));
+    size_t size = sizeof(CS_JSC_CACHE_DIR "/00000000.jsc");
+    char* jsc_path = malloc(size);
+    snprintf(jsc_path, size, "%s/%08lX.jsc", CS_JSC_CACHE_DIR, path_hash);
+    return jsc_path;
+}
+
+uint32_t cs_crc32(uint32_t crc32, const void* data, size_t len) {
+    return crc32_calc_buffer(crc32, data, len);
+}
+
 char* json_fread(const char* path) {
     UNUSED(path);
     return NULL;
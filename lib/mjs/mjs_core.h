@@ -16,6 +16,25 @@ extern "C" {
 
 #define JUMP_INSTRUCTION_SIZE 2
 
+/* Number of interned property names, must be a power of 2 */
+#ifndef MJS_PROP_NAMES_CNT
+#define MJS_PROP_NAMES_CNT 32
+#endif
+
+/* Number of property lookup cache entries, must be a power of 2 */
+#ifndef MJS_PROP_CACHE_SIZE
+#define MJS_PROP_CACHE_SIZE 32
+#endif
+
+/*
+ * Lookups that have to walk past that many properties of an object are
+ * stored in the property lookup cache. Shorter walks are cheaper than cache
+ * maintenance.
+ */
+#ifndef MJS_PROP_CACHE_MIN_DEPTH
+#define MJS_PROP_CACHE_MIN_DEPTH 4
+#endif
+
 enum mjs_call_stack_frame_item {
     CALL_STACK_FRAME_ITEM_RETVAL_STACK_IDX, /* TOS */
     CALL_STACK_FRAME_ITEM_LOOP_ADDR_IDX,
@@ -36,6 +55,21 @@ struct mjs_vals {
    * "method invocation pattern".
    */
     mjs_val_t last_getprop_obj;
+
+    /*
+   * Interned names of properties longer than 5 chars (shorter ones are
+   * inlined into mjs_val_t), indexed by name hash. Objects that share a
+   * property name share a single owned string.
+   */
+    mjs_val_t prop_names[MJS_PROP_NAMES_CNT];
+};
+
+/*
+ * Property lookup cache entry: a property found in an object by name hash.
+ */
+struct mjs_prop_cache_entry {
+    struct mjs_object* obj;
+    struct mjs_property* prop;
 };
 
 struct mjs_bcode_part {
@@ -85,6 +119,8 @@ struct mjs {
     mjs_flags_poller_t exec_flags_poller;
     void* context;
 
+    struct mjs_prop_cache_entry prop_cache[MJS_PROP_CACHE_SIZE];
+
     struct gc_arena object_arena;
     struct gc_arena property_arena;
     struct gc_arena ffi_sig_arena;
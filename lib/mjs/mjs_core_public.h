@@ -257,8 +257,9 @@ const char* mjs_get_stack_trace(struct mjs* mjs);
  * Sets whether *.jsc files are generated when *.js file is executed. By
  * default it's 0.
  *
- * If either `MJS_GENERATE_JSC` or `CS_MMAP` is off, then this function has no
- * effect.
+ * If `MJS_GENERATE_JSC` and `CS_MMAP` are on, the .jsc file is mmapped. If
+ * `MJS_JSC_CACHE` is on, the .jsc file is used as a bytecode cache instead.
+ * Otherwise this function has no effect.
  */
 void mjs_set_generate_jsc(struct mjs* mjs, int generate_jsc);
 
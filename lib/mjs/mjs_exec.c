@@ -3,6 +3,7 @@
  * All rights reserved
  */
 
+#include "common/cs_crc32.h"
 #include "common/cs_file.h"
 #include "common/cs_varint.h"
 
@@ -23,6 +24,123 @@
 #include <sys/mman.h>
 #endif
 
+#if MJS_JSC_CACHE
+#define MJS_JSC_MAGIC (0x43534A4D) /* "MJSC" */
+/* Bump when the bcode format or the header changes */
+#define MJS_JSC_VERSION   (2)
+#define MJS_JSC_HASH_SIZE (16)
+
+struct mjs_jsc_header {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t op_max;
+    uint8_t source_hash[MJS_JSC_HASH_SIZE];
+    uint32_t bcode_len;
+    uint32_t bcode_crc32;
+};
+
+/*
+ * Returns allocated .jsc file name for the .js file `path`, or NULL if `path`
+ * does not have a .js extension or the platform has no place for it.
+ */
+static char* mjs_jsc_get_path(const char* path) {
+    const char* jsext = ".js";
+    size_t path_len = strlen(path);
+    size_t jsext_len = strlen(jsext);
+    if(path_len <= jsext_len || strcmp(path + path_len - jsext_len, jsext) != 0) {
+        return NULL;
+    }
+
+    return cs_jsc_path(path);
+}
+
+/*
+ * Loads bcode from .jsc file as a new bcode part. Returns 1 if the file is up
+ * to date with the source hash and the bcode format and its bcode is intact,
+ * 0 otherwise.
+ */
+static int mjs_jsc_load(
+    struct mjs* mjs,
+    const char* path,
+    const char* jsc_path,
+    const unsigned char* source_hash) {
+    struct mjs_jsc_header header;
+    struct mjs_bcode_part bp;
+    const size_t filename_off = 1 /* OP_BCODE_HEADER */ +
+                                sizeof(mjs_header_item_t) * MJS_HDR_ITEMS_CNT;
+    size_t path_size = strlen(path) + 1;
+    size_t size = 0;
+    char* data = cs_read_file(jsc_path, &size);
+    if(data == NULL) return 0;
+
+    if(size < sizeof(header)) goto fail;
+    memcpy(&header, data, sizeof(header));
+    if(header.magic != MJS_JSC_MAGIC || header.version != MJS_JSC_VERSION ||
+       header.op_max != OP_MAX || header.bcode_len != size - sizeof(header) ||
+       memcmp(header.source_hash, source_hash, MJS_JSC_HASH_SIZE) != 0) {
+        goto fail;
+    }
+
+    /* bcode header holds the script file name, which is used by load() */
+    if(header.bcode_len < filename_off + path_size ||
+       (uint8_t)data[sizeof(header)] != OP_BCODE_HEADER ||
+       memcmp(data + sizeof(header) + filename_off, path, path_size) != 0) {
+        goto fail;
+    }
+
+    /* corrupted bcode is never executed: a partial write or a bad sector
+     * would otherwise send the interpreter off the end of the buffer */
+    if(cs_crc32(0, data + sizeof(header), header.bcode_len) != header.bcode_crc32) {
+        LOG(LL_WARN, ("%s: bcode checksum mismatch", jsc_path));
+        goto fail;
+    }
+
+    memmove(data, data + sizeof(header), header.bcode_len);
+
+    memset(&bp, 0, sizeof(bp));
+    bp.data.p = data;
+    bp.data.len = header.bcode_len;
+    bp.start_idx = mjs->bcode_len;
+    bp.exec_res = MJS_ERRS_CNT;
+    mjs_bcode_part_add(mjs, &bp);
+    mjs->bcode_len += bp.data.len;
+    return 1;
+
+fail:
+    free(data);
+    return 0;
+}
+
+/*
+ * Stores the last bcode part into .jsc file for the .js file `path`,
+ * keyed by `source_hash` of the source it was compiled from
+ */
+static void mjs_jsc_save(struct mjs* mjs, const char* path, const unsigned char* source_hash) {
+    struct mjs_jsc_header header;
+    char* jsc_path = mjs_jsc_get_path(path);
+    if(jsc_path == NULL) return;
+
+    struct mjs_bcode_part* bp = mjs_bcode_part_get(mjs, mjs_bcode_parts_cnt(mjs) - 1);
+    memset(&header, 0, sizeof(header));
+    header.magic = MJS_JSC_MAGIC;
+    header.version = MJS_JSC_VERSION;
+    header.op_max = OP_MAX;
+    memcpy(header.source_hash, source_hash, MJS_JSC_HASH_SIZE);
+    header.bcode_len = bp->data.len;
+    header.bcode_crc32 = cs_crc32(0, bp->data.p, bp->data.len);
+
+    struct mg_str chunks[] = {
+        mg_mk_str_n((const char*)&header, sizeof(header)),
+        mg_mk_str_n(bp->data.p, bp->data.len),
+    };
+    if(!cs_write_file(jsc_path, chunks, 2)) {
+        LOG(LL_WARN, ("Failed to write %s", jsc_path));
+    }
+
+    free(jsc_path);
+}
+#endif
+
 /*
  * Pushes call stack frame. Offset is a global bcode offset. Retval_stack_idx
  * is an index in mjs->stack at which return value should be written later.
@@ -1064,6 +1182,7 @@ MJS_PRIVATE mjs_err_t mjs_exec_internal(
     const char* path,
     const char* src,
     int generate_jsc,
+    const unsigned char* source_hash,
     mjs_val_t* res) {
     size_t off = mjs->bcode_len;
     mjs_val_t r = MJS_UNDEFINED;
@@ -1135,8 +1254,14 @@ MJS_PRIVATE mjs_err_t mjs_exec_internal(
                 }
             }
         }
+#elif MJS_JSC_CACHE
+        if(generate_jsc && path != NULL) {
+            LOG(LL_INFO, ("%s compiled, storing bcode cache", path));
+            if(source_hash != NULL) mjs_jsc_save(mjs, path, source_hash);
+        }
 #else
         (void)generate_jsc;
+        (void)source_hash;
 #endif
 
         mjs_execute(mjs, off, &r);
@@ -1146,14 +1271,40 @@ MJS_PRIVATE mjs_err_t mjs_exec_internal(
 }
 
 mjs_err_t mjs_exec(struct mjs* mjs, const char* src, mjs_val_t* res) {
-    return mjs_exec_internal(mjs, "<stdin>", src, 0 /* generate_jsc */, res);
+    return mjs_exec_internal(mjs, "<stdin>", src, 0 /* generate_jsc */, NULL, res);
 }
 
 mjs_err_t mjs_exec_file(struct mjs* mjs, const char* path, mjs_val_t* res) {
     mjs_err_t error = MJS_FILE_READ_ERROR;
     mjs_val_t r = MJS_UNDEFINED;
     size_t size;
-    char* source_code = cs_read_file(path, &size);
+    char* source_code;
+    const unsigned char* source_hash = NULL;
+
+#if MJS_JSC_CACHE
+    /* hashed once: the digest keys both the lookup and the store on a miss */
+    unsigned char source_hash_buf[MJS_JSC_HASH_SIZE];
+    if(mjs->generate_jsc) {
+        char* jsc_path = mjs_jsc_get_path(path);
+        if(jsc_path != NULL && cs_hash_file(path, source_hash_buf)) {
+            source_hash = source_hash_buf;
+        }
+        int loaded = source_hash != NULL && mjs_jsc_load(mjs, path, jsc_path, source_hash);
+        free(jsc_path);
+
+        if(loaded) {
+            struct mjs_bcode_part* bp = mjs_bcode_part_get(mjs, mjs_bcode_parts_cnt(mjs) - 1);
+            size_t off = mjs->bcode_len - bp->data.len;
+            LOG(LL_INFO, ("%s loaded from bcode cache", path));
+            mjs->error = MJS_OK;
+            mjs_execute(mjs, off, &r);
+            error = mjs->error;
+            goto clean;
+        }
+    }
+#endif
+
+    source_code = cs_read_file(path, &size);
 
     if(source_code == NULL) {
         error = MJS_FILE_READ_ERROR;
@@ -1162,7 +1313,7 @@ mjs_err_t mjs_exec_file(struct mjs* mjs, const char* path, mjs_val_t* res) {
     }
 
     r = MJS_UNDEFINED;
-    error = mjs_exec_internal(mjs, path, source_code, -1, &r);
+    error = mjs_exec_internal(mjs, path, source_code, -1, source_hash, &r);
     free(source_code);
 
 clean:
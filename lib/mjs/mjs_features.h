@@ -30,4 +30,15 @@
 #endif
 #endif
 
+/*
+ * MJS_JSC_CACHE: if enabled, and if mmapping is not available, then execution
+ * of any .js file with `mjs_set_generate_jsc()` turned on stores precompiled
+ * bcode in a .jsc file at the place given by `cs_jsc_path()`. The .jsc file
+ * is keyed by the source hash and the bcode format version, and is read back
+ * instead of parsing the source on the next run.
+ */
+#if !defined(MJS_JSC_CACHE)
+#define MJS_JSC_CACHE (!MJS_GENERATE_JSC)
+#endif
+
 #endif /* MJS_FEATURES_H_ */
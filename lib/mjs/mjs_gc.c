@@ -500,6 +500,9 @@ void mjs_gc(struct mjs* mjs, int full) {
     gc_sweep(mjs, &mjs->property_arena, 0);
     gc_sweep(mjs, &mjs->ffi_sig_arena, 0);
 
+    /* Swept properties and objects may be reused by the next allocation */
+    mjs_prop_cache_reset(mjs);
+
     if(full) {
         /*
      * In case of full GC, we also resize strings buffer, but we still leave
@@ -50,29 +50,90 @@ int mjs_is_object_based(mjs_val_t v) {
            ((v & MJS_TAG_MASK) == MJS_TAG_ARRAY_BUF_VIEW);
 }
 
+/* FNV-1a hash of the property name */
+static uint32_t mjs_prop_name_hash(const char* name, size_t len) {
+    uint32_t hash = 2166136261U;
+    size_t i;
+    for(i = 0; i < len; i++) {
+        hash ^= (uint8_t)name[i];
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+/*
+ * Returns property name value for the given name. Names that don't fit into
+ * mjs_val_t are interned, so that objects with the same property names don't
+ * hold a copy of the name each. If `name_v` is a string, it is reused instead
+ * of copying `name`, which may point into the owned strings buffer.
+ */
+static mjs_val_t mjs_prop_name_intern(
+    struct mjs* mjs,
+    mjs_val_t name_v,
+    const char* name,
+    size_t len,
+    uint32_t hash) {
+    mjs_val_t* atom;
+
+    if(len <= 5) {
+        return mjs_mk_string(mjs, name, len, 1);
+    }
+
+    atom = &mjs->vals.prop_names[hash & (MJS_PROP_NAMES_CNT - 1)];
+    if(!mjs_is_string(*atom) || mjs_strcmp(mjs, atom, name, len) != 0) {
+        *atom = mjs_is_string(name_v) ? name_v : mjs_mk_string(mjs, name, len, 1);
+    }
+    return *atom;
+}
+
+static struct mjs_prop_cache_entry*
+    mjs_prop_cache_entry_get(struct mjs* mjs, struct mjs_object* o, uint32_t hash) {
+    uint32_t idx = hash ^ (uint32_t)((uintptr_t)o >> 2);
+    return &mjs->prop_cache[idx & (MJS_PROP_CACHE_SIZE - 1)];
+}
+
+MJS_PRIVATE void mjs_prop_cache_reset(struct mjs* mjs) {
+    memset(mjs->prop_cache, 0, sizeof(mjs->prop_cache));
+}
+
 MJS_PRIVATE struct mjs_property*
     mjs_get_own_property(struct mjs* mjs, mjs_val_t obj, const char* name, size_t len) {
     struct mjs_property* p;
     struct mjs_object* o;
+    struct mjs_prop_cache_entry* entry;
+    mjs_val_t ss = MJS_UNDEFINED;
+    uint32_t hash;
+    size_t depth = 0;
 
     if(!mjs_is_object_based(obj)) {
         return NULL;
     }
 
     o = get_object_struct(obj);
-
+    hash = mjs_prop_name_hash(name, len);
     if(len <= 5) {
-        mjs_val_t ss = mjs_mk_string(mjs, name, len, 1);
-        for(p = o->properties; p != NULL; p = p->next) {
-            if(p->name == ss) return p;
-        }
-    } else {
-        for(p = o->properties; p != NULL; p = p->next) {
-            if(mjs_strcmp(mjs, &p->name, name, len) == 0) return p;
-        }
+        /* Short names are inlined, so they can be compared by value */
+        ss = mjs_mk_string(mjs, name, len, 1);
+    }
+
+    entry = mjs_prop_cache_entry_get(mjs, o, hash);
+    p = entry->prop;
+    if(entry->obj == o && p->name_hash == hash &&
+       (len <= 5 ? p->name == ss : mjs_strcmp(mjs, &p->name, name, len) == 0)) {
         return p;
     }
 
+    for(p = o->properties; p != NULL; p = p->next, depth++) {
+        if(p->name_hash != hash) continue;
+        if(len <= 5 ? p->name == ss : mjs_strcmp(mjs, &p->name, name, len) == 0) {
+            if(depth >= MJS_PROP_CACHE_MIN_DEPTH) {
+                entry->obj = o;
+                entry->prop = p;
+            }
+            return p;
+        }
+    }
+
     return NULL;
 }
 
@@ -93,7 +154,10 @@ MJS_PRIVATE struct mjs_property*
 MJS_PRIVATE struct mjs_property*
     mjs_mk_property(struct mjs* mjs, mjs_val_t name, mjs_val_t value) {
     struct mjs_property* p = new_property(mjs);
+    size_t len;
+    const char* s = mjs_get_string(mjs, &name, &len);
     p->next = NULL;
+    p->name_hash = mjs_prop_name_hash(s, len);
     p->name = name;
     p->value = value;
     return p;
@@ -187,12 +251,11 @@ MJS_PRIVATE mjs_err_t mjs_set_internal(
         }
 
         /*
-     * name_v might be not a string here. In this case, we need to create a new
-     * `name_v`, which will be a string.
+     * name_v might be not a string here, or a string that is not shared with
+     * other objects. Use the canonical name value instead.
      */
-        if(!mjs_is_string(name_v)) {
-            name_v = mjs_mk_string(mjs, name, name_len, 1);
-        }
+        name_v = mjs_prop_name_intern(
+            mjs, name_v, name, name_len, mjs_prop_name_hash(name, name_len));
 
         p = mjs_mk_property(mjs, name_v, val);
 
@@ -220,6 +283,7 @@ MJS_PRIVATE void mjs_destroy_property(struct mjs_property** p) {
  */
 int mjs_del(struct mjs* mjs, mjs_val_t obj, const char* name, size_t len) {
     struct mjs_property *prop, *prev;
+    uint32_t hash;
 
     if(!mjs_is_object_based(obj)) {
         return -1;
@@ -227,16 +291,20 @@ int mjs_del(struct mjs* mjs, mjs_val_t obj, const char* name, size_t len) {
     if(len == (size_t)~0) {
         len = strlen(name);
     }
+    hash = mjs_prop_name_hash(name, len);
     for(prev = NULL, prop = get_object_struct(obj)->properties; prop != NULL;
         prev = prop, prop = prop->next) {
         size_t n;
-        const char* s = mjs_get_string(mjs, &prop->name, &n);
+        const char* s;
+        if(prop->name_hash != hash) continue;
+        s = mjs_get_string(mjs, &prop->name, &n);
         if(n == len && strncmp(s, name, len) == 0) {
             if(prev) {
                 prev->next = prop->next;
             } else {
                 get_object_struct(obj)->properties = prop->next;
             }
+            mjs_prop_cache_reset(mjs);
             mjs_destroy_property(&prop);
             return 0;
         }
@@ -17,6 +17,7 @@ struct mjs;
 
 struct mjs_property {
     struct mjs_property* next; /* Linkage in struct mjs_object::properties */
+    uint32_t name_hash; /* Hash of the property name, see mjs_prop_name_hash() */
     mjs_val_t name; /* Property name (a string) */
     mjs_val_t value; /* Property value */
 };
@@ -26,6 +27,13 @@ struct mjs_object {
 };
 
 MJS_PRIVATE struct mjs_object* get_object_struct(mjs_val_t v);
+
+/*
+ * Drops all property lookup cache entries. Must be called whenever properties
+ * are unlinked from objects or freed.
+ */
+MJS_PRIVATE void mjs_prop_cache_reset(struct mjs* mjs);
+
 MJS_PRIVATE struct mjs_property*
     mjs_get_own_property(struct mjs* mjs, mjs_val_t obj, const char* name, size_t len);
 
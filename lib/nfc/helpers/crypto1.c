@@ -82,6 +82,42 @@ uint32_t crypto1_word(Crypto1* crypto1, uint32_t in, int is_encrypted) {
     return out;
 }
 
+uint8_t crypto1_rollback_bit(Crypto1* crypto1, uint8_t in, int is_encrypted) {
+    furi_assert(crypto1);
+    crypto1->odd &= 0xffffff;
+    FURI_SWAP(crypto1->odd, crypto1->even);
+
+    uint32_t feed = crypto1->even & 1;
+    crypto1->even >>= 1;
+    feed ^= LF_POLY_EVEN & crypto1->even;
+    feed ^= LF_POLY_ODD & crypto1->odd;
+    feed ^= !!in;
+    uint8_t out = crypto1_filter(crypto1->odd);
+    feed ^= out & (!!is_encrypted);
+    crypto1->even |= (uint32_t)nfc_util_even_parity32(feed) << 23;
+
+    return out;
+}
+
+uint32_t crypto1_rollback_word(Crypto1* crypto1, uint32_t in, int is_encrypted) {
+    furi_assert(crypto1);
+    uint32_t out = 0;
+    for(int8_t i = 31; i >= 0; i--) {
+        out |= (uint32_t)crypto1_rollback_bit(crypto1, BEBIT(in, i), is_encrypted) << (24 ^ i);
+    }
+    return out;
+}
+
+uint64_t crypto1_get_key(const Crypto1* crypto1) {
+    furi_assert(crypto1);
+    uint64_t key = 0;
+    for(int8_t i = 23; i >= 0; i--) {
+        key = key << 1 | FURI_BIT(crypto1->odd, i ^ 3);
+        key = key << 1 | FURI_BIT(crypto1->even, i ^ 3);
+    }
+    return key;
+}
+
 uint32_t prng_successor(uint32_t x, uint32_t n) {
     SWAPENDIAN(x);
     while(n--)
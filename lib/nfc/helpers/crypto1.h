@@ -25,6 +25,34 @@ uint8_t crypto1_byte(Crypto1* crypto1, uint8_t in, int is_encrypted);
 
 uint32_t crypto1_word(Crypto1* crypto1, uint32_t in, int is_encrypted);
 
+/**
+ * @brief Step the cipher state one bit back, undoing crypto1_bit().
+ *
+ * @param[in,out] crypto1 pointer to the cipher state.
+ * @param[in] in bit which was fed into the state.
+ * @param[in] is_encrypted whether the fed bit was encrypted.
+ * @returns keystream bit which was produced by the undone step.
+ */
+uint8_t crypto1_rollback_bit(Crypto1* crypto1, uint8_t in, int is_encrypted);
+
+/**
+ * @brief Step the cipher state one word back, undoing crypto1_word().
+ *
+ * @param[in,out] crypto1 pointer to the cipher state.
+ * @param[in] in word which was fed into the state.
+ * @param[in] is_encrypted whether the fed word was encrypted.
+ * @returns keystream word which was produced by the undone steps.
+ */
+uint32_t crypto1_rollback_word(Crypto1* crypto1, uint32_t in, int is_encrypted);
+
+/**
+ * @brief Get the key the cipher state would be initialised with, inverse of crypto1_init().
+ *
+ * @param[in] crypto1 pointer to the cipher state.
+ * @returns 48-bit key.
+ */
+uint64_t crypto1_get_key(const Crypto1* crypto1);
+
 void crypto1_decrypt(Crypto1* crypto, const BitBuffer* buff, BitBuffer* out);
 
 void crypto1_encrypt(Crypto1* crypto, uint8_t* keystream, const BitBuffer* buff, BitBuffer* out);
@@ -76,6 +76,74 @@ bool iso14443_4_layer_decode_block(
     return ret;
 }
 
+void iso14443_4_layer_encode_chained_block(
+    Iso14443_4Layer* instance,
+    const BitBuffer* input_data,
+    size_t offset,
+    size_t size,
+    bool chaining,
+    BitBuffer* block_data) {
+    furi_assert(instance);
+
+    uint8_t pcb = instance->pcb;
+    if(chaining) {
+        pcb |= ISO14443_4_BLOCK_PCB_CHAINING;
+    }
+    bit_buffer_append_byte(block_data, pcb);
+    bit_buffer_append_bytes(block_data, bit_buffer_get_data(input_data) + offset, size);
+
+    iso14443_4_layer_update_pcb(instance);
+}
+
+void iso14443_4_layer_encode_ack(Iso14443_4Layer* instance, BitBuffer* block_data) {
+    furi_assert(instance);
+
+    bit_buffer_append_byte(
+        block_data,
+        ISO14443_4_BLOCK_PCB_R | ISO14443_4_BLOCK_PCB |
+            (instance->pcb & ISO14443_4_BLOCK_PCB_BLOCK_NUMBER));
+
+    iso14443_4_layer_update_pcb(instance);
+}
+
+bool iso14443_4_layer_check_ack(Iso14443_4Layer* instance, const BitBuffer* block_data) {
+    furi_assert(instance);
+
+    const uint8_t ack = ISO14443_4_BLOCK_PCB_R | ISO14443_4_BLOCK_PCB |
+                        (instance->pcb_prev & ISO14443_4_BLOCK_PCB_BLOCK_NUMBER);
+    return bit_buffer_get_size_bytes(block_data) == 1 &&
+           bit_buffer_starts_with_byte(block_data, ack);
+}
+
+bool iso14443_4_layer_decode_chained_block(
+    Iso14443_4Layer* instance,
+    BitBuffer* output_data,
+    const BitBuffer* block_data,
+    bool* chaining) {
+    furi_assert(instance);
+    furi_assert(chaining);
+
+    bool ret = false;
+
+    do {
+        const size_t block_size = bit_buffer_get_size_bytes(block_data);
+        if(block_size == 0) break;
+
+        const uint8_t pcb = bit_buffer_get_byte(block_data, 0);
+        if((pcb & ~ISO14443_4_BLOCK_PCB_CHAINING) != instance->pcb_prev) break;
+
+        const size_t capacity_left =
+            bit_buffer_get_capacity_bytes(output_data) - bit_buffer_get_size_bytes(output_data);
+        if(block_size - 1 > capacity_left) break;
+
+        bit_buffer_append_right(output_data, block_data, 1);
+        *chaining = (pcb & ISO14443_4_BLOCK_PCB_CHAINING) != 0;
+        ret = true;
+    } while(false);
+
+    return ret;
+}
+
 Iso14443_4aError iso14443_4_layer_decode_block_pwt_ext(
     Iso14443_4Layer* instance,
     BitBuffer* output_data,
@@ -25,6 +25,39 @@ bool iso14443_4_layer_decode_block(
     BitBuffer* output_data,
     const BitBuffer* block_data);
 
+/**
+ * Encode part of input data as I-block.
+ * Chaining is set when more blocks of the same request follow.
+ */
+void iso14443_4_layer_encode_chained_block(
+    Iso14443_4Layer* instance,
+    const BitBuffer* input_data,
+    size_t offset,
+    size_t size,
+    bool chaining,
+    BitBuffer* block_data);
+
+/**
+ * Encode R(ACK) block requesting next block of chained response.
+ */
+void iso14443_4_layer_encode_ack(Iso14443_4Layer* instance, BitBuffer* block_data);
+
+/**
+ * Check that PICC acknowledged last sent chained block.
+ */
+bool iso14443_4_layer_check_ack(Iso14443_4Layer* instance, const BitBuffer* block_data);
+
+/**
+ * Append information field of I-block to output data.
+ * Chaining is set when PICC has more blocks of the same response.
+ * Fails on unexpected block, or if output data has no room for it.
+ */
+bool iso14443_4_layer_decode_chained_block(
+    Iso14443_4Layer* instance,
+    BitBuffer* output_data,
+    const BitBuffer* block_data,
+    bool* chaining);
+
 Iso14443_4aError iso14443_4_layer_decode_block_pwt_ext(
     Iso14443_4Layer* instance,
     BitBuffer* output_data,
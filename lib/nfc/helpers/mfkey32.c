@@ -0,0 +1,418 @@
+#include "mfkey32.h"
+#include "crypto1.h"
+
+#include <lib/nfc/helpers/nfc_util.h>
+#include <furi.h>
+
+// Algorithm from https://github.com/RfidResearchGroup/proxmark3.git (crapto1 lfsr_recovery32)
+
+#define TAG "Mfkey32"
+
+#define LF_POLY_ODD  (0x29CE5C)
+#define LF_POLY_EVEN (0x870804)
+
+#define BEBIT(x, n) FURI_BIT(x, (n) ^ 24)
+
+#define MFKEY32_ROOT_BITS (20U)
+/* Keystream bits consumed while building candidate lists, 4 plain and 4 contributing */
+#define MFKEY32_PARTITION_BITS (8U)
+#define MFKEY32_KEYSTREAM_BITS (16U)
+#define MFKEY32_BUCKETS        (256U)
+/* Typical list items per bucket key is 2000, with little spread */
+#define MFKEY32_BUCKET_ITEMS (2304U)
+/* List space left for items added while the search extends buckets */
+#define MFKEY32_SEARCH_RESERVE_PCT (10U)
+/* Roots between cancel checks, a few milliseconds of work */
+#define MFKEY32_CANCEL_CHECK_ROOTS (0x4000U)
+
+#define MFKEY32_ODD_MASK1  (LF_POLY_EVEN << 1 | 1)
+#define MFKEY32_ODD_MASK2  (LF_POLY_ODD << 1)
+#define MFKEY32_EVEN_MASK1 (LF_POLY_ODD)
+#define MFKEY32_EVEN_MASK2 (LF_POLY_EVEN << 1 | 1)
+
+/* Items keep 24 state bits and 8 feedback contribution bits on top, which are the bucket key */
+#define MFKEY32_ITEM_KEY(item) ((item) >> 24)
+
+typedef struct {
+    uint32_t* items;
+    uint32_t* limit;
+    uint32_t* tail;
+    uint16_t keystream;
+    uint32_t mask1;
+    uint32_t mask2;
+} Mfkey32List;
+
+struct Mfkey32 {
+    Mfkey32List odd;
+    Mfkey32List even;
+    size_t capacity;
+    Mfkey32CancelCallback callback;
+    void* context;
+
+    const Mfkey32Nonces* nonces;
+    uint32_t ar1_keystream;
+    uint8_t key_min;
+    uint8_t key_max;
+    bool overflow;
+    bool cancelled;
+    bool found;
+    uint64_t key;
+};
+
+/* Same as in crypto1.c, split to share the upper part between a state and its sibling */
+static inline uint32_t mfkey32_filter_upper(uint32_t in) {
+    uint32_t out = 0x6c9c0 >> (in >> 4 & 0xf) & 8;
+    out |= 0x3c8b0 >> (in >> 8 & 0xf) & 4;
+    out |= 0x1e458 >> (in >> 12 & 0xf) & 2;
+    out |= 0x0d938 >> (in >> 16 & 0xf) & 1;
+    return out;
+}
+
+static inline uint8_t mfkey32_filter_lower(uint32_t upper, uint32_t in) {
+    return FURI_BIT(0xEC57E80A, upper | (0xf22c0 >> (in & 0xf) & 16));
+}
+
+static inline uint8_t mfkey32_filter(uint32_t in) {
+    return mfkey32_filter_lower(mfkey32_filter_upper(in), in);
+}
+
+static inline uint32_t mfkey32_contribute(uint32_t item, uint32_t mask1, uint32_t mask2) {
+    uint32_t p = item >> 25;
+    p = p << 1 | nfc_util_even_parity32(item & mask1);
+    p = p << 1 | nfc_util_even_parity32(item & mask2);
+    return p << 24 | (item & 0xffffff);
+}
+
+static inline uint8_t mfkey32_keystream_bit(const Mfkey32List* list, uint8_t bit) {
+    return FURI_BIT(list->keystream, bit);
+}
+
+/* Add descendants of the root to the list, when their contributions fit into the partition */
+static void mfkey32_generate_root(Mfkey32* instance, Mfkey32List* list, uint32_t root) {
+    /* Every item has two children at most, so depth first walk never takes more slots */
+    uint32_t items[MFKEY32_PARTITION_BITS + 1];
+    uint8_t bits[MFKEY32_PARTITION_BITS + 1];
+    size_t top = 0;
+    items[top] = root;
+    bits[top++] = 1;
+
+    while(top > 0) {
+        top--;
+        uint32_t item = items[top];
+        uint8_t bit = bits[top];
+        if(bit > MFKEY32_PARTITION_BITS) {
+            if(list->tail == list->limit) {
+                instance->overflow = true;
+                break;
+            }
+            *list->tail++ = item;
+            continue;
+        }
+
+        uint32_t next = item << 1;
+        uint32_t upper = mfkey32_filter_upper(next);
+        uint8_t filter = mfkey32_filter_lower(upper, next);
+        uint8_t keystream = mfkey32_keystream_bit(list, bit);
+        uint32_t children[2];
+        size_t children_num = 0;
+        if(filter != mfkey32_filter_lower(upper, next | 1)) {
+            children[children_num++] = next | (filter ^ keystream);
+        } else if(filter == keystream) {
+            children[children_num++] = next;
+            children[children_num++] = next | 1;
+        }
+
+        for(size_t i = 0; i < children_num; i++) {
+            uint32_t child = children[i];
+            if(bit > MFKEY32_PARTITION_BITS / 2) {
+                child = mfkey32_contribute(child, list->mask1, list->mask2);
+                /* Contribution bits known so far must match the partition */
+                uint8_t shift = 2 * (MFKEY32_PARTITION_BITS - bit);
+                uint8_t prefix = MFKEY32_ITEM_KEY(child);
+                if((prefix < (instance->key_min >> shift)) ||
+                   (prefix > (instance->key_max >> shift))) {
+                    continue;
+                }
+            }
+            items[top] = child;
+            bits[top++] = bit + 1;
+        }
+    }
+}
+
+static bool mfkey32_is_cancelled(Mfkey32* instance) {
+    if(!instance->cancelled && instance->callback) {
+        instance->cancelled = instance->callback(instance->context);
+    }
+    return instance->cancelled;
+}
+
+/* Build both lists for the partition, starting from every state allowed by the first bit */
+static bool mfkey32_generate(Mfkey32* instance) {
+    Mfkey32List* odd = &instance->odd;
+    Mfkey32List* even = &instance->even;
+    odd->tail = odd->items;
+    even->tail = even->items;
+
+    uint8_t odd_keystream = mfkey32_keystream_bit(odd, 0);
+    uint8_t even_keystream = mfkey32_keystream_bit(even, 0);
+    for(uint32_t root = 0; (root < (1UL << MFKEY32_ROOT_BITS)) && !instance->overflow;) {
+        if(((root % MFKEY32_CANCEL_CHECK_ROOTS) == 0) && mfkey32_is_cancelled(instance)) break;
+
+        uint32_t upper = mfkey32_filter_upper(root);
+        /* Roots differing in the lowest nibble only */
+        for(uint32_t end = root + 0x10; root < end; root++) {
+            uint8_t filter = mfkey32_filter_lower(upper, root);
+            if(filter == odd_keystream) {
+                mfkey32_generate_root(instance, odd, root);
+            }
+            if(filter == even_keystream) {
+                mfkey32_generate_root(instance, even, root);
+            }
+        }
+    }
+    return !instance->overflow && !instance->cancelled;
+}
+
+/* Extend items by one bit in place, items with two children take one more slot at the tail */
+static bool mfkey32_extend(Mfkey32List* list, uint32_t* head, uint32_t** tail, uint8_t bit) {
+    uint8_t keystream = mfkey32_keystream_bit(list, bit);
+    uint32_t* item = head;
+    while(item < *tail) {
+        uint32_t next = *item << 1;
+        uint32_t upper = mfkey32_filter_upper(next);
+        uint8_t filter = mfkey32_filter_lower(upper, next);
+        if(filter != mfkey32_filter_lower(upper, next | 1)) {
+            *item++ = mfkey32_contribute(next | (filter ^ keystream), list->mask1, list->mask2);
+        } else if(filter == keystream) {
+            if(*tail == list->limit) return false;
+            /* Move next unprocessed item out of the way */
+            *(*tail)++ = item[1];
+            *item++ = mfkey32_contribute(next, list->mask1, list->mask2);
+            *item++ = mfkey32_contribute(next | 1, list->mask1, list->mask2);
+        } else {
+            *item = *--(*tail);
+        }
+    }
+    return true;
+}
+
+static int mfkey32_compare_keys(const void* a, const void* b) {
+    return (int)MFKEY32_ITEM_KEY(*(const uint32_t*)a) - (int)MFKEY32_ITEM_KEY(*(const uint32_t*)b);
+}
+
+static void mfkey32_check_candidate(Mfkey32* instance, uint32_t odd, uint32_t even) {
+    const Mfkey32Nonces* nonces = instance->nonces;
+    Crypto1 crypto = {.odd = odd, .even = even};
+
+    crypto1_rollback_word(&crypto, 0, 0);
+    crypto1_rollback_word(&crypto, nonces->nr0, 1);
+    crypto1_rollback_word(&crypto, nonces->cuid ^ nonces->nt0, 0);
+    uint64_t key = crypto1_get_key(&crypto);
+
+    crypto1_word(&crypto, nonces->cuid ^ nonces->nt1, 0);
+    crypto1_word(&crypto, nonces->nr1, 1);
+    if(nonces->ar1 == (crypto1_word(&crypto, 0, 0) ^ instance->ar1_keystream)) {
+        instance->key = key;
+        instance->found = true;
+    }
+}
+
+static void mfkey32_check_bucket(
+    Mfkey32* instance,
+    uint32_t* odd_head,
+    uint32_t* odd_tail,
+    uint32_t* even_head,
+    uint32_t* even_tail) {
+    for(uint32_t* e = even_head; (e < even_tail) && !instance->found; e++) {
+        uint32_t even = *e << 1 ^ nfc_util_even_parity32(*e & LF_POLY_EVEN);
+        for(uint32_t* o = odd_head; (o < odd_tail) && !instance->found; o++) {
+            mfkey32_check_candidate(
+                instance, even ^ nfc_util_even_parity32(*o & LF_POLY_ODD), *o);
+        }
+    }
+}
+
+/*
+ * Sort both lists by contribution and go through buckets present in both, highest first.
+ * Extending a bucket overwrites the buckets above it, which are done by then.
+ */
+static void mfkey32_search(
+    Mfkey32* instance,
+    uint32_t* odd_head,
+    uint32_t* odd_tail,
+    uint32_t* even_head,
+    uint32_t* even_tail,
+    uint8_t bit,
+    int8_t rem) {
+    qsort(odd_head, odd_tail - odd_head, sizeof(uint32_t), mfkey32_compare_keys);
+    qsort(even_head, even_tail - even_head, sizeof(uint32_t), mfkey32_compare_keys);
+
+    uint32_t* odd_end = odd_tail;
+    uint32_t* even_end = even_tail;
+    while((odd_end > odd_head) && (even_end > even_head) && !instance->found &&
+          !instance->overflow) {
+        uint8_t odd_key = MFKEY32_ITEM_KEY(odd_end[-1]);
+        uint8_t even_key = MFKEY32_ITEM_KEY(even_end[-1]);
+        uint8_t key = MIN(odd_key, even_key);
+
+        uint32_t* odd_start = odd_end;
+        while((odd_start > odd_head) && (MFKEY32_ITEM_KEY(odd_start[-1]) == odd_key)) {
+            odd_start--;
+        }
+        uint32_t* even_start = even_end;
+        while((even_start > even_head) && (MFKEY32_ITEM_KEY(even_start[-1]) == even_key)) {
+            even_start--;
+        }
+
+        if(odd_key != even_key) {
+            /* Bucket of the higher key has no pair */
+            if(odd_key > key) odd_end = odd_start;
+            if(even_key > key) even_end = even_start;
+            continue;
+        }
+
+        if(rem < 0) {
+            mfkey32_check_bucket(instance, odd_start, odd_end, even_start, even_end);
+        } else {
+            uint32_t* odd_bucket_tail = odd_end;
+            uint32_t* even_bucket_tail = even_end;
+            uint8_t bucket_bit = bit;
+            int8_t bucket_rem = rem;
+            bool empty = false;
+            for(uint8_t i = 0; (i < 4) && bucket_rem--; i++) {
+                if(!mfkey32_extend(&instance->odd, odd_start, &odd_bucket_tail, bucket_bit) ||
+                   !mfkey32_extend(&instance->even, even_start, &even_bucket_tail, bucket_bit)) {
+                    instance->overflow = true;
+                    break;
+                }
+                bucket_bit++;
+                empty = (odd_bucket_tail == odd_start) || (even_bucket_tail == even_start);
+                if(empty) break;
+            }
+            if(!empty && !instance->overflow) {
+                mfkey32_search(
+                    instance,
+                    odd_start,
+                    odd_bucket_tail,
+                    even_start,
+                    even_bucket_tail,
+                    bucket_bit,
+                    bucket_rem);
+            }
+        }
+
+        odd_end = odd_start;
+        even_end = even_start;
+    }
+}
+
+Mfkey32* mfkey32_alloc(size_t memory_size) {
+    Mfkey32* instance = malloc(sizeof(Mfkey32));
+
+    instance->capacity = memory_size / (2 * sizeof(uint32_t));
+    furi_check(instance->capacity > 0);
+    instance->odd.items = malloc(instance->capacity * sizeof(uint32_t));
+    instance->odd.limit = instance->odd.items + instance->capacity;
+    instance->odd.mask1 = MFKEY32_ODD_MASK1;
+    instance->odd.mask2 = MFKEY32_ODD_MASK2;
+    instance->even.items = malloc(instance->capacity * sizeof(uint32_t));
+    instance->even.limit = instance->even.items + instance->capacity;
+    instance->even.mask1 = MFKEY32_EVEN_MASK1;
+    instance->even.mask2 = MFKEY32_EVEN_MASK2;
+
+    return instance;
+}
+
+void mfkey32_free(Mfkey32* instance) {
+    furi_check(instance);
+
+    free(instance->odd.items);
+    free(instance->even.items);
+    free(instance);
+}
+
+void mfkey32_set_cancel_callback(
+    Mfkey32* instance,
+    Mfkey32CancelCallback callback,
+    void* context) {
+    furi_check(instance);
+
+    instance->callback = callback;
+    instance->context = context;
+}
+
+Mfkey32Error mfkey32_recover(Mfkey32* instance, const Mfkey32Nonces* nonces, uint64_t* key) {
+    furi_check(instance);
+    furi_check(nonces);
+    furi_check(key);
+
+    uint32_t ks2 = nonces->ar0 ^ prng_successor(nonces->nt0, 64);
+    instance->odd.keystream = 0;
+    instance->even.keystream = 0;
+    for(int8_t i = 31; i >= 0; i -= 2) {
+        instance->odd.keystream = instance->odd.keystream << 1 | BEBIT(ks2, i);
+        instance->even.keystream = instance->even.keystream << 1 | BEBIT(ks2, i - 1);
+    }
+    instance->nonces = nonces;
+    instance->ar1_keystream = prng_successor(nonces->nt1, 64);
+    instance->found = false;
+    instance->cancelled = false;
+
+    /*
+     * Both lists would take megabytes, so they are built for a range of bucket keys at a time.
+     * Range is halved for a retry in the rare case it doesn't fit.
+     */
+    Mfkey32Error error = Mfkey32ErrorNotFound;
+    uint16_t range_size_max = MAX(
+        instance->capacity * (100 - MFKEY32_SEARCH_RESERVE_PCT) / 100 / MFKEY32_BUCKET_ITEMS, 1U);
+    range_size_max = MIN(range_size_max, MFKEY32_BUCKETS);
+    uint16_t range_start = 0;
+    uint16_t range_size = range_size_max;
+    uint32_t passes = 0;
+    while(range_start < MFKEY32_BUCKETS) {
+        instance->key_min = range_start;
+        instance->key_max = MIN(range_start + range_size, MFKEY32_BUCKETS) - 1;
+        instance->overflow = false;
+        passes++;
+
+        if(mfkey32_generate(instance)) {
+            mfkey32_search(
+                instance,
+                instance->odd.items,
+                instance->odd.tail,
+                instance->even.items,
+                instance->even.tail,
+                MFKEY32_PARTITION_BITS + 1,
+                MFKEY32_KEYSTREAM_BITS - MFKEY32_PARTITION_BITS - 1);
+        }
+
+        if(instance->found) {
+            *key = instance->key;
+            error = Mfkey32ErrorNone;
+            break;
+        }
+
+        if(instance->cancelled) {
+            error = Mfkey32ErrorCancelled;
+            break;
+        }
+
+        if(instance->overflow) {
+            if(range_size == 1) {
+                error = Mfkey32ErrorMemory;
+                break;
+            }
+            range_size /= 2;
+            continue;
+        }
+
+        range_start += range_size;
+        range_size = range_size_max;
+    }
+
+    FURI_LOG_D(TAG, "Passes: %lu", passes);
+    instance->nonces = NULL;
+
+    return error;
+}
@@ -0,0 +1,89 @@
+/**
+ * @file mfkey32.h
+ * @brief MIFARE Classic key recovery from two reader authentications (MFKey32v2).
+ *
+ * Recovers the key a reader used, given two authentications to the same sector
+ * with the same key, as collected while emulating a card. Keystream candidates
+ * are searched in a fixed amount of memory: the search space is split into
+ * partitions which are processed one after another, so the memory size only
+ * trades off against the number of passes.
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Nonces of two authentications, as seen by the emulated card.
+ */
+typedef struct {
+    uint32_t cuid; /**< Card UID used in the authentications. */
+    uint32_t nt0; /**< First card nonce. */
+    uint32_t nr0; /**< First encrypted reader nonce. */
+    uint32_t ar0; /**< First encrypted reader response. */
+    uint32_t nt1; /**< Second card nonce. */
+    uint32_t nr1; /**< Second encrypted reader nonce. */
+    uint32_t ar1; /**< Second encrypted reader response. */
+} Mfkey32Nonces;
+
+typedef enum {
+    Mfkey32ErrorNone, /**< Key recovered. */
+    Mfkey32ErrorNotFound, /**< Nonces don't match any key. */
+    Mfkey32ErrorMemory, /**< Search space can't be split fine enough for the memory given. */
+    Mfkey32ErrorCancelled, /**< Recovery was cancelled by the callback. */
+} Mfkey32Error;
+
+/**
+ * @brief Callback checked every few milliseconds while recovering.
+ *
+ * @param[in] context pointer to the user context.
+ * @returns true to cancel recovery, false to go on.
+ */
+typedef bool (*Mfkey32CancelCallback)(void* context);
+
+typedef struct Mfkey32 Mfkey32;
+
+/**
+ * @brief Allocate key recovery instance.
+ *
+ * @param[in] memory_size bytes to allocate for the candidate lists.
+ * @returns pointer to the allocated instance.
+ */
+Mfkey32* mfkey32_alloc(size_t memory_size);
+
+/**
+ * @brief Free key recovery instance.
+ *
+ * @param[in] instance pointer to the instance to be freed.
+ */
+void mfkey32_free(Mfkey32* instance);
+
+/**
+ * @brief Set callback to be able to stop a running recovery.
+ *
+ * @param[in,out] instance pointer to the instance.
+ * @param[in] callback callback to be checked, NULL to never cancel.
+ * @param[in] context pointer to the user context passed to the callback.
+ */
+void mfkey32_set_cancel_callback(Mfkey32* instance, Mfkey32CancelCallback callback, void* context);
+
+/**
+ * @brief Recover key from the nonces of two authentications.
+ *
+ * Takes seconds to minutes depending on the memory size, run it from a low priority thread.
+ *
+ * @param[in,out] instance pointer to the instance.
+ * @param[in] nonces pointer to the authentication nonces.
+ * @param[out] key pointer to the key to be filled.
+ * @returns Mfkey32ErrorNone if the key was recovered, error otherwise.
+ */
+Mfkey32Error mfkey32_recover(Mfkey32* instance, const Mfkey32Nonces* nonces, uint64_t* key);
+
+#ifdef __cplusplus
+}
+#endif
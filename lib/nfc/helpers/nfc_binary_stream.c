@@ -0,0 +1,56 @@
+#include "nfc_binary_stream.h"
+
+#include <furi.h>
+
+bool nfc_binary_stream_write(Stream* stream, const void* data, size_t size) {
+    furi_check(stream);
+    furi_check(data);
+
+    return stream_write(stream, data, size) == size;
+}
+
+bool nfc_binary_stream_read(Stream* stream, void* data, size_t size) {
+    furi_check(stream);
+    furi_check(data);
+
+    return stream_read(stream, data, size) == size;
+}
+
+bool nfc_binary_stream_read_count(Stream* stream, uint32_t* count, size_t element_size) {
+    furi_check(count);
+    furi_check(element_size);
+
+    if(!nfc_binary_stream_read(stream, count, sizeof(uint32_t))) return false;
+
+    const size_t remaining = stream_size(stream) - stream_tell(stream);
+    return *count <= remaining / element_size;
+}
+
+bool nfc_binary_stream_write_array(Stream* stream, const SimpleArray* array, size_t type_size) {
+    furi_check(array);
+
+    const uint32_t count = simple_array_get_count(array);
+    bool success = nfc_binary_stream_write(stream, &count, sizeof(count));
+
+    if(success && count > 0) {
+        success =
+            nfc_binary_stream_write(stream, simple_array_cget_data(array), count * type_size);
+    }
+
+    return success;
+}
+
+bool nfc_binary_stream_read_array(Stream* stream, SimpleArray* array, size_t type_size) {
+    furi_check(array);
+
+    uint32_t count;
+    if(!nfc_binary_stream_read_count(stream, &count, type_size)) return false;
+
+    if(count == 0) {
+        simple_array_reset(array);
+        return true;
+    }
+
+    simple_array_init(array, count);
+    return nfc_binary_stream_read(stream, simple_array_get_data(array), count * type_size);
+}
@@ -0,0 +1,72 @@
+/**
+ * @file nfc_binary_stream.h
+ * @brief Helpers for the protocols' binary NFC device data format.
+ *
+ * The format is only read back by the same firmware build, so fields are
+ * stored as they are laid out in memory.
+ */
+#pragma once
+
+#include <toolbox/stream/stream.h>
+#include <toolbox/simple_array.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Write raw bytes.
+ *
+ * @param[in,out] stream pointer to the stream to write to.
+ * @param[in] data pointer to the data to be written.
+ * @param[in] size data size in bytes.
+ * @returns true if all bytes were written, false otherwise.
+ */
+bool nfc_binary_stream_write(Stream* stream, const void* data, size_t size);
+
+/**
+ * @brief Read raw bytes.
+ *
+ * @param[in,out] stream pointer to the stream to read from.
+ * @param[out] data pointer to the buffer to be filled.
+ * @param[in] size data size in bytes.
+ * @returns true if all bytes were read, false otherwise.
+ */
+bool nfc_binary_stream_read(Stream* stream, void* data, size_t size);
+
+/**
+ * @brief Read element count, stored as uint32_t.
+ *
+ * Fails if the rest of the stream can't hold that many elements,
+ * so that damaged data doesn't lead to huge allocations.
+ *
+ * @param[in,out] stream pointer to the stream to read from.
+ * @param[out] count pointer to the count to be filled.
+ * @param[in] element_size minimum size of a stored element in bytes.
+ * @returns true if the count was read and is plausible, false otherwise.
+ */
+bool nfc_binary_stream_read_count(Stream* stream, uint32_t* count, size_t element_size);
+
+/**
+ * @brief Write array of plain elements (without init, reset or copy methods) along with its count.
+ *
+ * @param[in,out] stream pointer to the stream to write to.
+ * @param[in] array pointer to the array to be written.
+ * @param[in] type_size element size in bytes.
+ * @returns true if the array was written, false otherwise.
+ */
+bool nfc_binary_stream_write_array(Stream* stream, const SimpleArray* array, size_t type_size);
+
+/**
+ * @brief Read array written with nfc_binary_stream_write_array().
+ *
+ * @param[in,out] stream pointer to the stream to read from.
+ * @param[in,out] array pointer to the array to be filled.
+ * @param[in] type_size element size in bytes.
+ * @returns true if the array was read, false otherwise.
+ */
+bool nfc_binary_stream_read_array(Stream* stream, SimpleArray* array, size_t type_size);
+
+#ifdef __cplusplus
+}
+#endif
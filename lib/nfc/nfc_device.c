@@ -4,6 +4,7 @@
 #include <flipper_format/flipper_format.h>
 
 #include "nfc_common.h"
+#include "nfc_device_cache_i.h"
 #include "protocols/nfc_device_defs.h"
 
 #define NFC_FILE_HEADER    "Flipper NFC device"
@@ -25,6 +26,9 @@ void nfc_device_free(NfcDevice* instance) {
     furi_check(instance);
 
     nfc_device_clear(instance);
+    if(instance->cache_path) {
+        furi_string_free(instance->cache_path);
+    }
     free(instance);
 }
 
@@ -151,6 +155,20 @@ void nfc_device_set_loading_callback(
     instance->loading_callback_context = context;
 }
 
+void nfc_device_set_cache_path(NfcDevice* instance, const char* path) {
+    furi_check(instance);
+
+    if(path) {
+        if(!instance->cache_path) {
+            instance->cache_path = furi_string_alloc();
+        }
+        furi_string_set_str(instance->cache_path, path);
+    } else if(instance->cache_path) {
+        furi_string_free(instance->cache_path);
+        instance->cache_path = NULL;
+    }
+}
+
 bool nfc_device_save(NfcDevice* instance, const char* path) {
     furi_check(instance);
     furi_check(instance->protocol < NfcProtocolNum);
@@ -203,6 +221,10 @@ bool nfc_device_save(NfcDevice* instance, const char* path) {
         saved = true;
     } while(false);
 
+    if(instance->cache_path) {
+        nfc_device_cache_remove(storage, furi_string_get_cstr(instance->cache_path), path);
+    }
+
     if(instance->loading_callback) {
         instance->loading_callback(instance->loading_callback_context, false);
     }
@@ -331,7 +353,15 @@ bool nfc_device_load(NfcDevice* instance, const char* path) {
         instance->loading_callback(instance->loading_callback_context, true);
     }
 
+    const char* cache_path = instance->cache_path ? furi_string_get_cstr(instance->cache_path) :
+                                                    NULL;
+
     do {
+        if(cache_path && nfc_device_cache_load(instance, storage, cache_path, path)) {
+            loaded = true;
+            break;
+        }
+
         if(!flipper_format_buffered_file_open_existing(ff, path)) break;
 
         // Read and verify file header
@@ -346,6 +376,9 @@ bool nfc_device_load(NfcDevice* instance, const char* path) {
                      nfc_device_load_legacy(instance, ff, version) :
                      nfc_device_load_unified(instance, ff, version);
 
+        if(loaded && cache_path) {
+            nfc_device_cache_save(instance, storage, cache_path, path);
+        }
     } while(false);
 
     if(instance->loading_callback) {
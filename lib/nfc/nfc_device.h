@@ -243,6 +243,18 @@ void nfc_device_set_loading_callback(
     NfcLoadingCallback callback,
     void* context);
 
+/**
+ * @brief Set the directory to keep binary copies of loaded files in.
+ *
+ * When set, nfc_device_load() keeps a binary copy of each file it parses there and loads
+ * the copy instead as long as the file's size and modification time stay the same.
+ * Only files on the SD card are cached.
+ *
+ * @param[in,out] instance pointer to the instance to be modified.
+ * @param[in] path pointer to the cache directory path, NULL to disable caching.
+ */
+void nfc_device_set_cache_path(NfcDevice* instance, const char* path);
+
 /**
  * @brief Save NFC device data form an NfcDevice instance to a file.
  *
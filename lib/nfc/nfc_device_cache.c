@@ -0,0 +1,250 @@
+#include "nfc_device_cache_i.h"
+
+#include <furi.h>
+#include <toolbox/md5_calc.h>
+#include <toolbox/version.h>
+#include <toolbox/stream/buffered_file_stream.h>
+
+#include "nfc_common.h"
+#include "protocols/nfc_device_defs.h"
+
+#define TAG "NfcDeviceCache"
+
+#define NFC_DEVICE_CACHE_MAGIC     (0x4243464EU) /* "NFCB" */
+#define NFC_DEVICE_CACHE_VERSION   (2U)
+#define NFC_DEVICE_CACHE_EXTENSION ".bin"
+#define NFC_DEVICE_CACHE_MD5_SIZE  (16U)
+
+/* FNV-1a 32-bit */
+#define NFC_DEVICE_CACHE_FNV_OFFSET (2166136261UL)
+#define NFC_DEVICE_CACHE_FNV_PRIME  (16777619UL)
+
+/* Followed by the source path and the protocol data, root protocol first */
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t firmware_hash;
+    uint32_t format_version;
+    uint32_t source_size;
+    uint8_t source_md5[NFC_DEVICE_CACHE_MD5_SIZE];
+    uint32_t path_len;
+    uint32_t protocol;
+} NfcDeviceCacheHeader;
+
+static uint32_t nfc_device_cache_hash(uint32_t hash, const char* str) {
+    while(*str) {
+        hash ^= (uint8_t)*str++;
+        hash *= NFC_DEVICE_CACHE_FNV_PRIME;
+    }
+    return hash;
+}
+
+static void nfc_device_cache_get_file_path(
+    FuriString* file_path,
+    const char* cache_dir,
+    const char* path) {
+    furi_string_printf(
+        file_path,
+        "%s/%08lX%s",
+        cache_dir,
+        nfc_device_cache_hash(NFC_DEVICE_CACHE_FNV_OFFSET, path),
+        NFC_DEVICE_CACHE_EXTENSION);
+}
+
+static bool nfc_device_cache_get_header(
+    Storage* storage,
+    const char* path,
+    NfcDeviceCacheHeader* header) {
+    FileInfo file_info;
+    uint8_t md5[NFC_DEVICE_CACHE_MD5_SIZE];
+
+    if(storage_common_stat(storage, path, &file_info) != FSE_OK) return false;
+    if(file_info.size > UINT32_MAX) return false;
+
+    // Content, not mtime: FAT mtime is too coarse to catch quick same size rewrites
+    File* file = storage_file_alloc(storage);
+    bool hashed = md5_calc_file(file, path, md5, NULL);
+    storage_file_free(file);
+    if(!hashed) return false;
+
+    // Binary data is laid out as the firmware which wrote it sees it
+    uint32_t firmware_hash = NFC_DEVICE_CACHE_FNV_OFFSET;
+    firmware_hash = nfc_device_cache_hash(firmware_hash, version_get_githash(NULL));
+    firmware_hash = nfc_device_cache_hash(firmware_hash, version_get_builddate(NULL));
+
+    *header = (NfcDeviceCacheHeader){
+        .magic = NFC_DEVICE_CACHE_MAGIC,
+        .version = NFC_DEVICE_CACHE_VERSION,
+        .firmware_hash = firmware_hash,
+        .format_version = NFC_CURRENT_FORMAT_VERSION,
+        .source_size = file_info.size,
+        .path_len = strlen(path),
+        .protocol = NfcProtocolInvalid,
+    };
+    memcpy(header->source_md5, md5, sizeof(md5));
+
+    return true;
+}
+
+static bool nfc_device_cache_is_supported(NfcProtocol protocol) {
+    for(; protocol != NfcProtocolInvalid; protocol = nfc_protocol_get_parent(protocol)) {
+        if(!nfc_devices[protocol]->load_binary || !nfc_devices[protocol]->save_binary) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool
+    nfc_device_cache_load_data(Stream* stream, NfcProtocol protocol, NfcDeviceData* data) {
+    const NfcProtocol parent = nfc_protocol_get_parent(protocol);
+
+    if(parent != NfcProtocolInvalid) {
+        NfcDeviceData* base_data = nfc_devices[protocol]->get_base_data(data);
+        if(!nfc_device_cache_load_data(stream, parent, base_data)) return false;
+    }
+
+    return nfc_devices[protocol]->load_binary(data, stream);
+}
+
+static bool nfc_device_cache_save_data(
+    Stream* stream,
+    NfcProtocol protocol,
+    const NfcDeviceData* data) {
+    const NfcProtocol parent = nfc_protocol_get_parent(protocol);
+
+    if(parent != NfcProtocolInvalid) {
+        const NfcDeviceData* base_data = nfc_devices[protocol]->get_base_data(data);
+        if(!nfc_device_cache_save_data(stream, parent, base_data)) return false;
+    }
+
+    return nfc_devices[protocol]->save_binary(data, stream);
+}
+
+bool nfc_device_cache_load(
+    NfcDevice* instance,
+    Storage* storage,
+    const char* cache_dir,
+    const char* path) {
+    furi_check(instance);
+    furi_check(storage);
+    furi_check(cache_dir);
+    furi_check(path);
+
+    NfcDeviceCacheHeader expected;
+    if(!nfc_device_cache_get_header(storage, path, &expected)) return false;
+
+    FuriString* file_path = furi_string_alloc();
+    nfc_device_cache_get_file_path(file_path, cache_dir, path);
+
+    Stream* stream = buffered_file_stream_alloc(storage);
+    char* cached_path = malloc(expected.path_len);
+    bool data_allocated = false;
+    bool loaded = false;
+
+    do {
+        if(!buffered_file_stream_open(
+               stream, furi_string_get_cstr(file_path), FSAM_READ, FSOM_OPEN_EXISTING))
+            break;
+
+        NfcDeviceCacheHeader header;
+        if(stream_read(stream, (uint8_t*)&header, sizeof(header)) != sizeof(header)) break;
+
+        expected.protocol = header.protocol;
+        if(memcmp(&header, &expected, sizeof(header)) != 0) break;
+        if(header.protocol >= NfcProtocolNum) break;
+        if(!nfc_device_cache_is_supported(header.protocol)) break;
+
+        // Different paths may share the hash, so compare the path itself
+        if(stream_read(stream, (uint8_t*)cached_path, header.path_len) != header.path_len) break;
+        if(memcmp(cached_path, path, header.path_len) != 0) break;
+
+        nfc_device_clear(instance);
+
+        instance->protocol = header.protocol;
+        instance->protocol_data = nfc_devices[header.protocol]->alloc();
+        data_allocated = true;
+
+        if(!nfc_device_cache_load_data(stream, instance->protocol, instance->protocol_data))
+            break;
+        if(stream_tell(stream) != stream_size(stream)) break;
+
+        loaded = true;
+    } while(false);
+
+    if(!loaded && data_allocated) {
+        nfc_device_clear(instance);
+    }
+
+    FURI_LOG_D(TAG, "%s: %s", loaded ? "Hit" : "Miss", path);
+
+    free(cached_path);
+    buffered_file_stream_close(stream);
+    stream_free(stream);
+    furi_string_free(file_path);
+
+    return loaded;
+}
+
+void nfc_device_cache_save(
+    const NfcDevice* instance,
+    Storage* storage,
+    const char* cache_dir,
+    const char* path) {
+    furi_check(instance);
+    furi_check(instance->protocol < NfcProtocolNum);
+    furi_check(storage);
+    furi_check(cache_dir);
+    furi_check(path);
+
+    if(!nfc_device_cache_is_supported(instance->protocol)) return;
+
+    NfcDeviceCacheHeader header;
+    if(!nfc_device_cache_get_header(storage, path, &header)) return;
+
+    header.protocol = instance->protocol;
+
+    FuriString* file_path = furi_string_alloc();
+    nfc_device_cache_get_file_path(file_path, cache_dir, path);
+
+    Stream* stream = buffered_file_stream_alloc(storage);
+    bool saved = false;
+
+    do {
+        if(!storage_simply_mkdir(storage, cache_dir)) break;
+        if(!buffered_file_stream_open(
+               stream, furi_string_get_cstr(file_path), FSAM_WRITE, FSOM_CREATE_ALWAYS))
+            break;
+
+        if(stream_write(stream, (const uint8_t*)&header, sizeof(header)) != sizeof(header)) break;
+        if(stream_write(stream, (const uint8_t*)path, header.path_len) != header.path_len) break;
+        if(!nfc_device_cache_save_data(stream, instance->protocol, instance->protocol_data))
+            break;
+        if(!buffered_file_stream_sync(stream)) break;
+
+        saved = true;
+    } while(false);
+
+    buffered_file_stream_close(stream);
+    stream_free(stream);
+
+    if(!saved) {
+        FURI_LOG_W(TAG, "Failed to save %s", furi_string_get_cstr(file_path));
+        storage_simply_remove(storage, furi_string_get_cstr(file_path));
+    }
+
+    furi_string_free(file_path);
+}
+
+void nfc_device_cache_remove(Storage* storage, const char* cache_dir, const char* path) {
+    furi_check(storage);
+    furi_check(cache_dir);
+    furi_check(path);
+
+    FuriString* file_path = furi_string_alloc();
+    nfc_device_cache_get_file_path(file_path, cache_dir, path);
+
+    storage_simply_remove(storage, furi_string_get_cstr(file_path));
+
+    furi_string_free(file_path);
+}
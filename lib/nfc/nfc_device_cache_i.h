@@ -0,0 +1,63 @@
+/**
+ * @file nfc_device_cache_i.h
+ * @brief Binary copies of parsed NFC device files.
+ *
+ * A cache file holds the NfcDevice data in the protocols' binary format and is
+ * valid as long as the size and the MD5 hash of its source file match.
+ *
+ * This file is an implementation detail. It must not be included in
+ * any public API-related headers.
+ */
+#pragma once
+
+#include "nfc_device_i.h"
+
+#include <storage/storage.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Load NfcDevice data from the cached copy of a file.
+ *
+ * @param[in,out] instance pointer to the instance to be loaded into.
+ * @param[in] storage pointer to a storage API instance.
+ * @param[in] cache_dir pointer to the cache directory path.
+ * @param[in] path pointer to the source file path.
+ * @returns true if a valid copy was found and loaded, false otherwise.
+ */
+bool nfc_device_cache_load(
+    NfcDevice* instance,
+    Storage* storage,
+    const char* cache_dir,
+    const char* path);
+
+/**
+ * @brief Save NfcDevice data as the cached copy of a file it was loaded from.
+ *
+ * Nothing is saved if some protocol of the data has no binary format.
+ *
+ * @param[in] instance pointer to the instance to be saved.
+ * @param[in] storage pointer to a storage API instance.
+ * @param[in] cache_dir pointer to the cache directory path.
+ * @param[in] path pointer to the source file path.
+ */
+void nfc_device_cache_save(
+    const NfcDevice* instance,
+    Storage* storage,
+    const char* cache_dir,
+    const char* path);
+
+/**
+ * @brief Remove the cached copy of a file.
+ *
+ * @param[in] storage pointer to a storage API instance.
+ * @param[in] cache_dir pointer to the cache directory path.
+ * @param[in] path pointer to the source file path.
+ */
+void nfc_device_cache_remove(Storage* storage, const char* cache_dir, const char* path);
+
+#ifdef __cplusplus
+}
+#endif
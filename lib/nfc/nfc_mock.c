@@ -1,6 +1,7 @@
 #ifdef FW_CFG_unit_tests
 
 #include <lib/nfc/nfc.h>
+#include <lib/nfc/nfc_mock.h>
 #include <lib/nfc/helpers/iso14443_crc.h>
 #include <lib/nfc/protocols/iso14443_3a/iso14443_3a.h>
 #include <lib/nfc/protocols/felica/felica.h>
@@ -72,6 +73,16 @@ typedef struct {
     FelicaSensfResData sens_res;
 } FelicaPTMemory;
 
+typedef struct {
+    const NfcMockFrame* transcript;
+    size_t transcript_num;
+    size_t transcript_pos;
+    uint32_t frame_latency_us;
+    NfcMockStats stats;
+} NfcMockConfig;
+
+static NfcMockConfig mock_config = {};
+
 struct Nfc {
     NfcState state;
 
@@ -346,8 +357,8 @@ void nfc_start(Nfc* instance, NfcEventCallback callback, void* context) {
         furi_check(poller_queue == NULL);
     } else {
         furi_check(poller_queue == NULL);
-        // Check that poller is started after listener
-        furi_check(listener_queue);
+        // Check that poller is started after listener, unless card is played back
+        furi_check(listener_queue || mock_config.transcript);
     }
 
     instance->callback = callback;
@@ -422,14 +433,28 @@ NfcError nfc_iso14443a_listener_tx_custom_parity(Nfc* instance, const BitBuffer*
     return nfc_listener_tx(instance, tx_buffer);
 }
 
-NfcError
-    nfc_poller_trx(Nfc* instance, const BitBuffer* tx_buffer, BitBuffer* rx_buffer, uint32_t fwt) {
-    furi_check(instance);
-    furi_check(tx_buffer);
-    furi_check(rx_buffer);
-    furi_check(poller_queue);
+static NfcError nfc_mock_transcript_trx(const BitBuffer* tx_buffer, BitBuffer* rx_buffer) {
+    NfcError error = NfcErrorTimeout;
+
+    if(mock_config.transcript_pos < mock_config.transcript_num) {
+        const NfcMockFrame* frame = &mock_config.transcript[mock_config.transcript_pos];
+        size_t tx_bits = bit_buffer_get_size(tx_buffer);
+
+        if((frame->request_bits == tx_bits) &&
+           (memcmp(frame->request, bit_buffer_get_data(tx_buffer), (tx_bits + 7) / 8) == 0)) {
+            mock_config.transcript_pos++;
+            if(frame->response) {
+                bit_buffer_copy_bits(rx_buffer, frame->response, frame->response_bits);
+                error = NfcErrorNone;
+            }
+        }
+    }
+
+    return error;
+}
+
+static NfcError nfc_mock_listener_trx(const BitBuffer* tx_buffer, BitBuffer* rx_buffer) {
     furi_check(listener_queue);
-    UNUSED(fwt);
 
     NfcError error = NfcErrorNone;
 
@@ -455,6 +480,37 @@ NfcError
     return error;
 }
 
+NfcError
+    nfc_poller_trx(Nfc* instance, const BitBuffer* tx_buffer, BitBuffer* rx_buffer, uint32_t fwt) {
+    furi_check(instance);
+    furi_check(tx_buffer);
+    furi_check(rx_buffer);
+    furi_check(poller_queue);
+    UNUSED(fwt);
+
+    NfcError error = NfcErrorNone;
+
+    if(mock_config.transcript) {
+        error = nfc_mock_transcript_trx(tx_buffer, rx_buffer);
+    } else {
+        error = nfc_mock_listener_trx(tx_buffer, rx_buffer);
+    }
+
+    mock_config.stats.frames++;
+    mock_config.stats.request_bits += bit_buffer_get_size(tx_buffer);
+    if(error == NfcErrorNone) {
+        mock_config.stats.response_bits += bit_buffer_get_size(rx_buffer);
+    } else {
+        mock_config.stats.timeouts++;
+    }
+
+    if(mock_config.frame_latency_us) {
+        furi_delay_us(mock_config.frame_latency_us);
+    }
+
+    return error;
+}
+
 NfcError nfc_iso14443a_poller_trx_custom_parity(
     Nfc* instance,
     const BitBuffer* tx_buffer,
@@ -518,4 +574,30 @@ NfcError nfc_felica_listener_set_sensf_res_data(
     return NfcErrorNone;
 }
 
+void nfc_mock_set_frame_latency(uint32_t latency_us) {
+    mock_config.frame_latency_us = latency_us;
+}
+
+void nfc_mock_set_transcript(const NfcMockFrame* frames, size_t frames_num) {
+    furi_check(frames || (frames_num == 0));
+
+    mock_config.transcript = frames;
+    mock_config.transcript_num = frames_num;
+    mock_config.transcript_pos = 0;
+}
+
+size_t nfc_mock_get_transcript_position(void) {
+    return mock_config.transcript_pos;
+}
+
+void nfc_mock_get_stats(NfcMockStats* stats) {
+    furi_check(stats);
+
+    *stats = mock_config.stats;
+}
+
+void nfc_mock_reset(void) {
+    memset(&mock_config, 0, sizeof(mock_config));
+}
+
 #endif
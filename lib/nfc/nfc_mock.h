@@ -0,0 +1,77 @@
+/**
+ * @file nfc_mock.h
+ * @brief Controls of the in-process Nfc implementation used by unit tests.
+ *
+ * Only available in firmware built with unit tests, where nfc_mock.c replaces nfc.c.
+ * By default the poller talks to a listener running on another Nfc instance.
+ * Alternatively the card side can be played back from a transcript of recorded frames,
+ * so that pollers can be run without a listener implementation of the card.
+ */
+#pragma once
+
+#include "nfc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Recorded exchange: poller request and card response to it.
+ */
+typedef struct {
+    const uint8_t* request; /**< Request data, CRC included if the protocol uses it. */
+    uint16_t request_bits; /**< Request size in bits. */
+    const uint8_t* response; /**< Response data, NULL if the card keeps silent. */
+    uint16_t response_bits; /**< Response size in bits. */
+} NfcMockFrame;
+
+/**
+ * @brief Poller side traffic counters.
+ */
+typedef struct {
+    uint32_t frames; /**< Frames sent by poller. */
+    uint32_t timeouts; /**< Frames left without response. */
+    uint32_t request_bits; /**< Bits sent by poller. */
+    uint32_t response_bits; /**< Bits received by poller. */
+} NfcMockStats;
+
+/**
+ * @brief Set delay added to every poller frame, to approximate real air time.
+ *
+ * @param[in] latency_us delay in microseconds, 0 to disable.
+ */
+void nfc_mock_set_frame_latency(uint32_t latency_us);
+
+/**
+ * @brief Answer poller frames from a transcript instead of a listener.
+ *
+ * Frames are matched in order: a request equal to the next frame's request gets its response
+ * and advances the transcript, any other request times out.
+ *
+ * @param[in] frames pointer to frames, must stay valid while used. NULL to use listener again.
+ * @param[in] frames_num number of frames.
+ */
+void nfc_mock_set_transcript(const NfcMockFrame* frames, size_t frames_num);
+
+/**
+ * @brief Get number of transcript frames played back so far.
+ *
+ * @returns number of matched frames.
+ */
+size_t nfc_mock_get_transcript_position(void);
+
+/**
+ * @brief Get poller traffic counters since last reset.
+ *
+ * @param[out] stats pointer to the counters to be filled.
+ */
+void nfc_mock_get_stats(NfcMockStats* stats);
+
+/**
+ * @brief Reset counters, frame latency and transcript.
+ */
+void nfc_mock_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -2,11 +2,17 @@
 #include "nfc_poller.h"
 
 #include <nfc/protocols/nfc_poller_defs.h>
+#include <nfc/protocols/iso14443_3a/iso14443_3a.h>
 
 #include <furi/furi.h>
 
 #define TAG "NfcScanner"
 
+/* SAK bits set by MIFARE Classic compatible cards: 1K, 4K, Mini, Plus SL1 and SL2 */
+#define NFC_SCANNER_SAK_MF_CLASSIC_MASK (0x19)
+/* SAK bits never set by MIFARE Ultralight and NTAG cards */
+#define NFC_SCANNER_SAK_NOT_MF_ULTRALIGHT_MASK (0x38)
+
 typedef enum {
     NfcScannerStateIdle,
     NfcScannerStateTryBasePollers,
@@ -51,9 +57,41 @@ struct NfcScanner {
 
     NfcProtocol current_protocol;
 
+    bool iso14443_3a_detected;
+    Iso14443_3aData iso14443_3a_data;
+    uint32_t detection_start;
+
     FuriThread* scan_worker;
 };
 
+typedef bool (*NfcScannerSakFilter)(uint8_t sak);
+
+static bool nfc_scanner_sak_filter_iso14443_4(uint8_t sak) {
+    const Iso14443_3aData data = {.sak = sak};
+    return iso14443_3a_supports_iso14443_4(&data);
+}
+
+static bool nfc_scanner_sak_filter_mf_classic(uint8_t sak) {
+    return sak & NFC_SCANNER_SAK_MF_CLASSIC_MASK;
+}
+
+static bool nfc_scanner_sak_filter_mf_ultralight(uint8_t sak) {
+    return !(sak & NFC_SCANNER_SAK_NOT_MF_ULTRALIGHT_MASK);
+}
+
+/**
+ * ISO14443-3A children which can only be present with a matching SAK.
+ * SAK is taken from the base protocol detection, so ruled out protocols are not probed at all.
+ * MIFARE Plus is not filtered: in SL1 it answers RATS without reporting ISO14443-4 support.
+ */
+static const NfcScannerSakFilter nfc_scanner_sak_filters[NfcProtocolNum] = {
+    [NfcProtocolIso14443_4a] = nfc_scanner_sak_filter_iso14443_4,
+    [NfcProtocolMfUltralight] = nfc_scanner_sak_filter_mf_ultralight,
+    [NfcProtocolMfClassic] = nfc_scanner_sak_filter_mf_classic,
+    [NfcProtocolMfDesfire] = nfc_scanner_sak_filter_iso14443_4,
+    [NfcProtocolEmv] = nfc_scanner_sak_filter_iso14443_4,
+};
+
 static void nfc_scanner_reset(NfcScanner* instance) {
     instance->base_protocols_idx = 0;
     instance->base_protocols_num = 0;
@@ -65,6 +103,20 @@ static void nfc_scanner_reset(NfcScanner* instance) {
     instance->detected_base_protocols_num = 0;
 
     instance->current_protocol = 0;
+
+    instance->iso14443_3a_detected = false;
+}
+
+static bool nfc_scanner_is_ruled_out(NfcScanner* instance, NfcProtocol protocol) {
+    bool ruled_out = false;
+
+    if(instance->iso14443_3a_detected &&
+       nfc_protocol_has_parent(protocol, NfcProtocolIso14443_3a) &&
+       nfc_scanner_sak_filters[protocol]) {
+        ruled_out = !nfc_scanner_sak_filters[protocol](instance->iso14443_3a_data.sak);
+    }
+
+    return ruled_out;
 }
 
 typedef void (*NfcScannerStateHandler)(NfcScanner* instance);
@@ -94,6 +146,11 @@ void nfc_scanner_state_handler_try_base_pollers(NfcScanner* instance) {
 
         NfcPoller* poller = nfc_poller_alloc(instance->nfc, instance->current_protocol);
         bool protocol_detected = nfc_poller_detect(poller);
+        if(protocol_detected && instance->current_protocol == NfcProtocolIso14443_3a) {
+            // Keep activation result to decide which children are worth probing
+            iso14443_3a_copy(&instance->iso14443_3a_data, nfc_poller_get_data(poller));
+            instance->iso14443_3a_detected = true;
+        }
         nfc_poller_free(poller);
 
         if(protocol_detected) {
@@ -106,6 +163,7 @@ void nfc_scanner_state_handler_try_base_pollers(NfcScanner* instance) {
             instance->detected_base_protocols_num++;
 
             if(instance->first_detected_protocol == NfcProtocolInvalid) {
+                instance->detection_start = furi_get_tick();
                 instance->first_detected_protocol = instance->current_protocol;
                 instance->current_protocol = NfcProtocolInvalid;
             }
@@ -117,11 +175,17 @@ void nfc_scanner_state_handler_try_base_pollers(NfcScanner* instance) {
 }
 
 void nfc_scanner_state_handler_find_children_protocols(NfcScanner* instance) {
+    size_t ruled_out_num = 0;
+
     for(size_t i = 0; i < NfcProtocolNum; i++) {
         for(size_t j = 0; j < instance->detected_base_protocols_num; j++) {
             if(nfc_protocol_has_parent(i, instance->detected_base_protocols[j])) {
-                instance->children_protocols[instance->children_protocols_num] = i;
-                instance->children_protocols_num++;
+                if(nfc_scanner_is_ruled_out(instance, i)) {
+                    ruled_out_num++;
+                } else {
+                    instance->children_protocols[instance->children_protocols_num] = i;
+                    instance->children_protocols_num++;
+                }
             }
         }
     }
@@ -131,7 +195,11 @@ void nfc_scanner_state_handler_find_children_protocols(NfcScanner* instance) {
     } else {
         instance->state = NfcScannerStateComplete;
     }
-    FURI_LOG_D(TAG, "Found %zu children", instance->children_protocols_num);
+    FURI_LOG_D(
+        TAG,
+        "Found %zu children, %zu ruled out by SAK",
+        instance->children_protocols_num,
+        ruled_out_num);
 }
 
 void nfc_scanner_state_handler_detect_children_protocols(NfcScanner* instance) {
@@ -180,7 +248,11 @@ void nfc_scanner_state_handler_complete(NfcScanner* instance) {
     if(instance->detected_protocols_num > 1) {
         nfc_scanner_filter_detected_protocols(instance);
     }
-    FURI_LOG_I(TAG, "Detected %zu protocols", instance->detected_protocols_num);
+    FURI_LOG_I(
+        TAG,
+        "Detected %zu protocols in %lu ms",
+        instance->detected_protocols_num,
+        furi_get_tick() - instance->detection_start);
 
     NfcScannerEvent event = {
         .type = NfcScannerEventTypeDetected,
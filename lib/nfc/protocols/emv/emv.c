@@ -6,9 +6,13 @@
 #include <furi.h>
 #include <stdlib.h>
 #include <string.h>
+#include <nfc/helpers/nfc_binary_stream.h>
 
 #define EMV_PROTOCOL_NAME "EMV"
 
+static bool emv_load_binary(EmvData* data, Stream* stream);
+static bool emv_save_binary(const EmvData* data, Stream* stream);
+
 const NfcDeviceBase nfc_device_emv = {
     .protocol_name = EMV_PROTOCOL_NAME,
     .alloc = (NfcDeviceAlloc)emv_alloc,
@@ -23,6 +27,8 @@ const NfcDeviceBase nfc_device_emv = {
     .get_uid = (NfcDeviceGetUid)emv_get_uid,
     .set_uid = (NfcDeviceSetUid)emv_set_uid,
     .get_base_data = (NfcDeviceGetBaseData)emv_get_base_data,
+    .load_binary = (NfcDeviceLoadBinary)emv_load_binary,
+    .save_binary = (NfcDeviceSaveBinary)emv_save_binary,
 };
 
 EmvData* emv_alloc(void) {
@@ -214,3 +220,15 @@ Iso14443_4aData* emv_get_base_data(const EmvData* data) {
 
     return data->iso14443_4a_data;
 }
+
+static bool emv_load_binary(EmvData* data, Stream* stream) {
+    furi_check(data);
+
+    return nfc_binary_stream_read(stream, &data->emv_application, sizeof(EmvApplication));
+}
+
+static bool emv_save_binary(const EmvData* data, Stream* stream) {
+    furi_check(data);
+
+    return nfc_binary_stream_write(stream, &data->emv_application, sizeof(EmvApplication));
+}
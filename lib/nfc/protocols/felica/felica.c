@@ -3,6 +3,7 @@
 #include <furi.h>
 
 #include <nfc/nfc_common.h>
+#include <nfc/helpers/nfc_binary_stream.h>
 
 #define FELICA_PROTOCOL_NAME "FeliCa"
 #define FELICA_DEVICE_NAME   "FeliCa"
@@ -21,6 +22,9 @@ typedef enum {
     FelicaMACTypeWrite,
 } FelicaMACType;
 
+static bool felica_load_binary(FelicaData* data, Stream* stream);
+static bool felica_save_binary(const FelicaData* data, Stream* stream);
+
 const NfcDeviceBase nfc_device_felica = {
     .protocol_name = FELICA_PROTOCOL_NAME,
     .alloc = (NfcDeviceAlloc)felica_alloc,
@@ -35,6 +39,8 @@ const NfcDeviceBase nfc_device_felica = {
     .get_uid = (NfcDeviceGetUid)felica_get_uid,
     .set_uid = (NfcDeviceSetUid)felica_set_uid,
     .get_base_data = (NfcDeviceGetBaseData)felica_get_base_data,
+    .load_binary = (NfcDeviceLoadBinary)felica_load_binary,
+    .save_binary = (NfcDeviceSaveBinary)felica_save_binary,
 };
 
 FelicaData* felica_alloc(void) {
@@ -191,6 +197,18 @@ FelicaData* felica_get_base_data(const FelicaData* data) {
     furi_crash("No base data");
 }
 
+static bool felica_load_binary(FelicaData* data, Stream* stream) {
+    furi_check(data);
+
+    return nfc_binary_stream_read(stream, data, sizeof(FelicaData));
+}
+
+static bool felica_save_binary(const FelicaData* data, Stream* stream) {
+    furi_check(data);
+
+    return nfc_binary_stream_write(stream, data, sizeof(FelicaData));
+}
+
 static void felica_reverse_copy_block(const uint8_t* array, uint8_t* reverse_array) {
     furi_assert(array);
     furi_assert(reverse_array);
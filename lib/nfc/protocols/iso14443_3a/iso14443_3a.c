@@ -2,6 +2,7 @@
 
 #include <furi.h>
 #include <nfc/nfc_common.h>
+#include <nfc/helpers/nfc_binary_stream.h>
 
 #define ISO14443A_ATS_BIT (1U << 5)
 
@@ -12,6 +13,9 @@
 #define ISO14443_3A_ATQA_KEY "ATQA"
 #define ISO14443_3A_SAK_KEY  "SAK"
 
+static bool iso14443_3a_load_binary(Iso14443_3aData* data, Stream* stream);
+static bool iso14443_3a_save_binary(const Iso14443_3aData* data, Stream* stream);
+
 const NfcDeviceBase nfc_device_iso14443_3a = {
     .protocol_name = ISO14443_3A_PROTOCOL_NAME,
     .alloc = (NfcDeviceAlloc)iso14443_3a_alloc,
@@ -26,6 +30,8 @@ const NfcDeviceBase nfc_device_iso14443_3a = {
     .get_uid = (NfcDeviceGetUid)iso14443_3a_get_uid,
     .set_uid = (NfcDeviceSetUid)iso14443_3a_set_uid,
     .get_base_data = (NfcDeviceGetBaseData)iso14443_3a_get_base_data,
+    .load_binary = (NfcDeviceLoadBinary)iso14443_3a_load_binary,
+    .save_binary = (NfcDeviceSaveBinary)iso14443_3a_save_binary,
 };
 
 Iso14443_3aData* iso14443_3a_alloc(void) {
@@ -146,6 +152,18 @@ Iso14443_3aData* iso14443_3a_get_base_data(const Iso14443_3aData* data) {
     furi_crash("No base data");
 }
 
+static bool iso14443_3a_load_binary(Iso14443_3aData* data, Stream* stream) {
+    furi_check(data);
+
+    return nfc_binary_stream_read(stream, data, sizeof(Iso14443_3aData));
+}
+
+static bool iso14443_3a_save_binary(const Iso14443_3aData* data, Stream* stream) {
+    furi_check(data);
+
+    return nfc_binary_stream_write(stream, data, sizeof(Iso14443_3aData));
+}
+
 uint32_t iso14443_3a_get_cuid(const Iso14443_3aData* data) {
     furi_check(data);
 
@@ -5,6 +5,7 @@
 
 #include <nfc/nfc_common.h>
 #include <nfc/helpers/iso14443_crc.h>
+#include <nfc/helpers/nfc_binary_stream.h>
 
 #define ISO14443_3B_PROTOCOL_NAME "ISO14443-3B"
 #define ISO14443_3B_DEVICE_NAME   "ISO14443-3B (Unknown)"
@@ -14,6 +15,9 @@
 
 #define ISO14443_3B_FDT_POLL_DEFAULT_FC (ISO14443_3B_FDT_POLL_FC)
 
+static bool iso14443_3b_load_binary(Iso14443_3bData* data, Stream* stream);
+static bool iso14443_3b_save_binary(const Iso14443_3bData* data, Stream* stream);
+
 const NfcDeviceBase nfc_device_iso14443_3b = {
     .protocol_name = ISO14443_3B_PROTOCOL_NAME,
     .alloc = (NfcDeviceAlloc)iso14443_3b_alloc,
@@ -28,6 +32,8 @@ const NfcDeviceBase nfc_device_iso14443_3b = {
     .get_uid = (NfcDeviceGetUid)iso14443_3b_get_uid,
     .set_uid = (NfcDeviceSetUid)iso14443_3b_set_uid,
     .get_base_data = (NfcDeviceGetBaseData)iso14443_3b_get_base_data,
+    .load_binary = (NfcDeviceLoadBinary)iso14443_3b_load_binary,
+    .save_binary = (NfcDeviceSaveBinary)iso14443_3b_save_binary,
 };
 
 Iso14443_3bData* iso14443_3b_alloc(void) {
@@ -150,6 +156,18 @@ Iso14443_3bData* iso14443_3b_get_base_data(const Iso14443_3bData* data) {
     furi_crash("No base data");
 }
 
+static bool iso14443_3b_load_binary(Iso14443_3bData* data, Stream* stream) {
+    furi_check(data);
+
+    return nfc_binary_stream_read(stream, data, sizeof(Iso14443_3bData));
+}
+
+static bool iso14443_3b_save_binary(const Iso14443_3bData* data, Stream* stream) {
+    furi_check(data);
+
+    return nfc_binary_stream_write(stream, data, sizeof(Iso14443_3bData));
+}
+
 bool iso14443_3b_supports_iso14443_4(const Iso14443_3bData* data) {
     furi_check(data);
 
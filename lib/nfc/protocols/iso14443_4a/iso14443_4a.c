@@ -1,6 +1,7 @@
 #include "iso14443_4a_i.h"
 
 #include <furi.h>
+#include <nfc/helpers/nfc_binary_stream.h>
 
 #define ISO14443_4A_PROTOCOL_NAME "ISO14443-4A"
 #define ISO14443_4A_DEVICE_NAME   "ISO14443-4A (Unknown)"
@@ -19,6 +20,9 @@ typedef enum {
     Iso14443_4aInterfaceByteTC1,
 } Iso14443_4aInterfaceByte;
 
+static bool iso14443_4a_load_binary(Iso14443_4aData* data, Stream* stream);
+static bool iso14443_4a_save_binary(const Iso14443_4aData* data, Stream* stream);
+
 const NfcDeviceBase nfc_device_iso14443_4a = {
     .protocol_name = ISO14443_4A_PROTOCOL_NAME,
     .alloc = (NfcDeviceAlloc)iso14443_4a_alloc,
@@ -33,6 +37,8 @@ const NfcDeviceBase nfc_device_iso14443_4a = {
     .get_uid = (NfcDeviceGetUid)iso14443_4a_get_uid,
     .set_uid = (NfcDeviceSetUid)iso14443_4a_set_uid,
     .get_base_data = (NfcDeviceGetBaseData)iso14443_4a_get_base_data,
+    .load_binary = (NfcDeviceLoadBinary)iso14443_4a_load_binary,
+    .save_binary = (NfcDeviceSaveBinary)iso14443_4a_save_binary,
 };
 
 Iso14443_4aData* iso14443_4a_alloc(void) {
@@ -219,6 +225,22 @@ Iso14443_3aData* iso14443_4a_get_base_data(const Iso14443_4aData* data) {
     return data->iso14443_3a_data;
 }
 
+static bool iso14443_4a_load_binary(Iso14443_4aData* data, Stream* stream) {
+    furi_check(data);
+
+    return nfc_binary_stream_read(
+               stream, &data->ats_data, offsetof(Iso14443_4aAtsData, t1_tk)) &&
+           nfc_binary_stream_read_array(stream, data->ats_data.t1_tk, sizeof(uint8_t));
+}
+
+static bool iso14443_4a_save_binary(const Iso14443_4aData* data, Stream* stream) {
+    furi_check(data);
+
+    return nfc_binary_stream_write(
+               stream, &data->ats_data, offsetof(Iso14443_4aAtsData, t1_tk)) &&
+           nfc_binary_stream_write_array(stream, data->ats_data.t1_tk, sizeof(uint8_t));
+}
+
 uint16_t iso14443_4a_get_frame_size_max(const Iso14443_4aData* data) {
     furi_check(data);
 
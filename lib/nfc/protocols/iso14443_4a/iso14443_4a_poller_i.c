@@ -12,6 +12,7 @@
 #define ISO14443_4A_WTXM_MASK               (0x3FU)
 #define ISO14443_4A_WTXM_MAX                (0x3BU)
 #define ISO14443_4A_SWTX                    (0xF2U)
+#define ISO14443_4A_BLOCK_OVERHEAD          (3U) /* PCB and CRC */
 
 Iso14443_4aError iso14443_4a_poller_halt(Iso14443_4aPoller* instance) {
     furi_check(instance);
@@ -56,6 +57,53 @@ Iso14443_4aError
     return error;
 }
 
+// Send prepared block and receive answer to it, serving waiting time extension requests
+static Iso14443_4aError iso14443_4a_poller_send_frame(Iso14443_4aPoller* instance) {
+    Iso14443_3aError iso14443_3a_error = iso14443_3a_poller_send_standard_frame(
+        instance->iso14443_3a_poller,
+        instance->tx_buffer,
+        instance->rx_buffer,
+        iso14443_4a_get_fwt_fc_max(instance->data));
+
+    if(iso14443_3a_error != Iso14443_3aErrorNone) {
+        return iso14443_4a_process_error(iso14443_3a_error);
+    }
+
+    while(bit_buffer_starts_with_byte(instance->rx_buffer, ISO14443_4A_SWTX)) {
+        uint8_t wtxm = bit_buffer_get_byte(instance->rx_buffer, 1) & ISO14443_4A_WTXM_MASK;
+        if(wtxm > ISO14443_4A_WTXM_MAX) {
+            return Iso14443_4aErrorProtocol;
+        }
+
+        bit_buffer_reset(instance->tx_buffer);
+        bit_buffer_copy_left(instance->tx_buffer, instance->rx_buffer, 1);
+        bit_buffer_append_byte(instance->tx_buffer, wtxm);
+
+        iso14443_3a_error = iso14443_3a_poller_send_standard_frame(
+            instance->iso14443_3a_poller,
+            instance->tx_buffer,
+            instance->rx_buffer,
+            MAX(iso14443_4a_get_fwt_fc_max(instance->data) * wtxm, ISO14443_4A_FWT_MAX));
+
+        if(iso14443_3a_error != Iso14443_3aErrorNone) {
+            return iso14443_4a_process_error(iso14443_3a_error);
+        }
+    }
+
+    return Iso14443_4aErrorNone;
+}
+
+// Largest information field which both card and poller buffer can take in one block
+static size_t iso14443_4a_poller_get_inf_size_max(Iso14443_4aPoller* instance) {
+    size_t frame_size = bit_buffer_get_capacity_bytes(instance->tx_buffer);
+    const uint16_t card_frame_size = iso14443_4a_get_frame_size_max(instance->data);
+    if(card_frame_size > 0) {
+        frame_size = MIN(frame_size, card_frame_size);
+    }
+
+    return frame_size - ISO14443_4A_BLOCK_OVERHEAD;
+}
+
 Iso14443_4aError iso14443_4a_poller_send_block(
     Iso14443_4aPoller* instance,
     const BitBuffer* tx_buffer,
@@ -64,54 +112,52 @@ Iso14443_4aError iso14443_4a_poller_send_block(
     furi_check(tx_buffer);
     furi_check(rx_buffer);
 
-    bit_buffer_reset(instance->tx_buffer);
-    iso14443_4_layer_encode_block(instance->iso14443_4_layer, tx_buffer, instance->tx_buffer);
-
     Iso14443_4aError error = Iso14443_4aErrorNone;
+    const size_t inf_size_max = iso14443_4a_poller_get_inf_size_max(instance);
+    const size_t tx_size = bit_buffer_get_size_bytes(tx_buffer);
+    size_t tx_offset = 0;
+    bool chaining = false;
 
+    // Request which doesn't fit into card frame is sent in chained blocks
     do {
-        Iso14443_3aError iso14443_3a_error = iso14443_3a_poller_send_standard_frame(
-            instance->iso14443_3a_poller,
-            instance->tx_buffer,
-            instance->rx_buffer,
-            iso14443_4a_get_fwt_fc_max(instance->data));
-
-        if(iso14443_3a_error != Iso14443_3aErrorNone) {
-            error = iso14443_4a_process_error(iso14443_3a_error);
+        const size_t block_size = MIN(tx_size - tx_offset, inf_size_max);
+        chaining = tx_offset + block_size < tx_size;
+
+        bit_buffer_reset(instance->tx_buffer);
+        iso14443_4_layer_encode_chained_block(
+            instance->iso14443_4_layer,
+            tx_buffer,
+            tx_offset,
+            block_size,
+            chaining,
+            instance->tx_buffer);
+
+        error = iso14443_4a_poller_send_frame(instance);
+        if(error != Iso14443_4aErrorNone) break;
+
+        if(chaining &&
+           !iso14443_4_layer_check_ack(instance->iso14443_4_layer, instance->rx_buffer)) {
+            error = Iso14443_4aErrorProtocol;
             break;
         }
 
-        if(bit_buffer_starts_with_byte(instance->rx_buffer, ISO14443_4A_SWTX)) {
-            do {
-                uint8_t wtxm = bit_buffer_get_byte(instance->rx_buffer, 1) & ISO14443_4A_WTXM_MASK;
-                if(wtxm > ISO14443_4A_WTXM_MAX) {
-                    return Iso14443_4aErrorProtocol;
-                }
-
-                bit_buffer_reset(instance->tx_buffer);
-                bit_buffer_copy_left(instance->tx_buffer, instance->rx_buffer, 1);
-                bit_buffer_append_byte(instance->tx_buffer, wtxm);
-
-                iso14443_3a_error = iso14443_3a_poller_send_standard_frame(
-                    instance->iso14443_3a_poller,
-                    instance->tx_buffer,
-                    instance->rx_buffer,
-                    MAX(iso14443_4a_get_fwt_fc_max(instance->data) * wtxm, ISO14443_4A_FWT_MAX));
-
-                if(iso14443_3a_error != Iso14443_3aErrorNone) {
-                    error = iso14443_4a_process_error(iso14443_3a_error);
-                    return error;
-                }
-
-            } while(bit_buffer_starts_with_byte(instance->rx_buffer, ISO14443_4A_SWTX));
-        }
+        tx_offset += block_size;
+    } while(chaining);
 
-        if(!iso14443_4_layer_decode_block(
-               instance->iso14443_4_layer, rx_buffer, instance->rx_buffer)) {
+    // Chained response is collected right into rx_buffer, acknowledging every block
+    bit_buffer_reset(rx_buffer);
+    while(error == Iso14443_4aErrorNone) {
+        if(!iso14443_4_layer_decode_chained_block(
+               instance->iso14443_4_layer, rx_buffer, instance->rx_buffer, &chaining)) {
             error = Iso14443_4aErrorProtocol;
             break;
         }
-    } while(false);
+        if(!chaining) break;
+
+        bit_buffer_reset(instance->tx_buffer);
+        iso14443_4_layer_encode_ack(instance->iso14443_4_layer, instance->tx_buffer);
+        error = iso14443_4a_poller_send_frame(instance);
+    }
 
     return error;
 }
@@ -2,10 +2,14 @@
 
 #include <furi.h>
 #include <nfc/protocols/nfc_device_base_i.h>
+#include <nfc/helpers/nfc_binary_stream.h>
 
 #define ISO14443_4B_PROTOCOL_NAME "ISO14443-4B"
 #define ISO14443_4B_DEVICE_NAME   "ISO14443-4B (Unknown)"
 
+static bool iso14443_4b_load_binary(Iso14443_4bData* data, Stream* stream);
+static bool iso14443_4b_save_binary(const Iso14443_4bData* data, Stream* stream);
+
 const NfcDeviceBase nfc_device_iso14443_4b = {
     .protocol_name = ISO14443_4B_PROTOCOL_NAME,
     .alloc = (NfcDeviceAlloc)iso14443_4b_alloc,
@@ -20,6 +24,8 @@ const NfcDeviceBase nfc_device_iso14443_4b = {
     .get_uid = (NfcDeviceGetUid)iso14443_4b_get_uid,
     .set_uid = (NfcDeviceSetUid)iso14443_4b_set_uid,
     .get_base_data = (NfcDeviceGetBaseData)iso14443_4b_get_base_data,
+    .load_binary = (NfcDeviceLoadBinary)iso14443_4b_load_binary,
+    .save_binary = (NfcDeviceSaveBinary)iso14443_4b_save_binary,
 };
 
 Iso14443_4bData* iso14443_4b_alloc(void) {
@@ -101,3 +107,18 @@ Iso14443_3bData* iso14443_4b_get_base_data(const Iso14443_4bData* data) {
 
     return data->iso14443_3b_data;
 }
+
+static bool iso14443_4b_load_binary(Iso14443_4bData* data, Stream* stream) {
+    furi_check(data);
+    UNUSED(stream);
+
+    // No data besides the ISO14443-3B one
+    return true;
+}
+
+static bool iso14443_4b_save_binary(const Iso14443_4bData* data, Stream* stream) {
+    furi_check(data);
+    UNUSED(stream);
+
+    return true;
+}
@@ -2,6 +2,7 @@
 #include "iso15693_3_device_defs.h"
 
 #include <nfc/nfc_common.h>
+#include <nfc/helpers/nfc_binary_stream.h>
 
 #define ISO15693_3_PROTOCOL_NAME        "ISO15693-3"
 #define ISO15693_3_PROTOCOL_NAME_LEGACY "ISO15693"
@@ -20,6 +21,9 @@
 #define ISO15693_3_LOCK_AFI_KEY        "Lock AFI"
 #define ISO15693_3_SECURITY_STATUS_KEY "Security Status"
 
+static bool iso15693_3_load_binary(Iso15693_3Data* data, Stream* stream);
+static bool iso15693_3_save_binary(const Iso15693_3Data* data, Stream* stream);
+
 const NfcDeviceBase nfc_device_iso15693_3 = {
     .protocol_name = ISO15693_3_PROTOCOL_NAME,
     .alloc = (NfcDeviceAlloc)iso15693_3_alloc,
@@ -34,6 +38,8 @@ const NfcDeviceBase nfc_device_iso15693_3 = {
     .get_uid = (NfcDeviceGetUid)iso15693_3_get_uid,
     .set_uid = (NfcDeviceSetUid)iso15693_3_set_uid,
     .get_base_data = (NfcDeviceGetBaseData)iso15693_3_get_base_data,
+    .load_binary = (NfcDeviceLoadBinary)iso15693_3_load_binary,
+    .save_binary = (NfcDeviceSaveBinary)iso15693_3_save_binary,
 };
 
 Iso15693_3Data* iso15693_3_alloc(void) {
@@ -331,6 +337,22 @@ Iso15693_3Data* iso15693_3_get_base_data(const Iso15693_3Data* data) {
     furi_crash("No base data");
 }
 
+static bool iso15693_3_load_binary(Iso15693_3Data* data, Stream* stream) {
+    furi_check(data);
+
+    return nfc_binary_stream_read(stream, data, offsetof(Iso15693_3Data, block_data)) &&
+           nfc_binary_stream_read_array(stream, data->block_data, sizeof(uint8_t)) &&
+           nfc_binary_stream_read_array(stream, data->block_security, sizeof(uint8_t));
+}
+
+static bool iso15693_3_save_binary(const Iso15693_3Data* data, Stream* stream) {
+    furi_check(data);
+
+    return nfc_binary_stream_write(stream, data, offsetof(Iso15693_3Data, block_data)) &&
+           nfc_binary_stream_write_array(stream, data->block_data, sizeof(uint8_t)) &&
+           nfc_binary_stream_write_array(stream, data->block_security, sizeof(uint8_t));
+}
+
 bool iso15693_3_is_block_locked(const Iso15693_3Data* data, uint8_t block_index) {
     furi_check(data);
     furi_check(block_index < data->system_info.block_count);
@@ -4,6 +4,7 @@
 #include <toolbox/hex.h>
 
 #include <lib/bit_lib/bit_lib.h>
+#include <nfc/helpers/nfc_binary_stream.h>
 
 #define MF_CLASSIC_PROTOCOL_NAME "Mifare Classic"
 
@@ -40,6 +41,9 @@ static const MfClassicFeatures mf_classic_features[MfClassicTypeNum] = {
         },
 };
 
+static bool mf_classic_load_binary(MfClassicData* data, Stream* stream);
+static bool mf_classic_save_binary(const MfClassicData* data, Stream* stream);
+
 const NfcDeviceBase nfc_device_mf_classic = {
     .protocol_name = MF_CLASSIC_PROTOCOL_NAME,
     .alloc = (NfcDeviceAlloc)mf_classic_alloc,
@@ -54,6 +58,8 @@ const NfcDeviceBase nfc_device_mf_classic = {
     .get_uid = (NfcDeviceGetUid)mf_classic_get_uid,
     .set_uid = (NfcDeviceSetUid)mf_classic_set_uid,
     .get_base_data = (NfcDeviceGetBaseData)mf_classic_get_base_data,
+    .load_binary = (NfcDeviceLoadBinary)mf_classic_load_binary,
+    .save_binary = (NfcDeviceSaveBinary)mf_classic_save_binary,
 };
 
 MfClassicData* mf_classic_alloc(void) {
@@ -106,11 +112,11 @@ static void mf_classic_parse_block(FuriString* block_str, MfClassicData* data, u
     uint16_t block_unknown_bytes_mask = 0;
 
     furi_string_trim(block_str);
+    const char* block_chars = furi_string_get_cstr(block_str);
+    const size_t block_chars_len = furi_string_size(block_str);
     for(size_t i = 0; i < MF_CLASSIC_BLOCK_SIZE; i++) {
-        char hi = furi_string_get_char(block_str, 3 * i);
-        char low = furi_string_get_char(block_str, 3 * i + 1);
         uint8_t byte = 0;
-        if(hex_char_to_uint8(hi, low, &byte)) {
+        if(3 * i + 2 <= block_chars_len && hex_decode(&block_chars[3 * i], 2, &byte)) {
             block_tmp.data[i] = byte;
         } else {
             FURI_BIT_SET(block_unknown_bytes_mask, i);
@@ -382,6 +388,20 @@ Iso14443_3aData* mf_classic_get_base_data(const MfClassicData* data) {
     return data->iso14443_3a_data;
 }
 
+static bool mf_classic_load_binary(MfClassicData* data, Stream* stream) {
+    furi_check(data);
+
+    return nfc_binary_stream_read(
+        stream, &data->type, sizeof(MfClassicData) - offsetof(MfClassicData, type));
+}
+
+static bool mf_classic_save_binary(const MfClassicData* data, Stream* stream) {
+    furi_check(data);
+
+    return nfc_binary_stream_write(
+        stream, &data->type, sizeof(MfClassicData) - offsetof(MfClassicData, type));
+}
+
 uint8_t mf_classic_get_total_sectors_num(MfClassicType type) {
     furi_check(type < MfClassicTypeNum);
     return mf_classic_features[type].sectors_total;
@@ -434,6 +434,9 @@ NfcCommand mf_classic_poller_handler_request_read_sector(MfClassicPoller* instan
 
     if(!sec_read->key_provided) {
         instance->state = MfClassicPollerStateSuccess;
+    } else if(mf_classic_is_sector_read(instance->data, sec_read->sector_num)) {
+        // Both keys are known and all blocks are read: another auth would only cost time
+        FURI_LOG_D(TAG, "Sector %d is already read", sec_read->sector_num);
     } else {
         sec_read_ctx->current_sector = sec_read->sector_num;
         sec_read_ctx->key = sec_read->key;
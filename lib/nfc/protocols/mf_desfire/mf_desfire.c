@@ -4,6 +4,9 @@
 
 #define MF_DESFIRE_PROTOCOL_NAME "Mifare DESFire"
 
+static bool mf_desfire_load_binary(MfDesfireData* data, Stream* stream);
+static bool mf_desfire_save_binary(const MfDesfireData* data, Stream* stream);
+
 const NfcDeviceBase nfc_device_mf_desfire = {
     .protocol_name = MF_DESFIRE_PROTOCOL_NAME,
     .alloc = (NfcDeviceAlloc)mf_desfire_alloc,
@@ -18,6 +21,8 @@ const NfcDeviceBase nfc_device_mf_desfire = {
     .get_uid = (NfcDeviceGetUid)mf_desfire_get_uid,
     .set_uid = (NfcDeviceSetUid)mf_desfire_set_uid,
     .get_base_data = (NfcDeviceGetBaseData)mf_desfire_get_base_data,
+    .load_binary = (NfcDeviceLoadBinary)mf_desfire_load_binary,
+    .save_binary = (NfcDeviceSaveBinary)mf_desfire_save_binary,
 };
 
 MfDesfireData* mf_desfire_alloc(void) {
@@ -253,6 +258,79 @@ Iso14443_4aData* mf_desfire_get_base_data(const MfDesfireData* data) {
     return data->iso14443_4a_data;
 }
 
+static bool mf_desfire_load_binary(MfDesfireData* data, Stream* stream) {
+    furi_check(data);
+
+    bool success = false;
+
+    do {
+        if(!nfc_binary_stream_read(
+               stream,
+               &data->version,
+               offsetof(MfDesfireData, master_key_versions) - offsetof(MfDesfireData, version)))
+            break;
+        if(!nfc_binary_stream_read_array(
+               stream, data->master_key_versions, sizeof(MfDesfireKeyVersion)))
+            break;
+        if(!nfc_binary_stream_read_array(
+               stream, data->application_ids, sizeof(MfDesfireApplicationId)))
+            break;
+
+        const uint32_t application_count = simple_array_get_count(data->application_ids);
+        if(application_count > 0) {
+            simple_array_init(data->applications, application_count);
+        }
+
+        uint32_t i;
+        for(i = 0; i < application_count; ++i) {
+            MfDesfireApplication* application = simple_array_get(data->applications, i);
+            if(!mf_desfire_application_load_binary(application, stream)) break;
+        }
+
+        if(i != application_count) break;
+
+        success = true;
+    } while(false);
+
+    return success;
+}
+
+static bool mf_desfire_save_binary(const MfDesfireData* data, Stream* stream) {
+    furi_check(data);
+
+    bool success = false;
+
+    do {
+        if(!nfc_binary_stream_write(
+               stream,
+               &data->version,
+               offsetof(MfDesfireData, master_key_versions) - offsetof(MfDesfireData, version)))
+            break;
+        if(!nfc_binary_stream_write_array(
+               stream, data->master_key_versions, sizeof(MfDesfireKeyVersion)))
+            break;
+        if(!nfc_binary_stream_write_array(
+               stream, data->application_ids, sizeof(MfDesfireApplicationId)))
+            break;
+
+        const uint32_t application_count = simple_array_get_count(data->applications);
+        if(application_count != simple_array_get_count(data->application_ids)) break;
+
+        uint32_t i;
+        for(i = 0; i < application_count; ++i) {
+            if(!mf_desfire_application_save_binary(
+                   simple_array_cget(data->applications, i), stream))
+                break;
+        }
+
+        if(i != application_count) break;
+
+        success = true;
+    } while(false);
+
+    return success;
+}
+
 const MfDesfireApplication*
     mf_desfire_get_application(const MfDesfireData* data, const MfDesfireApplicationId* app_id) {
     furi_check(data);
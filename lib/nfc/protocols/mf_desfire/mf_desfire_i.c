@@ -797,6 +797,73 @@ bool mf_desfire_application_save(
     return success;
 }
 
+bool mf_desfire_application_load_binary(MfDesfireApplication* data, Stream* stream) {
+    bool success = false;
+
+    do {
+        if(!nfc_binary_stream_read(stream, &data->key_settings, sizeof(MfDesfireKeySettings)))
+            break;
+        if(!nfc_binary_stream_read_array(stream, data->key_versions, sizeof(MfDesfireKeyVersion)))
+            break;
+        if(!nfc_binary_stream_read_array(stream, data->file_ids, sizeof(MfDesfireFileId))) break;
+        if(!nfc_binary_stream_read_array(
+               stream, data->file_settings, sizeof(MfDesfireFileSettings)))
+            break;
+
+        uint32_t file_count;
+        if(!nfc_binary_stream_read_count(stream, &file_count, sizeof(uint32_t))) break;
+        if(file_count > MF_DESFIRE_MAX_FILES) break;
+
+        if(file_count > 0) {
+            simple_array_init(data->file_data, file_count);
+        }
+
+        uint32_t i;
+        for(i = 0; i < file_count; ++i) {
+            MfDesfireFileData* file_data = simple_array_get(data->file_data, i);
+            if(!nfc_binary_stream_read_array(stream, file_data->data, sizeof(uint8_t))) break;
+        }
+
+        if(i != file_count) break;
+
+        success = true;
+    } while(false);
+
+    return success;
+}
+
+bool mf_desfire_application_save_binary(const MfDesfireApplication* data, Stream* stream) {
+    bool success = false;
+
+    do {
+        if(!nfc_binary_stream_write(stream, &data->key_settings, sizeof(MfDesfireKeySettings)))
+            break;
+        if(!nfc_binary_stream_write_array(
+               stream, data->key_versions, sizeof(MfDesfireKeyVersion)))
+            break;
+        if(!nfc_binary_stream_write_array(stream, data->file_ids, sizeof(MfDesfireFileId)))
+            break;
+        if(!nfc_binary_stream_write_array(
+               stream, data->file_settings, sizeof(MfDesfireFileSettings)))
+            break;
+
+        const uint32_t file_count = simple_array_get_count(data->file_data);
+        if(!nfc_binary_stream_write(stream, &file_count, sizeof(file_count))) break;
+
+        uint32_t i;
+        for(i = 0; i < file_count; ++i) {
+            const MfDesfireFileData* file_data = simple_array_cget(data->file_data, i);
+            if(!nfc_binary_stream_write_array(stream, file_data->data, sizeof(uint8_t))) break;
+        }
+
+        if(i != file_count) break;
+
+        success = true;
+    } while(false);
+
+    return success;
+}
+
 const SimpleArrayConfig mf_desfire_key_version_array_config = {
     .init = NULL,
     .copy = NULL,
@@ -2,6 +2,8 @@
 
 #include "mf_desfire.h"
 
+#include <nfc/helpers/nfc_binary_stream.h>
+
 #define MF_DESFIRE_FFF_PICC_PREFIX "PICC"
 #define MF_DESFIRE_FFF_APP_PREFIX  "Application"
 
@@ -184,3 +186,9 @@ bool mf_desfire_application_save(
     const MfDesfireApplication* data,
     const char* prefix,
     FlipperFormat* ff);
+
+// Load and save internal MfDesfire structures in binary form
+
+bool mf_desfire_application_load_binary(MfDesfireApplication* data, Stream* stream);
+
+bool mf_desfire_application_save_binary(const MfDesfireApplication* data, Stream* stream);
@@ -7,6 +7,7 @@
 #define TAG "MfDesfirePoller"
 
 #define MF_DESFIRE_BUF_SIZE        (64U)
+#define MF_DESFIRE_RX_BUF_SIZE     (256U) /* Whole response of ISO14443-4 layer */
 #define MF_DESFIRE_RESULT_BUF_SIZE (512U)
 
 typedef NfcCommand (*MfDesfirePollerReadHandler)(MfDesfirePoller* instance);
@@ -22,7 +23,7 @@ static MfDesfirePoller* mf_desfire_poller_alloc(Iso14443_4aPoller* iso14443_4a_p
     instance->iso14443_4a_poller = iso14443_4a_poller;
     instance->data = mf_desfire_alloc();
     instance->tx_buffer = bit_buffer_alloc(MF_DESFIRE_BUF_SIZE);
-    instance->rx_buffer = bit_buffer_alloc(MF_DESFIRE_BUF_SIZE);
+    instance->rx_buffer = bit_buffer_alloc(MF_DESFIRE_RX_BUF_SIZE);
     instance->input_buffer = bit_buffer_alloc(MF_DESFIRE_BUF_SIZE);
     instance->result_buffer = bit_buffer_alloc(MF_DESFIRE_RESULT_BUF_SIZE);
 
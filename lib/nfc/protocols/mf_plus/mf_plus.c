@@ -2,6 +2,7 @@
 
 #include <bit_lib/bit_lib.h>
 #include <furi.h>
+#include <nfc/helpers/nfc_binary_stream.h>
 
 #define MF_PLUS_PROTOCOL_NAME "Mifare Plus"
 
@@ -30,6 +31,9 @@ static const char* mf_plus_security_level_strings[] = {
     [MfPlusSecurityLevelUnknown] = "Unknown",
 };
 
+static bool mf_plus_load_binary(MfPlusData* data, Stream* stream);
+static bool mf_plus_save_binary(const MfPlusData* data, Stream* stream);
+
 const NfcDeviceBase nfc_device_mf_plus = {
     .protocol_name = MF_PLUS_PROTOCOL_NAME,
     .alloc = (NfcDeviceAlloc)mf_plus_alloc,
@@ -44,6 +48,8 @@ const NfcDeviceBase nfc_device_mf_plus = {
     .get_uid = (NfcDeviceGetUid)mf_plus_get_uid,
     .set_uid = (NfcDeviceSetUid)mf_plus_set_uid,
     .get_base_data = (NfcDeviceGetBaseData)mf_plus_get_base_data,
+    .load_binary = (NfcDeviceLoadBinary)mf_plus_load_binary,
+    .save_binary = (NfcDeviceSaveBinary)mf_plus_save_binary,
 };
 
 MfPlusData* mf_plus_alloc(void) {
@@ -178,3 +184,17 @@ Iso14443_4aData* mf_plus_get_base_data(const MfPlusData* data) {
 
     return data->iso14443_4a_data;
 }
+
+static bool mf_plus_load_binary(MfPlusData* data, Stream* stream) {
+    furi_check(data);
+
+    return nfc_binary_stream_read(
+        stream, &data->version, offsetof(MfPlusData, device_name) - offsetof(MfPlusData, version));
+}
+
+static bool mf_plus_save_binary(const MfPlusData* data, Stream* stream) {
+    furi_check(data);
+
+    return nfc_binary_stream_write(
+        stream, &data->version, offsetof(MfPlusData, device_name) - offsetof(MfPlusData, version));
+}
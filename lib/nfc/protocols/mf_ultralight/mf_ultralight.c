@@ -2,6 +2,7 @@
 
 #include <bit_lib/bit_lib.h>
 #include <furi.h>
+#include <nfc/helpers/nfc_binary_stream.h>
 
 #define MF_ULTRALIGHT_PROTOCOL_NAME "NTAG/Ultralight"
 
@@ -152,6 +153,9 @@ static const MfUltralightFeatures mf_ultralight_features[MfUltralightTypeNum] =
         },
 };
 
+static bool mf_ultralight_load_binary(MfUltralightData* data, Stream* stream);
+static bool mf_ultralight_save_binary(const MfUltralightData* data, Stream* stream);
+
 const NfcDeviceBase nfc_device_mf_ultralight = {
     .protocol_name = MF_ULTRALIGHT_PROTOCOL_NAME,
     .alloc = (NfcDeviceAlloc)mf_ultralight_alloc,
@@ -166,6 +170,8 @@ const NfcDeviceBase nfc_device_mf_ultralight = {
     .get_uid = (NfcDeviceGetUid)mf_ultralight_get_uid,
     .set_uid = (NfcDeviceSetUid)mf_ultralight_set_uid,
     .get_base_data = (NfcDeviceGetBaseData)mf_ultralight_get_base_data,
+    .load_binary = (NfcDeviceLoadBinary)mf_ultralight_load_binary,
+    .save_binary = (NfcDeviceSaveBinary)mf_ultralight_save_binary,
 };
 
 MfUltralightData* mf_ultralight_alloc(void) {
@@ -509,6 +515,20 @@ Iso14443_3aData* mf_ultralight_get_base_data(const MfUltralightData* data) {
     return data->iso14443_3a_data;
 }
 
+static bool mf_ultralight_load_binary(MfUltralightData* data, Stream* stream) {
+    furi_check(data);
+
+    return nfc_binary_stream_read(
+        stream, &data->type, sizeof(MfUltralightData) - offsetof(MfUltralightData, type));
+}
+
+static bool mf_ultralight_save_binary(const MfUltralightData* data, Stream* stream) {
+    furi_check(data);
+
+    return nfc_binary_stream_write(
+        stream, &data->type, sizeof(MfUltralightData) - offsetof(MfUltralightData, type));
+}
+
 MfUltralightType mf_ultralight_get_type_by_version(MfUltralightVersion* version) {
     furi_check(version);
 
@@ -226,6 +226,7 @@ static NfcCommand mf_ultralight_poller_handler_idle(MfUltralightPoller* instance
     instance->tearing_flag_read = 0;
     instance->tearing_flag_total = 3;
     instance->pages_read = 0;
+    instance->fast_read_failed = false;
     instance->state = MfUltralightPollerStateRequestMode;
     instance->current_page = 0;
     return NfcCommandContinue;
@@ -486,7 +487,45 @@ static NfcCommand mf_ultralight_poller_handler_auth_ultralight_c(MfUltralightPol
     return command;
 }
 
+static bool mf_ultralight_poller_fast_read(MfUltralightPoller* instance) {
+    // NTAG I2C pages are addressed per sector, keep reading them with READ
+    if(instance->fast_read_failed || MF_ULTRALIGHT_IS_NTAG_I2C(instance->data->type) ||
+       !mf_ultralight_support_feature(instance->feature_set, MfUltralightFeatureSupportFastRead)) {
+        return false;
+    }
+
+    uint16_t start_page = instance->pages_read;
+    uint16_t end_page =
+        MIN(instance->pages_total, start_page + MF_ULTRALIGHT_POLLER_FAST_READ_PAGES_MAX) - 1;
+    instance->error = mf_ultralight_poller_fast_read_pages(
+        instance, start_page, end_page, &instance->data->page[start_page]);
+    if(instance->error == MfUltralightErrorNone) {
+        FURI_LOG_D(TAG, "Fast read pages %d - %d success", start_page, end_page);
+        instance->pages_read = end_page + 1;
+        instance->data->pages_read = instance->pages_read;
+        return true;
+    }
+
+    // Card rejects whole range if any page is protected. It doesn't answer after NAK,
+    // so wake it up and read remaining pages one by one to find out where protection starts
+    FURI_LOG_D(TAG, "Fast read from page %d failed", start_page);
+    instance->fast_read_failed = true;
+    if(iso14443_3a_poller_activate(instance->iso14443_3a_poller, NULL) == Iso14443_3aErrorNone &&
+       instance->auth_context.auth_success) {
+        mf_ultralight_poller_auth_pwd(instance, &instance->auth_context);
+    }
+
+    return false;
+}
+
 static NfcCommand mf_ultralight_poller_handler_read_pages(MfUltralightPoller* instance) {
+    if(mf_ultralight_poller_fast_read(instance)) {
+        if(instance->pages_read == instance->pages_total) {
+            instance->state = MfUltralightPollerStateReadCounters;
+        }
+        return NfcCommandContinue;
+    }
+
     MfUltralightPageReadCommandData data = {};
     uint16_t start_page = instance->pages_read;
     if(MF_ULTRALIGHT_IS_NTAG_I2C(instance->data->type)) {
@@ -267,6 +267,42 @@ MfUltralightError mf_ultralight_poller_read_page(
     return ret;
 }
 
+MfUltralightError mf_ultralight_poller_fast_read_pages(
+    MfUltralightPoller* instance,
+    uint8_t start_page,
+    uint8_t end_page,
+    MfUltralightPage* pages) {
+    furi_check(instance);
+    furi_check(pages);
+    furi_check(end_page >= start_page);
+    furi_check(end_page - start_page < MF_ULTRALIGHT_POLLER_FAST_READ_PAGES_MAX);
+
+    MfUltralightError ret = MfUltralightErrorNone;
+    Iso14443_3aError error = Iso14443_3aErrorNone;
+
+    do {
+        uint8_t fast_read_cmd[3] = {MF_ULTRALIGHT_CMD_FAST_READ, start_page, end_page};
+        bit_buffer_copy_bytes(instance->tx_buffer, fast_read_cmd, sizeof(fast_read_cmd));
+        error = iso14443_3a_poller_send_standard_frame(
+            instance->iso14443_3a_poller,
+            instance->tx_buffer,
+            instance->rx_buffer,
+            MF_ULTRALIGHT_POLLER_STANDARD_FWT_FC);
+        if(error != Iso14443_3aErrorNone) {
+            ret = mf_ultralight_process_error(error);
+            break;
+        }
+        size_t size = (end_page - start_page + 1) * sizeof(MfUltralightPage);
+        if(bit_buffer_get_size_bytes(instance->rx_buffer) != size) {
+            ret = MfUltralightErrorProtocol;
+            break;
+        }
+        bit_buffer_write_bytes(instance->rx_buffer, pages, size);
+    } while(false);
+
+    return ret;
+}
+
 MfUltralightError mf_ultralight_poller_write_page(
     MfUltralightPoller* instance,
     uint8_t page,
@@ -9,7 +9,10 @@ extern "C" {
 #endif
 
 #define MF_ULTRALIGHT_POLLER_STANDARD_FWT_FC (60000)
-#define MF_ULTRALIGHT_MAX_BUFF_SIZE          (64)
+/* Largest FAST_READ response which fits into 256 byte Nfc buffer together with CRC */
+#define MF_ULTRALIGHT_POLLER_FAST_READ_PAGES_MAX (60)
+#define MF_ULTRALIGHT_MAX_BUFF_SIZE \
+    (MF_ULTRALIGHT_POLLER_FAST_READ_PAGES_MAX * MF_ULTRALIGHT_PAGE_SIZE + 2)
 
 #define MF_ULTRALIGHT_DEFAULT_PASSWORD (0xffffffffUL)
 
@@ -88,6 +91,7 @@ struct MfUltralightPoller {
     uint8_t tearing_flag_read;
     uint8_t tearing_flag_total;
     uint16_t current_page;
+    bool fast_read_failed;
     MfUltralightError error;
     mbedtls_des3_context des_context;
 
@@ -115,6 +119,22 @@ bool mf_ultralight_poller_ntag_i2c_addr_lin_to_tag(
 
 MfUltralightError mf_ultralight_poller_authentication_test(MfUltralightPoller* instance);
 
+/**
+ * @brief Read range of pages with single FAST_READ command.
+ *
+ * @param[in, out] instance pointer to the instance to be used in the transaction.
+ * @param[in] start_page first page to be read.
+ * @param[in] end_page last page to be read, at most MF_ULTRALIGHT_POLLER_FAST_READ_PAGES_MAX
+ *                     pages after start_page.
+ * @param[out] pages pointer to the buffer for end_page - start_page + 1 pages.
+ * @return MfUltralightErrorNone on success, an error code on failure.
+ */
+MfUltralightError mf_ultralight_poller_fast_read_pages(
+    MfUltralightPoller* instance,
+    uint8_t start_page,
+    uint8_t end_page,
+    MfUltralightPage* pages);
+
 #ifdef __cplusplus
 }
 #endif
@@ -10,6 +10,7 @@
 #include "nfc_device_base.h"
 
 #include <flipper_format.h>
+#include <toolbox/stream/stream.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -80,6 +81,29 @@ typedef bool (*NfcDeviceLoad)(NfcDeviceData* data, FlipperFormat* ff, uint32_t v
  */
 typedef bool (*NfcDeviceSave)(const NfcDeviceData* data, FlipperFormat* ff);
 
+/**
+ * @brief Load NFC device data from a binary stream written by the save_binary() function.
+ *
+ * Only the protocol's own fields are read, the parent protocol's data is loaded separately.
+ * The binary format is private to the firmware build that wrote it.
+ *
+ * @param[in,out] data pointer to the instance to be loaded into.
+ * @param[in,out] stream pointer to the stream to read from.
+ * @returns true if loaded successfully, false otherwise.
+ */
+typedef bool (*NfcDeviceLoadBinary)(NfcDeviceData* data, Stream* stream);
+
+/**
+ * @brief Save NFC device data to a binary stream.
+ *
+ * Only the protocol's own fields are written, the parent protocol's data is saved separately.
+ *
+ * @param[in] data pointer to the instance to be saved.
+ * @param[in,out] stream pointer to the stream to write to.
+ * @returns true if saved successfully, false otherwise.
+ */
+typedef bool (*NfcDeviceSaveBinary)(const NfcDeviceData* data, Stream* stream);
+
 /**
  * @brief Compare two NFC device data instances.
  *
@@ -154,6 +178,8 @@ typedef struct {
     NfcDeviceGetUid get_uid; /**< Pointer to the get_uid() function. */
     NfcDeviceSetUid set_uid; /**< Pointer to the set_uid() function. */
     NfcDeviceGetBaseData get_base_data; /**< Pointer to the get_base_data() function. */
+    NfcDeviceLoadBinary load_binary; /**< Pointer to the load_binary() function, optional. */
+    NfcDeviceSaveBinary save_binary; /**< Pointer to the save_binary() function, optional. */
 } NfcDeviceBase;
 
 #ifdef __cplusplus
@@ -3,6 +3,7 @@
 
 #include <furi.h>
 #include <nfc/nfc_common.h>
+#include <nfc/helpers/nfc_binary_stream.h>
 
 #define SLIX_PROTOCOL_NAME "SLIX"
 #define SLIX_DEVICE_NAME   "SLIX"
@@ -40,6 +41,9 @@ typedef struct {
     };
 } SlixUidLayout;
 
+static bool slix_load_binary(SlixData* data, Stream* stream);
+static bool slix_save_binary(const SlixData* data, Stream* stream);
+
 const NfcDeviceBase nfc_device_slix = {
     .protocol_name = SLIX_PROTOCOL_NAME,
     .alloc = (NfcDeviceAlloc)slix_alloc,
@@ -54,6 +58,8 @@ const NfcDeviceBase nfc_device_slix = {
     .get_uid = (NfcDeviceGetUid)slix_get_uid,
     .set_uid = (NfcDeviceSetUid)slix_set_uid,
     .get_base_data = (NfcDeviceGetBaseData)slix_get_base_data,
+    .load_binary = (NfcDeviceLoadBinary)slix_load_binary,
+    .save_binary = (NfcDeviceSaveBinary)slix_save_binary,
 };
 
 static const char* slix_nfc_device_name[] = {
@@ -406,6 +412,20 @@ const Iso15693_3Data* slix_get_base_data(const SlixData* data) {
     return data->iso15693_3_data;
 }
 
+static bool slix_load_binary(SlixData* data, Stream* stream) {
+    furi_check(data);
+
+    return nfc_binary_stream_read(
+        stream, &data->system_info, sizeof(SlixData) - offsetof(SlixData, system_info));
+}
+
+static bool slix_save_binary(const SlixData* data, Stream* stream) {
+    furi_check(data);
+
+    return nfc_binary_stream_write(
+        stream, &data->system_info, sizeof(SlixData) - offsetof(SlixData, system_info));
+}
+
 SlixType slix_get_type(const SlixData* data) {
     furi_check(data);
 
@@ -5,6 +5,7 @@
 
 #include <nfc/nfc_common.h>
 #include <nfc/helpers/iso14443_crc.h>
+#include <nfc/helpers/nfc_binary_stream.h>
 
 #define ST25TB_PROTOCOL_NAME    "ST25TB"
 #define ST25TB_TYPE_KEY         "ST25TB Type"
@@ -63,6 +64,9 @@ static const St25tbFeatures st25tb_features[St25tbTypeNum] = {
         },
 };
 
+static bool st25tb_load_binary(St25tbData* data, Stream* stream);
+static bool st25tb_save_binary(const St25tbData* data, Stream* stream);
+
 const NfcDeviceBase nfc_device_st25tb = {
     .protocol_name = ST25TB_PROTOCOL_NAME,
     .alloc = (NfcDeviceAlloc)st25tb_alloc,
@@ -77,6 +81,8 @@ const NfcDeviceBase nfc_device_st25tb = {
     .get_uid = (NfcDeviceGetUid)st25tb_get_uid,
     .set_uid = (NfcDeviceSetUid)st25tb_set_uid,
     .get_base_data = (NfcDeviceGetBaseData)st25tb_get_base_data,
+    .load_binary = (NfcDeviceLoadBinary)st25tb_load_binary,
+    .save_binary = (NfcDeviceSaveBinary)st25tb_save_binary,
 };
 
 St25tbData* st25tb_alloc(void) {
@@ -240,6 +246,18 @@ St25tbData* st25tb_get_base_data(const St25tbData* data) {
     furi_crash("No base data");
 }
 
+static bool st25tb_load_binary(St25tbData* data, Stream* stream) {
+    furi_check(data);
+
+    return nfc_binary_stream_read(stream, data, sizeof(St25tbData));
+}
+
+static bool st25tb_save_binary(const St25tbData* data, Stream* stream) {
+    furi_check(data);
+
+    return nfc_binary_stream_write(stream, data, sizeof(St25tbData));
+}
+
 St25tbType st25tb_get_type_from_uid(const uint8_t* uid) {
     furi_check(uid);
 
@@ -0,0 +1,458 @@
+#ifdef FW_CFG_unit_tests
+
+#include "file_interconnect.h"
+
+#include <storage/storage.h>
+#include <toolbox/stream/stream.h>
+#include <toolbox/strint.h>
+#include <flipper_format/flipper_format.h>
+#include <lib/subghz/types.h>
+
+#define TAG "SubGhzDeviceFile"
+
+#define SUBGHZ_DEVICE_FILE_RAW_BUFFER_SIZE 512
+#define SUBGHZ_DEVICE_FILE_RSSI            -40.0f
+#define SUBGHZ_DEVICE_FILE_PA_TABLE_SIZE   8
+
+typedef enum {
+    SubGhzDeviceFileStateIdle,
+    SubGhzDeviceFileStateAsyncRx,
+    SubGhzDeviceFileStateAsyncTx,
+} SubGhzDeviceFileState;
+
+typedef struct {
+    FuriThread* thread;
+    Storage* storage;
+    FlipperFormat* flipper_format;
+    FuriString* rx_path;
+    FuriString* tx_path;
+    FuriString* str_data;
+
+    SubGhzDeviceFileState state;
+    uint32_t speed;
+    uint32_t frequency;
+    FuriHalSubGhzPreset preset;
+    uint8_t* preset_data;
+    size_t preset_data_size;
+
+    void* callback;
+    void* context;
+
+    volatile bool worker_running;
+    volatile bool rx_complete;
+    volatile bool tx_complete;
+    uint32_t rx_pulse_count;
+} SubGhzDeviceFile;
+
+static SubGhzDeviceFile* subghz_device_file_instance = NULL;
+
+/** Sleep off the accumulated signal time once it exceeds a tick */
+static void subghz_device_file_pace(uint32_t duration, uint32_t* pending_us) {
+    if(subghz_device_file_instance->speed == SUBGHZ_DEVICE_FILE_SPEED_UNLIMITED) return;
+
+    *pending_us += duration / subghz_device_file_instance->speed;
+    if(*pending_us >= 1000) {
+        furi_delay_ms(*pending_us / 1000);
+        *pending_us %= 1000;
+    }
+}
+
+static bool subghz_device_file_open_rx(SubGhzDeviceFile* instance) {
+    bool ret = false;
+    uint32_t version = 0;
+
+    do {
+        if(!flipper_format_file_open_existing(
+               instance->flipper_format, furi_string_get_cstr(instance->rx_path))) {
+            FURI_LOG_E(
+                TAG, "Unable to open file for read: %s", furi_string_get_cstr(instance->rx_path));
+            break;
+        }
+        if(!flipper_format_read_header(instance->flipper_format, instance->str_data, &version) ||
+           furi_string_cmp_str(instance->str_data, SUBGHZ_RAW_FILE_TYPE) != 0 ||
+           version != SUBGHZ_RAW_FILE_VERSION) {
+            FURI_LOG_E(TAG, "Not a RAW file");
+            break;
+        }
+        if(!flipper_format_read_string(instance->flipper_format, "Protocol", instance->str_data)) {
+            FURI_LOG_E(TAG, "Missing Protocol");
+            break;
+        }
+        ret = true;
+    } while(false);
+
+    return ret;
+}
+
+static int32_t subghz_device_file_rx_thread(void* context) {
+    SubGhzDeviceFile* instance = context;
+    FuriHalSubGhzCaptureCallback callback = instance->callback;
+    Stream* stream = flipper_format_get_raw_stream(instance->flipper_format);
+    uint32_t pending_us = 0;
+    uint32_t signal_us = 0;
+    uint32_t start = furi_get_tick();
+
+    if(subghz_device_file_open_rx(instance)) {
+        while(instance->worker_running && stream_read_line(stream, instance->str_data)) {
+            // Line sample: "RAW_Data: -1, 2, -2..."
+            const char* line = furi_string_get_cstr(instance->str_data);
+            char* str = strstr(line, "RAW_Data: ");
+            if(!str) continue;
+            str = strchr(str, ' ');
+
+            int32_t duration;
+            while(instance->worker_running &&
+                  strint_to_int32(str, &str, &duration, 10) == StrintParseNoError) {
+                if(duration != 0) {
+                    // same clamping as SubGhzFileEncoderWorker
+                    if(duration < -1000000) {
+                        duration = -100;
+                    } else if(duration > 1000000) {
+                        duration = 100;
+                    }
+                    bool level = duration > 0;
+                    uint32_t time = level ? duration : -duration;
+                    callback(level, time, instance->context);
+                    instance->rx_pulse_count++;
+                    signal_us += time;
+                    subghz_device_file_pace(time, &pending_us);
+                }
+                if(*str == ',') str++;
+            }
+        }
+        instance->rx_complete = instance->worker_running;
+    }
+    flipper_format_file_close(instance->flipper_format);
+
+    FURI_LOG_I(
+        TAG,
+        "Replayed %lu pulses (%lu ms of signal) in %lu ms",
+        instance->rx_pulse_count,
+        signal_us / 1000,
+        furi_get_tick() - start);
+
+    return 0;
+}
+
+static const char* subghz_device_file_get_preset_name(FuriHalSubGhzPreset preset) {
+    switch(preset) {
+    case FuriHalSubGhzPresetOok270Async:
+        return "FuriHalSubGhzPresetOok270Async";
+    case FuriHalSubGhzPresetOok650Async:
+        return "FuriHalSubGhzPresetOok650Async";
+    case FuriHalSubGhzPreset2FSKDev238Async:
+        return "FuriHalSubGhzPreset2FSKDev238Async";
+    case FuriHalSubGhzPreset2FSKDev476Async:
+        return "FuriHalSubGhzPreset2FSKDev476Async";
+    default:
+        return "FuriHalSubGhzPresetCustom";
+    }
+}
+
+static bool subghz_device_file_open_tx(SubGhzDeviceFile* instance) {
+    bool ret = false;
+    FlipperFormat* flipper_format = instance->flipper_format;
+
+    do {
+        if(!flipper_format_file_open_always(
+               flipper_format, furi_string_get_cstr(instance->tx_path))) {
+            FURI_LOG_E(
+                TAG, "Unable to open file for write: %s", furi_string_get_cstr(instance->tx_path));
+            break;
+        }
+        if(!flipper_format_write_header_cstr(
+               flipper_format, SUBGHZ_RAW_FILE_TYPE, SUBGHZ_RAW_FILE_VERSION)) {
+            break;
+        }
+        if(!flipper_format_write_uint32(flipper_format, "Frequency", &instance->frequency, 1)) {
+            break;
+        }
+        const char* preset_name = subghz_device_file_get_preset_name(instance->preset);
+        if(!flipper_format_write_string_cstr(flipper_format, "Preset", preset_name)) {
+            break;
+        }
+        if(instance->preset_data) {
+            if(!flipper_format_write_string_cstr(
+                   flipper_format, "Custom_preset_module", "CC1101")) {
+                break;
+            }
+            if(!flipper_format_write_hex(
+                   flipper_format,
+                   "Custom_preset_data",
+                   instance->preset_data,
+                   instance->preset_data_size)) {
+                break;
+            }
+        }
+        if(!flipper_format_write_string_cstr(flipper_format, "Protocol", "RAW")) {
+            break;
+        }
+        ret = true;
+    } while(false);
+
+    if(!ret) {
+        FURI_LOG_E(TAG, "Unable to write file header");
+    }
+
+    return ret;
+}
+
+static int32_t subghz_device_file_tx_thread(void* context) {
+    SubGhzDeviceFile* instance = context;
+    FuriHalSubGhzAsyncTxCallback callback = instance->callback;
+    int32_t* buffer = malloc(SUBGHZ_DEVICE_FILE_RAW_BUFFER_SIZE * sizeof(int32_t));
+    size_t count = 0;
+    uint32_t pending_us = 0;
+    bool ok = subghz_device_file_open_tx(instance);
+
+    while(ok && instance->worker_running) {
+        LevelDuration level_duration = callback(instance->context);
+        if(level_duration_is_reset(level_duration)) {
+            break;
+        } else if(level_duration_is_wait(level_duration)) {
+            furi_delay_ms(1);
+            continue;
+        }
+
+        uint32_t duration = level_duration_get_duration(level_duration);
+        buffer[count++] = level_duration_get_level(level_duration) ? (int32_t)duration :
+                                                                     -(int32_t)duration;
+        if(count == SUBGHZ_DEVICE_FILE_RAW_BUFFER_SIZE) {
+            ok = flipper_format_write_int32(instance->flipper_format, "RAW_Data", buffer, count);
+            count = 0;
+        }
+        subghz_device_file_pace(duration, &pending_us);
+    }
+
+    if(ok && count) {
+        ok = flipper_format_write_int32(instance->flipper_format, "RAW_Data", buffer, count);
+    }
+    if(!ok) {
+        FURI_LOG_E(TAG, "Unable to record transmission");
+    }
+    flipper_format_file_close(instance->flipper_format);
+    free(buffer);
+
+    instance->tx_complete = true;
+    return 0;
+}
+
+static void subghz_device_file_start_worker(
+    SubGhzDeviceFileState state,
+    FuriThreadCallback worker,
+    void* callback,
+    void* context) {
+    furi_check(subghz_device_file_instance);
+    furi_check(subghz_device_file_instance->state == SubGhzDeviceFileStateIdle);
+
+    subghz_device_file_instance->state = state;
+    subghz_device_file_instance->callback = callback;
+    subghz_device_file_instance->context = context;
+    subghz_device_file_instance->worker_running = true;
+
+    furi_thread_set_callback(subghz_device_file_instance->thread, worker);
+    furi_thread_start(subghz_device_file_instance->thread);
+}
+
+static void subghz_device_file_stop_worker(SubGhzDeviceFileState state) {
+    furi_check(subghz_device_file_instance);
+    if(subghz_device_file_instance->state != state) return;
+
+    subghz_device_file_instance->worker_running = false;
+    furi_thread_join(subghz_device_file_instance->thread);
+    subghz_device_file_instance->state = SubGhzDeviceFileStateIdle;
+}
+
+static bool subghz_device_file_interconnect_begin(SubGhzDeviceConf* conf) {
+    UNUSED(conf);
+    furi_check(!subghz_device_file_instance);
+
+    SubGhzDeviceFile* instance = malloc(sizeof(SubGhzDeviceFile));
+    instance->thread = furi_thread_alloc_ex("SubGhzFileDev", 2048, NULL, instance);
+    instance->storage = furi_record_open(RECORD_STORAGE);
+    instance->flipper_format = flipper_format_file_alloc(instance->storage);
+    instance->rx_path = furi_string_alloc();
+    instance->tx_path = furi_string_alloc();
+    instance->str_data = furi_string_alloc();
+    instance->state = SubGhzDeviceFileStateIdle;
+    instance->speed = 1;
+
+    subghz_device_file_instance = instance;
+    return true;
+}
+
+static void subghz_device_file_interconnect_end(void) {
+    furi_check(subghz_device_file_instance);
+    SubGhzDeviceFile* instance = subghz_device_file_instance;
+
+    subghz_device_file_stop_worker(SubGhzDeviceFileStateAsyncRx);
+    subghz_device_file_stop_worker(SubGhzDeviceFileStateAsyncTx);
+
+    furi_thread_free(instance->thread);
+    flipper_format_free(instance->flipper_format);
+    furi_record_close(RECORD_STORAGE);
+    furi_string_free(instance->rx_path);
+    furi_string_free(instance->tx_path);
+    furi_string_free(instance->str_data);
+    free(instance->preset_data);
+    free(instance);
+
+    subghz_device_file_instance = NULL;
+}
+
+static bool subghz_device_file_interconnect_is_connect(void) {
+    return true;
+}
+
+static void subghz_device_file_interconnect_nop(void) {
+}
+
+static void subghz_device_file_interconnect_load_preset(
+    FuriHalSubGhzPreset preset,
+    uint8_t* preset_data) {
+    furi_check(subghz_device_file_instance);
+
+    free(subghz_device_file_instance->preset_data);
+    subghz_device_file_instance->preset_data = NULL;
+    subghz_device_file_instance->preset_data_size = 0;
+    subghz_device_file_instance->preset = preset;
+
+    if(preset == FuriHalSubGhzPresetCustom && preset_data) {
+        // register/value pairs terminated by 0x00 0x00, followed by PA table
+        size_t size = 0;
+        while(preset_data[size] || preset_data[size + 1]) {
+            size += 2;
+        }
+        size += 2 + SUBGHZ_DEVICE_FILE_PA_TABLE_SIZE;
+
+        subghz_device_file_instance->preset_data = malloc(size);
+        memcpy(subghz_device_file_instance->preset_data, preset_data, size);
+        subghz_device_file_instance->preset_data_size = size;
+    }
+}
+
+static uint32_t subghz_device_file_interconnect_set_frequency(uint32_t frequency) {
+    furi_check(subghz_device_file_instance);
+    subghz_device_file_instance->frequency = frequency;
+    return frequency;
+}
+
+static bool subghz_device_file_interconnect_is_frequency_valid(uint32_t frequency) {
+    UNUSED(frequency);
+    return true;
+}
+
+static bool subghz_device_file_interconnect_set_tx(void) {
+    return true;
+}
+
+static bool subghz_device_file_interconnect_start_async_tx(void* callback, void* context) {
+    furi_check(subghz_device_file_instance);
+    if(furi_string_empty(subghz_device_file_instance->tx_path)) {
+        FURI_LOG_E(TAG, "TX path is not set");
+        return false;
+    }
+
+    subghz_device_file_instance->tx_complete = false;
+    subghz_device_file_start_worker(
+        SubGhzDeviceFileStateAsyncTx, subghz_device_file_tx_thread, callback, context);
+    return true;
+}
+
+static bool subghz_device_file_interconnect_is_async_complete_tx(void) {
+    furi_check(subghz_device_file_instance);
+    return subghz_device_file_instance->tx_complete;
+}
+
+static void subghz_device_file_interconnect_stop_async_tx(void) {
+    subghz_device_file_stop_worker(SubGhzDeviceFileStateAsyncTx);
+}
+
+static void subghz_device_file_interconnect_start_async_rx(void* callback, void* context) {
+    furi_check(subghz_device_file_instance);
+    furi_check(!furi_string_empty(subghz_device_file_instance->rx_path));
+
+    subghz_device_file_instance->rx_complete = false;
+    subghz_device_file_instance->rx_pulse_count = 0;
+    subghz_device_file_start_worker(
+        SubGhzDeviceFileStateAsyncRx, subghz_device_file_rx_thread, callback, context);
+}
+
+static void subghz_device_file_interconnect_stop_async_rx(void) {
+    subghz_device_file_stop_worker(SubGhzDeviceFileStateAsyncRx);
+}
+
+static float subghz_device_file_interconnect_get_rssi(void) {
+    return SUBGHZ_DEVICE_FILE_RSSI;
+}
+
+static uint8_t subghz_device_file_interconnect_get_lqi(void) {
+    return 0;
+}
+
+void subghz_device_file_set_rx_path(const char* path) {
+    furi_check(subghz_device_file_instance);
+    furi_check(path);
+    furi_string_set(subghz_device_file_instance->rx_path, path);
+}
+
+void subghz_device_file_set_tx_path(const char* path) {
+    furi_check(subghz_device_file_instance);
+    furi_check(path);
+    furi_string_set(subghz_device_file_instance->tx_path, path);
+}
+
+void subghz_device_file_set_speed(uint32_t speed) {
+    furi_check(subghz_device_file_instance);
+    subghz_device_file_instance->speed = speed;
+}
+
+bool subghz_device_file_is_rx_complete(void) {
+    furi_check(subghz_device_file_instance);
+    return subghz_device_file_instance->rx_complete;
+}
+
+uint32_t subghz_device_file_get_rx_pulse_count(void) {
+    furi_check(subghz_device_file_instance);
+    return subghz_device_file_instance->rx_pulse_count;
+}
+
+const SubGhzDeviceInterconnect subghz_device_file_interconnect = {
+    .begin = subghz_device_file_interconnect_begin,
+    .end = subghz_device_file_interconnect_end,
+    .is_connect = subghz_device_file_interconnect_is_connect,
+    .reset = subghz_device_file_interconnect_nop,
+    .sleep = subghz_device_file_interconnect_nop,
+    .idle = subghz_device_file_interconnect_nop,
+    .load_preset = subghz_device_file_interconnect_load_preset,
+    .set_frequency = subghz_device_file_interconnect_set_frequency,
+    .is_frequency_valid = subghz_device_file_interconnect_is_frequency_valid,
+    .set_async_mirror_pin = NULL,
+    .get_data_gpio = NULL,
+
+    .set_tx = subghz_device_file_interconnect_set_tx,
+    .flush_tx = subghz_device_file_interconnect_nop,
+    .start_async_tx = subghz_device_file_interconnect_start_async_tx,
+    .is_async_complete_tx = subghz_device_file_interconnect_is_async_complete_tx,
+    .stop_async_tx = subghz_device_file_interconnect_stop_async_tx,
+
+    .set_rx = subghz_device_file_interconnect_nop,
+    .flush_rx = subghz_device_file_interconnect_nop,
+    .start_async_rx = subghz_device_file_interconnect_start_async_rx,
+    .stop_async_rx = subghz_device_file_interconnect_stop_async_rx,
+
+    .get_rssi = subghz_device_file_interconnect_get_rssi,
+    .get_lqi = subghz_device_file_interconnect_get_lqi,
+
+    .rx_pipe_not_empty = NULL,
+    .is_rx_data_crc_valid = NULL,
+    .read_packet = NULL,
+    .write_packet = NULL,
+};
+
+const SubGhzDevice subghz_device_file = {
+    .name = SUBGHZ_DEVICE_FILE_NAME,
+    .interconnect = &subghz_device_file_interconnect,
+};
+
+#endif
@@ -0,0 +1,59 @@
+#pragma once
+#include "../types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SUBGHZ_DEVICE_FILE_NAME "file"
+
+/** Replay speed that disables pacing: pulses are delivered as fast as they are read */
+#define SUBGHZ_DEVICE_FILE_SPEED_UNLIMITED 0
+
+/**
+ * Virtual radio backed by RAW files.
+ *
+ * Async RX replays a RAW `.sub` capture into the capture callback, async TX records the
+ * transmitted level/duration stream into a RAW `.sub` file. Everything else behaves
+ * like an always present, idle radio. Paths and speed must be set between
+ * subghz_devices_begin and subghz_devices_end.
+ *
+ * Test device: it is built only with the unit_tests configuration, is not in
+ * the device registry and is not a part of the public API. Pass it to
+ * subghz_devices_* directly.
+ */
+extern const SubGhzDevice subghz_device_file;
+
+/**
+ * Set RAW file replayed by async RX
+ * @param path File path
+ */
+void subghz_device_file_set_rx_path(const char* path);
+
+/**
+ * Set RAW file written by async TX
+ * @param path File path
+ */
+void subghz_device_file_set_tx_path(const char* path);
+
+/**
+ * Set replay speed multiplier
+ * @param speed 1 - real time, N - N times faster, SUBGHZ_DEVICE_FILE_SPEED_UNLIMITED - no pacing
+ */
+void subghz_device_file_set_speed(uint32_t speed);
+
+/**
+ * Check if async RX reached the end of the RAW file
+ * @return bool - true if all pulses were delivered
+ */
+bool subghz_device_file_is_rx_complete(void);
+
+/**
+ * Get amount of pulses delivered by the last async RX
+ * @return uint32_t pulse count
+ */
+uint32_t subghz_device_file_get_rx_pulse_count(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -30,12 +30,20 @@ void subghz_device_registry_init(void) {
         FURI_LOG_E(TAG, "Failed to load all libs");
     }
 
-    subghz_device->size = plugin_manager_get_count(subghz_device->manager) + 1;
+    const SubGhzDevice* builtin_items[] = {
+        &subghz_device_cc1101_int,
+    };
+    const size_t builtin_count = COUNT_OF(builtin_items);
+
+    subghz_device->size = plugin_manager_get_count(subghz_device->manager) + builtin_count;
     subghz_device->items =
         (const SubGhzDevice**)malloc(sizeof(SubGhzDevice*) * subghz_device->size);
-    subghz_device->items[0] = &subghz_device_cc1101_int;
-    for(uint32_t i = 1; i < subghz_device->size; i++) {
-        const SubGhzDevice* plugin = plugin_manager_get_ep(subghz_device->manager, i - 1);
+    for(size_t i = 0; i < builtin_count; i++) {
+        subghz_device->items[i] = builtin_items[i];
+    }
+    for(uint32_t i = builtin_count; i < subghz_device->size; i++) {
+        const SubGhzDevice* plugin =
+            plugin_manager_get_ep(subghz_device->manager, i - builtin_count);
         subghz_device->items[i] = plugin;
     }
 
@@ -22,6 +22,64 @@ static const SubGhzBlockConst subghz_protocol_keeloq_const = {
     .min_count_bit_for_found = 64,
 };
 
+/** Manufactures that need special handling in the encoder */
+typedef enum {
+    KeeloqMfOther = 0,
+    KeeloqMfUnknown,
+    KeeloqMfBft,
+    KeeloqMfAprimatic,
+    KeeloqMfDeaMio,
+    KeeloqMfAnMotors,
+    KeeloqMfHcs101,
+    KeeloqMfDtmNeo,
+    KeeloqMfFaacRcXt,
+    KeeloqMfMutancoMutancode,
+    KeeloqMfCameSpace,
+    KeeloqMfGeniusBravo,
+    KeeloqMfGsn,
+    KeeloqMfNiceSmilo,
+    KeeloqMfNiceMhouse,
+    KeeloqMfJcmTech,
+    KeeloqMfBeninca,
+    KeeloqMfCenturion,
+    KeeloqMfNovoferm,
+    KeeloqMfEcoStar,
+
+    KeeloqMfNum,
+} KeeloqMf;
+
+static const char* const subghz_protocol_keeloq_mf_names[KeeloqMfNum] = {
+    [KeeloqMfOther] = "",
+    [KeeloqMfUnknown] = "Unknown",
+    [KeeloqMfBft] = "BFT",
+    [KeeloqMfAprimatic] = "Aprimatic",
+    [KeeloqMfDeaMio] = "Dea_Mio",
+    [KeeloqMfAnMotors] = "AN-Motors",
+    [KeeloqMfHcs101] = "HCS101",
+    [KeeloqMfDtmNeo] = "DTM_Neo",
+    [KeeloqMfFaacRcXt] = "FAAC_RC,XT",
+    [KeeloqMfMutancoMutancode] = "Mutanco_Mutancode",
+    [KeeloqMfCameSpace] = "Came_Space",
+    [KeeloqMfGeniusBravo] = "Genius_Bravo",
+    [KeeloqMfGsn] = "GSN",
+    [KeeloqMfNiceSmilo] = "NICE_Smilo",
+    [KeeloqMfNiceMhouse] = "NICE_MHOUSE",
+    [KeeloqMfJcmTech] = "JCM_Tech",
+    [KeeloqMfBeninca] = "Beninca",
+    [KeeloqMfCenturion] = "Centurion",
+    [KeeloqMfNovoferm] = "Novoferm",
+    [KeeloqMfEcoStar] = "EcoStar",
+};
+
+static KeeloqMf subghz_protocol_keeloq_get_mf(const char* manufacture_name) {
+    for(size_t i = KeeloqMfOther + 1; i < KeeloqMfNum; i++) {
+        if(strcmp(manufacture_name, subghz_protocol_keeloq_mf_names[i]) == 0) {
+            return (KeeloqMf)i;
+        }
+    }
+    return KeeloqMfOther;
+}
+
 struct SubGhzProtocolDecoderKeeloq {
     SubGhzProtocolDecoderBase base;
 
@@ -43,6 +101,7 @@ struct SubGhzProtocolEncoderKeeloq {
 
     SubGhzKeystore* keystore;
     const char* manufacture_name;
+    KeeloqMf mf; /** manufacture_name resolved once when it is set */
 
     FuriString* manufacture_from_file;
 };
@@ -54,6 +113,14 @@ typedef enum {
     KeeloqDecoderStepCheckDuration,
 } KeeloqDecoderStep;
 
+static void subghz_protocol_encoder_keeloq_set_manufacture(
+    SubGhzProtocolEncoderKeeloq* instance,
+    const char* manufacture_name) {
+    // No mf name set? -> set to ""
+    instance->manufacture_name = manufacture_name ? manufacture_name : "";
+    instance->mf = subghz_protocol_keeloq_get_mf(instance->manufacture_name);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_keeloq_decoder = {
     .alloc = subghz_protocol_decoder_keeloq_alloc,
     .free = subghz_protocol_decoder_keeloq_free,
@@ -111,6 +178,7 @@ void* subghz_protocol_encoder_keeloq_alloc(SubGhzEnvironment* environment) {
     instance->encoder.is_running = false;
 
     instance->manufacture_from_file = furi_string_alloc();
+    subghz_protocol_encoder_keeloq_set_manufacture(instance, NULL);
 
     return instance;
 }
@@ -140,26 +208,28 @@ static bool subghz_protocol_keeloq_gen_data(
     int res = 0;
     // No mf name set? -> set to ""
     if(instance->manufacture_name == 0x0) {
-        instance->manufacture_name = "";
+        subghz_protocol_encoder_keeloq_set_manufacture(instance, "");
     }
 
+    const KeeloqMf mf = instance->mf;
+
     // programming mode on / off conditions
     ProgMode prog_mode = subghz_custom_btn_get_prog_mode();
-    if(strcmp(instance->manufacture_name, "BFT") == 0) {
+    if(mf == KeeloqMfBft) {
         // BFT programming mode on / off conditions
         if(btn == 0xF) {
             prog_mode = PROG_MODE_KEELOQ_BFT;
         } else if(prog_mode == PROG_MODE_KEELOQ_BFT) {
             prog_mode = PROG_MODE_OFF;
         }
-    } else if(strcmp(instance->manufacture_name, "Aprimatic") == 0) {
+    } else if(mf == KeeloqMfAprimatic) {
         // Aprimatic programming mode on / off conditions
         if(btn == 0xF) {
             prog_mode = PROG_MODE_KEELOQ_APRIMATIC;
         } else if(prog_mode == PROG_MODE_KEELOQ_APRIMATIC) {
             prog_mode = PROG_MODE_OFF;
         }
-    } else if(strcmp(instance->manufacture_name, "Dea_Mio") == 0) {
+    } else if(mf == KeeloqMfDeaMio) {
         // Dea_Mio programming mode on / off conditions
         if(btn == 0xF) {
             prog_mode = PROG_MODE_KEELOQ_DEA_MIO;
@@ -196,16 +266,16 @@ static bool subghz_protocol_keeloq_gen_data(
     }
     if(prog_mode == PROG_MODE_OFF) {
         // Protocols that do not use encryption
-        if(strcmp(instance->manufacture_name, "Unknown") == 0) {
+        if(mf == KeeloqMfUnknown) {
             // Simple Replay of received code
             code_found_reverse = subghz_protocol_blocks_reverse_key(
                 instance->generic.data, instance->generic.data_count_bit);
             hop = code_found_reverse & 0x00000000ffffffff;
-        } else if(strcmp(instance->manufacture_name, "AN-Motors") == 0) {
+        } else if(mf == KeeloqMfAnMotors) {
             // An-Motors encode
             hop = (instance->generic.cnt & 0xFF) << 24 | (instance->generic.cnt & 0xFF) << 16 |
                   (btn & 0xF) << 12 | 0x404;
-        } else if(strcmp(instance->manufacture_name, "HCS101") == 0) {
+        } else if(mf == KeeloqMfHcs101) {
             // HCS101 Encode
             hop = instance->generic.cnt << 16 | (btn & 0xF) << 12 | 0x000;
         } else {
@@ -215,7 +285,7 @@ static bool subghz_protocol_keeloq_gen_data(
                                    << 16 | //ToDo in some protocols the discriminator is 0
                                instance->generic.cnt;
 
-            if(strcmp(instance->manufacture_name, "Aprimatic") == 0) {
+            if(mf == KeeloqMfAprimatic) {
                 // Aprimatic uses 12bit serial number + 2bit APR1 "parity" bit in front of it replacing first 2 bits of serial
                 // Thats in theory! We need to check if this is true for all Aprimatic remotes but we got only 3 recordings to test
                 // For now lets assume that this is true for all Aprimatic remotes, if not we will need to add some more code here
@@ -230,30 +300,25 @@ static bool subghz_protocol_keeloq_gen_data(
                 }
                 decrypt = btn << 28 | (apri_serial & 0xFFF) << 16 | instance->generic.cnt;
             } else if(
-                (strcmp(instance->manufacture_name, "DTM_Neo") == 0) ||
-                (strcmp(instance->manufacture_name, "FAAC_RC,XT") == 0) ||
-                (strcmp(instance->manufacture_name, "Mutanco_Mutancode") == 0) ||
-                (strcmp(instance->manufacture_name, "Came_Space") == 0) ||
-                (strcmp(instance->manufacture_name, "Genius_Bravo") == 0) ||
-                (strcmp(instance->manufacture_name, "GSN") == 0)) {
+                mf == KeeloqMfDtmNeo || mf == KeeloqMfFaacRcXt ||
+                mf == KeeloqMfMutancoMutancode || mf == KeeloqMfCameSpace ||
+                mf == KeeloqMfGeniusBravo || mf == KeeloqMfGsn) {
                 // DTM Neo, Came_Space uses 12bit serial -> simple learning
                 // FAAC_RC,XT , Mutanco_Mutancode, Genius_Bravo, GSN 12bit serial -> normal learning
                 decrypt = btn << 28 | (instance->generic.serial & 0xFFF) << 16 |
                           instance->generic.cnt;
             } else if(
-                (strcmp(instance->manufacture_name, "NICE_Smilo") == 0) ||
-                (strcmp(instance->manufacture_name, "NICE_MHOUSE") == 0) ||
-                (strcmp(instance->manufacture_name, "JCM_Tech") == 0)) {
+                mf == KeeloqMfNiceSmilo || mf == KeeloqMfNiceMhouse || mf == KeeloqMfJcmTech) {
                 // Nice Smilo, MHouse, JCM -> 8bit serial - simple learning
                 decrypt = btn << 28 | (instance->generic.serial & 0xFF) << 16 |
                           instance->generic.cnt;
-            } else if(strcmp(instance->manufacture_name, "Beninca") == 0) {
+            } else if(mf == KeeloqMfBeninca) {
                 decrypt = btn << 28 | (0x000) << 16 | instance->generic.cnt;
                 // Beninca / Allmatic -> no serial - simple XOR
-            } else if(strcmp(instance->manufacture_name, "Centurion") == 0) {
+            } else if(mf == KeeloqMfCenturion) {
                 decrypt = btn << 28 | (0x1CE) << 16 | instance->generic.cnt;
                 // Centurion -> no serial in hop, uses fixed value 0x1CE - normal learning
-            } else if(strcmp(instance->manufacture_name, "Dea_Mio") == 0) {
+            } else if(mf == KeeloqMfDeaMio) {
                 uint8_t first_disc_num = (instance->generic.serial >> 8) & 0xF;
                 uint8_t result_disc = (0xC + (first_disc_num % 4));
                 uint32_t dea_serial = (instance->generic.serial & 0xFF) |
@@ -350,7 +415,7 @@ bool subghz_protocol_keeloq_create_data(
     SubGhzProtocolEncoderKeeloq* instance = context;
     instance->generic.serial = serial;
     instance->generic.cnt = cnt;
-    instance->manufacture_name = manufacture_name;
+    subghz_protocol_encoder_keeloq_set_manufacture(instance, manufacture_name);
     instance->generic.data_count_bit = 64;
     bool res = subghz_protocol_keeloq_gen_data(instance, btn, false);
     if(res) {
@@ -375,7 +440,7 @@ bool subghz_protocol_keeloq_bft_create_data(
     instance->generic.btn = btn;
     instance->generic.cnt = cnt;
     instance->generic.seed = seed;
-    instance->manufacture_name = manufacture_name;
+    subghz_protocol_encoder_keeloq_set_manufacture(instance, manufacture_name);
     instance->generic.data_count_bit = 64;
     // roguuemaster don't steal.!!!!
     bool res = subghz_protocol_keeloq_gen_data(instance, btn, false);
@@ -410,32 +475,41 @@ static bool
 
     // No mf name set? -> set to ""
     if(instance->manufacture_name == 0x0) {
-        instance->manufacture_name = "";
+        subghz_protocol_encoder_keeloq_set_manufacture(instance, "");
     }
     // Prog mode checks and extra fixage of MF Names
     ProgMode prog_mode = subghz_custom_btn_get_prog_mode();
     if(prog_mode == PROG_MODE_KEELOQ_BFT) {
-        instance->manufacture_name = "BFT";
+        subghz_protocol_encoder_keeloq_set_manufacture(
+            instance, subghz_protocol_keeloq_mf_names[KeeloqMfBft]);
     } else if(prog_mode == PROG_MODE_KEELOQ_APRIMATIC) {
-        instance->manufacture_name = "Aprimatic";
+        subghz_protocol_encoder_keeloq_set_manufacture(
+            instance, subghz_protocol_keeloq_mf_names[KeeloqMfAprimatic]);
     } else if(prog_mode == PROG_MODE_KEELOQ_DEA_MIO) {
-        instance->manufacture_name = "Dea_Mio";
+        subghz_protocol_encoder_keeloq_set_manufacture(
+            instance, subghz_protocol_keeloq_mf_names[KeeloqMfDeaMio]);
     }
     // Custom button (programming mode button) for BFT, Aprimatic, Dea_Mio
     uint8_t klq_last_custom_btn = 0xA;
-    if((strcmp(instance->manufacture_name, "BFT") == 0) ||
-       (strcmp(instance->manufacture_name, "Aprimatic") == 0) ||
-       (strcmp(instance->manufacture_name, "Dea_Mio") == 0) ||
-       (strcmp(instance->manufacture_name, "NICE_MHOUSE") == 0)) {
+    switch(subghz_protocol_keeloq_get_mf(instance->manufacture_name)) {
+    case KeeloqMfBft:
+    case KeeloqMfAprimatic:
+    case KeeloqMfDeaMio:
+    case KeeloqMfNiceMhouse:
         klq_last_custom_btn = 0xF;
-    } else if((strcmp(instance->manufacture_name, "FAAC_RC,XT") == 0)) {
+        break;
+    case KeeloqMfFaacRcXt:
+    case KeeloqMfNiceSmilo:
         klq_last_custom_btn = 0xB;
-    } else if((strcmp(instance->manufacture_name, "Novoferm") == 0)) {
+        break;
+    case KeeloqMfNovoferm:
         klq_last_custom_btn = 0x9;
-    } else if((strcmp(instance->manufacture_name, "NICE_Smilo") == 0)) {
-        klq_last_custom_btn = 0xB;
-    } else if((strcmp(instance->manufacture_name, "EcoStar") == 0)) {
+        break;
+    case KeeloqMfEcoStar:
         klq_last_custom_btn = 0x6;
+        break;
+    default:
+        break;
     }
 
     btn = subghz_protocol_keeloq_get_btn_code(klq_last_custom_btn);
@@ -534,7 +608,8 @@ SubGhzProtocolStatus
         // Read manufacturer from file
         if(flipper_format_read_string(
                flipper_format, "Manufacture", instance->manufacture_from_file)) {
-            instance->manufacture_name = furi_string_get_cstr(instance->manufacture_from_file);
+            subghz_protocol_encoder_keeloq_set_manufacture(
+                instance, furi_string_get_cstr(instance->manufacture_from_file));
             instance->keystore->mfname = instance->manufacture_name;
         } else {
             FURI_LOG_D(TAG, "ENCODER: Missing Manufacture");
@@ -547,6 +622,8 @@ SubGhzProtocolStatus
 
         subghz_protocol_keeloq_check_remote_controller(
             &instance->generic, instance->keystore, &instance->manufacture_name);
+        // The check may rename the remote, key generation has to follow the new name
+        subghz_protocol_encoder_keeloq_set_manufacture(instance, instance->manufacture_name);
 
         //optional parameter parameter
         flipper_format_read_uint32(
@@ -1106,7 +1183,7 @@ SubGhzProtocolStatus subghz_protocol_decoder_keeloq_serialize(
     subghz_protocol_keeloq_check_remote_controller(
         &instance->generic, instance->keystore, &instance->manufacture_name);
 
-    if(strcmp(instance->manufacture_name, "BFT") == 0) {
+    if(subghz_protocol_keeloq_get_mf(instance->manufacture_name) == KeeloqMfBft) {
         uint8_t seed_data[sizeof(uint32_t)] = {0};
         for(size_t i = 0; i < sizeof(uint32_t); i++) {
             seed_data[sizeof(uint32_t) - i - 1] = (instance->generic.seed >> i * 8) & 0xFF;
@@ -1314,7 +1391,8 @@ void subghz_protocol_decoder_keeloq_get_string(void* context, FuriString* output
     uint32_t code_found_reverse_hi = code_found_reverse >> 32;
     uint32_t code_found_reverse_lo = code_found_reverse & 0x00000000ffffffff;
 
-    if(strcmp(instance->manufacture_name, "BFT") == 0) {
+    KeeloqMf mf = subghz_protocol_keeloq_get_mf(instance->manufacture_name);
+    if(mf == KeeloqMfBft) {
         furi_string_cat_printf(
             output,
             "%s %dbit\r\n"
@@ -1332,7 +1410,7 @@ void subghz_protocol_decoder_keeloq_get_string(void* context, FuriString* output
             instance->generic.btn,
             instance->manufacture_name,
             instance->generic.seed);
-    } else if(strcmp(instance->manufacture_name, "Unknown") == 0) {
+    } else if(mf == KeeloqMfUnknown) {
         instance->generic.cnt = 0x0;
         furi_string_cat_printf(
             output,
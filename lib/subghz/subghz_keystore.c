@@ -4,8 +4,11 @@
 #include <furi.h>
 #include <furi_hal.h>
 
+#include <ctype.h>
+
 #include <storage/storage.h>
 #include <toolbox/hex.h>
+#include <toolbox/saved_struct.h>
 #include <toolbox/stream/stream.h>
 #include <flipper_format/flipper_format.h>
 #include <flipper_format/flipper_format_i.h>
@@ -22,6 +25,30 @@
 #define SUBGHZ_KEYSTORE_FILE_DECRYPTED_LINE_SIZE 512
 #define SUBGHZ_KEYSTORE_FILE_ENCRYPTED_LINE_SIZE (SUBGHZ_KEYSTORE_FILE_DECRYPTED_LINE_SIZE * 2)
 
+#define SUBGHZ_KEYSTORE_NAME_MAX_SIZE 64
+
+#define SUBGHZ_KEYSTORE_CACHE_EXTENSION ".cache"
+#define SUBGHZ_KEYSTORE_CACHE_MAGIC     (0x4B)
+#define SUBGHZ_KEYSTORE_CACHE_VERSION   (1)
+#define SUBGHZ_KEYSTORE_CACHE_KEY_SLOT  FURI_HAL_CRYPTO_ENCLAVE_UNIQUE_KEY_SLOT
+// Packed key record: uint64_t key, uint16_t type, uint16_t name id
+#define SUBGHZ_KEYSTORE_CACHE_RECORD_SIZE \
+    (sizeof(uint64_t) + sizeof(uint16_t) + sizeof(uint16_t))
+
+/**
+ * Binary keystore cache header, followed by encrypted data:
+ * keys (uint64_t[key_count]), types (uint16_t[key_count]),
+ * name ids (uint16_t[key_count]) and zero terminated names (names_size bytes),
+ * padded to the AES block size.
+ */
+typedef struct {
+    uint32_t source_size;
+    uint32_t source_mtime;
+    uint32_t key_count;
+    uint32_t names_size;
+    uint8_t iv[16];
+} SubGhzKeystoreCacheHeader;
+
 typedef enum {
     SubGhzKeystoreEncryptionNone,
     SubGhzKeystoreEncryptionAES256,
@@ -31,6 +58,7 @@ SubGhzKeystore* subghz_keystore_alloc(void) {
     SubGhzKeystore* instance = malloc(sizeof(SubGhzKeystore));
 
     SubGhzKeyArray_init(instance->data);
+    SubGhzKeyNameArray_init(instance->names);
 
     subghz_keystore_reset_kl(instance);
 
@@ -49,39 +77,76 @@ void subghz_keystore_free(SubGhzKeystore* instance) {
 
     for
         M_EACH(manufacture_code, instance->data, SubGhzKeyArray_t) {
-            furi_string_free(manufacture_code->name);
             manufacture_code->key = 0;
         }
     SubGhzKeyArray_clear(instance->data);
 
+    for
+        M_EACH(name, instance->names, SubGhzKeyNameArray_t) {
+            furi_string_free(*name);
+        }
+    SubGhzKeyNameArray_clear(instance->names);
+
     free(instance);
 }
 
+static FuriString* subghz_keystore_intern_name(SubGhzKeystore* instance, const char* name) {
+    // Keys of the same manufacture are stored next to each other, search from the end
+    for(size_t i = SubGhzKeyNameArray_size(instance->names); i > 0; i--) {
+        FuriString* item = *SubGhzKeyNameArray_get(instance->names, i - 1);
+        if(furi_string_equal_str(item, name)) {
+            return item;
+        }
+    }
+
+    FuriString* item = furi_string_alloc_set(name);
+    SubGhzKeyNameArray_push_back(instance->names, item);
+    return item;
+}
+
 static void subghz_keystore_add_key(
     SubGhzKeystore* instance,
-    const char* name,
+    FuriString* name,
     uint64_t key,
     uint16_t type) {
     SubGhzKey* manufacture_code = SubGhzKeyArray_push_raw(instance->data);
-    manufacture_code->name = furi_string_alloc_set(name);
+    manufacture_code->name = name;
     manufacture_code->key = key;
     manufacture_code->type = type;
 }
 
 static bool subghz_keystore_process_line(SubGhzKeystore* instance, char* line) {
-    uint64_t key = 0;
-    uint16_t type = 0;
-    char skey[17] = {0};
-    char name[65] = {0};
-    int ret = sscanf(line, "%16s:%hu:%64s", skey, &type, name);
-    key = strtoull(skey, NULL, 16);
-    if(ret == 3) {
-        subghz_keystore_add_key(instance, name, key, type);
-        return true;
-    } else {
+    // Line format: "0123456789ABCDEF:1:Name"
+    bool result = false;
+
+    do {
+        char* end = NULL;
+        uint64_t key = strtoull(line, &end, 16);
+        if(end == line || end - line > 16 || *end != ':') break;
+
+        char* type_str = end + 1;
+        unsigned long type = strtoul(type_str, &end, 10);
+        if(end == type_str || type > UINT16_MAX || *end != ':') break;
+
+        char* name = end + 1;
+        size_t name_len = 0;
+        while(name[name_len] && !isspace((unsigned char)name[name_len])) {
+            name_len++;
+        }
+        if(name_len == 0) break;
+        if(name_len > SUBGHZ_KEYSTORE_NAME_MAX_SIZE) name_len = SUBGHZ_KEYSTORE_NAME_MAX_SIZE;
+        name[name_len] = '\0';
+
+        subghz_keystore_add_key(
+            instance, subghz_keystore_intern_name(instance, name), key, (uint16_t)type);
+        result = true;
+    } while(false);
+
+    if(!result) {
         FURI_LOG_E(TAG, "Failed to load line: %s\r\n", line);
-        return false;
     }
+
+    return result;
 }
 
 static void subghz_keystore_mess_with_iv(uint8_t* iv) {
@@ -190,6 +255,238 @@ static bool subghz_keystore_read_file(SubGhzKeystore* instance, Stream* stream,
     return result;
 }
 
+// Cache is valid while the source file keeps its own size and modification time
+static bool subghz_keystore_get_source_info(
+    Storage* storage,
+    const char* file_name,
+    uint32_t* size,
+    uint32_t* mtime) {
+    FileInfo file_info;
+    if(storage_common_stat(storage, file_name, &file_info) != FSE_OK) return false;
+    if(storage_common_mtime(storage, file_name, mtime) != FSE_OK) return false;
+    *size = (uint32_t)file_info.size;
+    return true;
+}
+
+static bool subghz_keystore_cache_unpack(
+    SubGhzKeystore* instance,
+    const uint8_t* data,
+    uint32_t key_count,
+    uint32_t names_size) {
+    const uint64_t* keys = (const uint64_t*)data;
+    const uint16_t* types = (const uint16_t*)(keys + key_count);
+    const uint16_t* name_ids = types + key_count;
+    const char* names = (const char*)(name_ids + key_count);
+
+    if(names_size == 0 || names[names_size - 1] != '\0') return false;
+
+    size_t name_count = 0;
+    for(size_t i = 0; i < names_size; i++) {
+        if(names[i] == '\0') name_count++;
+    }
+
+    FuriString** interned = malloc(sizeof(FuriString*) * name_count);
+    const char* name = names;
+    for(size_t i = 0; i < name_count; i++) {
+        interned[i] = subghz_keystore_intern_name(instance, name);
+        name += strlen(name) + 1;
+    }
+
+    bool result = true;
+    for(size_t i = 0; i < key_count; i++) {
+        if(name_ids[i] >= name_count) {
+            result = false;
+            break;
+        }
+        subghz_keystore_add_key(instance, interned[name_ids[i]], keys[i], types[i]);
+    }
+
+    free(interned);
+    return result;
+}
+
+static bool subghz_keystore_cache_load(SubGhzKeystore* instance, const char* file_name) {
+    bool result = false;
+    uint8_t* payload = NULL;
+    uint8_t* decrypted = NULL;
+    size_t data_size = 0;
+
+    FuriString* cache_path =
+        furi_string_alloc_printf("%s%s", file_name, SUBGHZ_KEYSTORE_CACHE_EXTENSION);
+    const char* path = furi_string_get_cstr(cache_path);
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+
+    do {
+        uint32_t source_size = 0;
+        uint32_t source_mtime = 0;
+        if(!storage_file_exists(storage, path)) break;
+        if(!subghz_keystore_get_source_info(storage, file_name, &source_size, &source_mtime))
+            break;
+
+        uint8_t magic = 0;
+        uint8_t version = 0;
+        size_t payload_size = 0;
+        if(!saved_struct_get_metadata(path, &magic, &version, &payload_size)) break;
+        if(magic != SUBGHZ_KEYSTORE_CACHE_MAGIC || version != SUBGHZ_KEYSTORE_CACHE_VERSION ||
+           payload_size <= sizeof(SubGhzKeystoreCacheHeader)) {
+            break;
+        }
+
+        payload = malloc(payload_size);
+        if(!saved_struct_load(
+               path,
+               payload,
+               payload_size,
+               SUBGHZ_KEYSTORE_CACHE_MAGIC,
+               SUBGHZ_KEYSTORE_CACHE_VERSION)) {
+            break;
+        }
+
+        SubGhzKeystoreCacheHeader* header = (SubGhzKeystoreCacheHeader*)payload;
+        if(header->source_size != source_size || header->source_mtime != source_mtime) {
+            FURI_LOG_I(TAG, "Cache is outdated");
+            break;
+        }
+
+        data_size = payload_size - sizeof(SubGhzKeystoreCacheHeader);
+        if(data_size % 16 != 0 ||
+           (uint64_t)header->key_count * SUBGHZ_KEYSTORE_CACHE_RECORD_SIZE + header->names_size >
+               data_size) {
+            FURI_LOG_E(TAG, "Malformed cache");
+            break;
+        }
+
+        if(!furi_hal_crypto_enclave_ensure_key(SUBGHZ_KEYSTORE_CACHE_KEY_SLOT)) break;
+        if(!furi_hal_crypto_enclave_load_key(SUBGHZ_KEYSTORE_CACHE_KEY_SLOT, header->iv)) {
+            FURI_LOG_E(TAG, "Unable to load decryption key");
+            break;
+        }
+        decrypted = malloc(data_size);
+        bool decrypted_ok = furi_hal_crypto_decrypt(
+            payload + sizeof(SubGhzKeystoreCacheHeader), decrypted, data_size);
+        furi_hal_crypto_enclave_unload_key(SUBGHZ_KEYSTORE_CACHE_KEY_SLOT);
+        if(!decrypted_ok) {
+            FURI_LOG_E(TAG, "Decryption failed");
+            break;
+        }
+
+        size_t first_key = SubGhzKeyArray_size(instance->data);
+        result = subghz_keystore_cache_unpack(
+            instance, decrypted, header->key_count, header->names_size);
+        if(!result) {
+            FURI_LOG_E(TAG, "Malformed cache");
+            SubGhzKeyArray_resize(instance->data, first_key);
+        }
+    } while(false);
+
+    if(decrypted) {
+        memset(decrypted, 0, data_size);
+        free(decrypted);
+    }
+    free(payload);
+    furi_record_close(RECORD_STORAGE);
+    furi_string_free(cache_path);
+
+    return result;
+}
+
+static void
+    subghz_keystore_cache_save(SubGhzKeystore* instance, const char* file_name, size_t first_key) {
+    size_t key_count = SubGhzKeyArray_size(instance->data) - first_key;
+    if(key_count == 0) return;
+
+    // Collect names used by the keys of this file
+    const FuriString** names = malloc(sizeof(FuriString*) * key_count);
+    uint16_t* name_ids = malloc(sizeof(uint16_t) * key_count);
+    size_t name_count = 0;
+    size_t names_size = 0;
+    for(size_t i = 0; i < key_count; i++) {
+        const FuriString* name = SubGhzKeyArray_get(instance->data, first_key + i)->name;
+        size_t id = 0;
+        while(id < name_count && names[id] != name) {
+            id++;
+        }
+        if(id == name_count) {
+            names[name_count++] = name;
+            names_size += furi_string_size(name) + 1;
+        }
+        name_ids[i] = id;
+    }
+
+    size_t data_size = key_count * SUBGHZ_KEYSTORE_CACHE_RECORD_SIZE + names_size;
+    if(data_size % 16 != 0) {
+        data_size += 16 - data_size % 16;
+    }
+
+    size_t payload_size = sizeof(SubGhzKeystoreCacheHeader) + data_size;
+    uint8_t* payload = malloc(payload_size);
+    uint8_t* plain = malloc(data_size);
+
+    // Pack data
+    uint64_t* keys = (uint64_t*)plain;
+    uint16_t* types = (uint16_t*)(keys + key_count);
+    uint16_t* ids = types + key_count;
+    char* names_data = (char*)(ids + key_count);
+    for(size_t i = 0; i < key_count; i++) {
+        const SubGhzKey* key = SubGhzKeyArray_cget(instance->data, first_key + i);
+        keys[i] = key->key;
+        types[i] = key->type;
+        ids[i] = name_ids[i];
+    }
+    for(size_t i = 0; i < name_count; i++) {
+        size_t size = furi_string_size(names[i]) + 1;
+        memcpy(names_data, furi_string_get_cstr(names[i]), size);
+        names_data += size;
+    }
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FuriString* cache_path =
+        furi_string_alloc_printf("%s%s", file_name, SUBGHZ_KEYSTORE_CACHE_EXTENSION);
+
+    do {
+        SubGhzKeystoreCacheHeader* header = (SubGhzKeystoreCacheHeader*)payload;
+        if(!subghz_keystore_get_source_info(
+               storage, file_name, &header->source_size, &header->source_mtime)) {
+            break;
+        }
+        header->key_count = key_count;
+        header->names_size = names_size;
+        furi_hal_random_fill_buf(header->iv, sizeof(header->iv));
+
+        if(!furi_hal_crypto_enclave_ensure_key(SUBGHZ_KEYSTORE_CACHE_KEY_SLOT)) break;
+        if(!furi_hal_crypto_enclave_load_key(SUBGHZ_KEYSTORE_CACHE_KEY_SLOT, header->iv)) {
+            FURI_LOG_E(TAG, "Unable to load encryption key");
+            break;
+        }
+        bool encrypted = furi_hal_crypto_encrypt(
+            plain, payload + sizeof(SubGhzKeystoreCacheHeader), data_size);
+        furi_hal_crypto_enclave_unload_key(SUBGHZ_KEYSTORE_CACHE_KEY_SLOT);
+        if(!encrypted) {
+            FURI_LOG_E(TAG, "Encryption failed");
+            break;
+        }
+
+        if(!saved_struct_save(
+               furi_string_get_cstr(cache_path),
+               payload,
+               payload_size,
+               SUBGHZ_KEYSTORE_CACHE_MAGIC,
+               SUBGHZ_KEYSTORE_CACHE_VERSION)) {
+            break;
+        }
+        FURI_LOG_I(TAG, "Cached %zu keys", key_count);
+    } while(false);
+
+    furi_string_free(cache_path);
+    furi_record_close(RECORD_STORAGE);
+
+    memset(plain, 0, data_size);
+    free(plain);
+    free(payload);
+    free(name_ids);
+    free(names);
+}
+
 bool subghz_keystore_load(SubGhzKeystore* instance, const char* file_name) {
     furi_assert(instance);
     bool result = false;
@@ -202,6 +499,15 @@ bool subghz_keystore_load(SubGhzKeystore* instance, const char* file_name) {
 
     FURI_LOG_I(TAG, "Loading keystore %s", file_name);
 
+    uint32_t start = furi_get_tick();
+    instance->loaded_from_cache = subghz_keystore_cache_load(instance, file_name);
+    if(instance->loaded_from_cache) {
+        FURI_LOG_I(TAG, "Loaded from cache in %lu ms", furi_get_tick() - start);
+        furi_string_free(filetype);
+        return true;
+    }
+    size_t first_key = SubGhzKeyArray_size(instance->data);
+
     Storage* storage = furi_record_open(RECORD_STORAGE);
 
     FlipperFormat* flipper_format = flipper_format_file_alloc(storage);
@@ -235,6 +541,10 @@ bool subghz_keystore_load(SubGhzKeystore* instance, const char* file_name) {
             }
             subghz_keystore_mess_with_iv(iv);
             result = subghz_keystore_read_file(instance, stream, iv);
+            if(result) {
+                FURI_LOG_I(TAG, "Decrypted in %lu ms", furi_get_tick() - start);
+                subghz_keystore_cache_save(instance, file_name, first_key);
+            }
         } else {
             FURI_LOG_E(TAG, "Unknown encryption");
             break;
@@ -9,7 +9,7 @@ extern "C" {
 #endif
 
 typedef struct {
-    FuriString* name;
+    FuriString* name; /**< Owned by the keystore, shared by keys of the same manufacture */
     uint64_t key;
     uint16_t type;
 } SubGhzKey;
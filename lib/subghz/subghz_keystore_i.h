@@ -2,8 +2,14 @@
 
 #include <m-array.h>
 
+ARRAY_DEF(SubGhzKeyNameArray, FuriString*, M_PTR_OPLIST)
+
 struct SubGhzKeystore {
     SubGhzKeyArray_t data;
+    // Interned manufacture names, SubGhzKey::name points to the items of this array
+    SubGhzKeyNameArray_t names;
     const char* mfname;
     uint8_t kl_type;
+    // Last subghz_keystore_load was served from the binary cache
+    bool loaded_from_cache;
 };
@@ -0,0 +1,145 @@
+#include "file_read_pipeline.h"
+
+#include <furi.h>
+
+#define FILE_READ_PIPELINE_BUFFERS     (2)
+#define FILE_READ_PIPELINE_STACK_SIZE  (1024)
+#define FILE_READ_PIPELINE_THREAD_NAME "FileReadPipe"
+
+typedef struct {
+    uint8_t index;
+    size_t size;
+    bool error;
+} FileReadPipelineBlock;
+
+typedef struct {
+    File* file;
+    size_t block_size;
+    uint8_t* buffers[FILE_READ_PIPELINE_BUFFERS];
+    FuriMessageQueue* free_queue;
+    FuriMessageQueue* full_queue;
+    volatile bool stop;
+} FileReadPipeline;
+
+static int32_t file_read_pipeline_reader(void* context) {
+    FileReadPipeline* pipeline = context;
+    uint8_t index;
+
+    while(furi_message_queue_get(pipeline->free_queue, &index, FuriWaitForever) == FuriStatusOk) {
+        if(pipeline->stop) break;
+
+        FileReadPipelineBlock block = {.index = index};
+        block.size =
+            storage_file_read(pipeline->file, pipeline->buffers[index], pipeline->block_size);
+        block.error = storage_file_get_error(pipeline->file) != FSE_OK;
+
+        // Never blocks: there are no more blocks than buffers
+        furi_check(
+            furi_message_queue_put(pipeline->full_queue, &block, FuriWaitForever) ==
+            FuriStatusOk);
+
+        if(block.size == 0 || block.error) break;
+    }
+
+    return 0;
+}
+
+static bool file_read_pipeline_run_sync(
+    File* file,
+    size_t block_size,
+    FileReadPipelineCallback callback,
+    void* context) {
+    uint8_t* buffer = malloc(block_size);
+    bool success = true;
+
+    while(true) {
+        size_t read_size = storage_file_read(file, buffer, block_size);
+        if(storage_file_get_error(file) != FSE_OK) {
+            success = false;
+            break;
+        }
+        if(read_size == 0) break;
+        if(!callback(buffer, read_size, context)) {
+            success = false;
+            break;
+        }
+    }
+
+    free(buffer);
+    return success;
+}
+
+bool file_read_pipeline_run(
+    File* file,
+    size_t block_size,
+    FileReadPipelineCallback callback,
+    void* context) {
+    furi_check(file);
+    furi_check(block_size);
+    furi_check(callback);
+
+    // Not worth a thread
+    if(storage_file_size(file) - storage_file_tell(file) <= block_size) {
+        return file_read_pipeline_run_sync(file, block_size, callback, context);
+    }
+
+    FileReadPipeline pipeline = {
+        .file = file,
+        .block_size = block_size,
+        .free_queue = furi_message_queue_alloc(FILE_READ_PIPELINE_BUFFERS, sizeof(uint8_t)),
+        .full_queue = furi_message_queue_alloc(
+            FILE_READ_PIPELINE_BUFFERS, sizeof(FileReadPipelineBlock)),
+        .stop = false,
+    };
+
+    for(uint8_t i = 0; i < FILE_READ_PIPELINE_BUFFERS; i++) {
+        pipeline.buffers[i] = malloc(block_size);
+        furi_message_queue_put(pipeline.free_queue, &i, 0);
+    }
+
+    FuriThread* reader = furi_thread_alloc_ex(
+        FILE_READ_PIPELINE_THREAD_NAME,
+        FILE_READ_PIPELINE_STACK_SIZE,
+        file_read_pipeline_reader,
+        &pipeline);
+    FuriThread* current = furi_thread_get_current();
+    if(current) {
+        furi_thread_set_priority(reader, furi_thread_get_priority(current));
+    }
+    furi_thread_start(reader);
+
+    bool success = true;
+    FileReadPipelineBlock block;
+    while(true) {
+        furi_check(
+            furi_message_queue_get(pipeline.full_queue, &block, FuriWaitForever) ==
+            FuriStatusOk);
+
+        if(block.error) {
+            success = false;
+            break;
+        }
+        if(block.size == 0) break;
+
+        if(!callback(pipeline.buffers[block.index], block.size, context)) {
+            success = false;
+            // Wake up the reader, so it can see the stop flag
+            pipeline.stop = true;
+            furi_message_queue_put(pipeline.free_queue, &block.index, 0);
+            break;
+        }
+
+        furi_message_queue_put(pipeline.free_queue, &block.index, 0);
+    }
+
+    furi_thread_join(reader);
+    furi_thread_free(reader);
+
+    for(uint8_t i = 0; i < FILE_READ_PIPELINE_BUFFERS; i++) {
+        free(pipeline.buffers[i]);
+    }
+    furi_message_queue_free(pipeline.free_queue);
+    furi_message_queue_free(pipeline.full_queue);
+
+    return success;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <storage/storage.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Default block size: large reads are much faster than sector-sized ones */
+#define FILE_READ_PIPELINE_BLOCK_SIZE (4096U)
+
+/** File block consumer
+ *
+ * @param data     Block data
+ * @param size     Block size
+ * @param context  User context
+ *
+ * @return true to continue reading, false to stop
+ */
+typedef bool (*FileReadPipelineCallback)(const uint8_t* data, size_t size, void* context);
+
+/** Read file from the current position to the end, block by block
+ *
+ * Files larger than a single block are read by a helper thread into two
+ * alternating buffers, so the next block is being read from the storage while
+ * the callback processes the current one.
+ *
+ * @param file        Opened file
+ * @param block_size  Read block size
+ * @param callback    Block consumer
+ * @param context     Callback context
+ *
+ * @return true if the whole file was read and processed, false on read error
+ *         or if the callback stopped reading
+ */
+bool file_read_pipeline_run(
+    File* file,
+    size_t block_size,
+    FileReadPipelineCallback callback,
+    void* context);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,35 +1,74 @@
 #include "hex.h"
 #include <furi.h>
 
+#if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "hex_decode() assembles words in little-endian byte order"
+#endif
+
+#define HEX_NIBBLE_INVALID (0xFFU)
+
+// Nibble value of every ASCII character, HEX_NIBBLE_INVALID for non-hex ones
+static const uint8_t hex_nibble_table[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+// Two ASCII characters of every byte value
+static const char hex_byte_chars[] = "000102030405060708090A0B0C0D0E0F"
+                                     "101112131415161718191A1B1C1D1E1F"
+                                     "202122232425262728292A2B2C2D2E2F"
+                                     "303132333435363738393A3B3C3D3E3F"
+                                     "404142434445464748494A4B4C4D4E4F"
+                                     "505152535455565758595A5B5C5D5E5F"
+                                     "606162636465666768696A6B6C6D6E6F"
+                                     "707172737475767778797A7B7C7D7E7F"
+                                     "808182838485868788898A8B8C8D8E8F"
+                                     "909192939495969798999A9B9C9D9E9F"
+                                     "A0A1A2A3A4A5A6A7A8A9AAABACADAEAF"
+                                     "B0B1B2B3B4B5B6B7B8B9BABBBCBDBEBF"
+                                     "C0C1C2C3C4C5C6C7C8C9CACBCCCDCECF"
+                                     "D0D1D2D3D4D5D6D7D8D9DADBDCDDDEDF"
+                                     "E0E1E2E3E4E5E6E7E8E9EAEBECEDEEEF"
+                                     "F0F1F2F3F4F5F6F7F8F9FAFBFCFDFEFF";
+
+static inline uint8_t hex_nibble(char c) {
+    return hex_nibble_table[(uint8_t)c];
+}
+
 bool hex_char_to_hex_nibble(char c, uint8_t* nibble) {
     furi_check(nibble);
 
-    if(c >= '0' && c <= '9') {
-        *nibble = c - '0';
-        return true;
-    } else if(c >= 'A' && c <= 'F') {
-        *nibble = c - 'A' + 10;
-        return true;
-    } else if(c >= 'a' && c <= 'f') {
-        *nibble = c - 'a' + 10;
-        return true;
-    } else {
-        return false;
-    }
+    const uint8_t value = hex_nibble(c);
+    if(value == HEX_NIBBLE_INVALID) return false;
+
+    *nibble = value;
+    return true;
 }
 
 bool hex_char_to_uint8(char hi, char low, uint8_t* value) {
     furi_check(value);
 
-    uint8_t hi_nibble_value, low_nibble_value;
+    const uint8_t hi_nibble_value = hex_nibble(hi);
+    const uint8_t low_nibble_value = hex_nibble(low);
 
-    if(hex_char_to_hex_nibble(hi, &hi_nibble_value) &&
-       hex_char_to_hex_nibble(low, &low_nibble_value)) {
-        *value = (hi_nibble_value << 4) | low_nibble_value;
-        return true;
-    } else {
-        return false;
-    }
+    if((hi_nibble_value | low_nibble_value) & 0xF0) return false;
+
+    *value = (hi_nibble_value << 4) | low_nibble_value;
+    return true;
 }
 
 bool hex_chars_to_uint8(const char* value_str, uint8_t* value) {
@@ -60,6 +99,57 @@ bool hex_chars_to_uint64(const char* value_str, uint64_t* value) {
     return parse_success;
 }
 
+bool hex_decode(const char* buf, size_t len, uint8_t* out) {
+    furi_check(buf);
+    furi_check(out);
+
+    if(len % 2) return false;
+
+    size_t size = len / 2;
+    // Valid nibbles never have the upper bits set, so one check covers all of them
+    uint8_t nibbles = 0;
+
+    // 8 characters into 4 bytes: two word loads and one word store
+    for(; size >= 4; size -= 4) {
+        uint32_t chars[2];
+        memcpy(chars, buf, sizeof(chars));
+
+        uint32_t word = 0;
+        for(size_t i = 0; i < 4; i++) {
+            const uint32_t pair = chars[i / 2] >> (16 * (i % 2));
+            const uint8_t hi = hex_nibble_table[pair & 0xFF];
+            const uint8_t low = hex_nibble_table[(pair >> 8) & 0xFF];
+            nibbles |= hi | low;
+            word |= (uint32_t)((hi << 4) | low) << (8 * i);
+        }
+
+        memcpy(out, &word, sizeof(word));
+        buf += sizeof(chars);
+        out += sizeof(word);
+    }
+
+    for(; size > 0; size--) {
+        const uint8_t hi = hex_nibble(*buf++);
+        const uint8_t low = hex_nibble(*buf++);
+        nibbles |= hi | low;
+        *out++ = (hi << 4) | low;
+    }
+
+    return (nibbles & 0xF0) == 0;
+}
+
+void hex_encode(const uint8_t* data, size_t len, char* out) {
+    furi_check(data);
+    furi_check(out);
+
+    for(size_t i = 0; i < len; i++) {
+        memcpy(out, &hex_byte_chars[data[i] * 2], 2);
+        out += 2;
+    }
+
+    *out = '\0';
+}
+
 void uint8_to_hex_chars(const uint8_t* src, uint8_t* target, int length) {
     furi_check(src);
     furi_check(target);
@@ -1,6 +1,7 @@
 #pragma once
 #include "stdint.h"
 #include "stdbool.h"
+#include "stddef.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -39,6 +40,26 @@ bool hex_chars_to_uint8(const char* value_str, uint8_t* value);
  */
 bool hex_chars_to_uint64(const char* value_str, uint64_t* value);
 
+/** Convert ASCII hex string to bytes
+ *
+ * Faster than converting byte by byte for anything longer than a few bytes.
+ * On failure output contents are undefined.
+ *
+ * @param buf       ASCII data, len characters are read regardless of NUL
+ * @param len       ASCII data length, must be even
+ * @param out       output buffer, len / 2 bytes
+ *
+ * @return          true if len is even and all characters are hex digits
+ */
+bool hex_decode(const char* buf, size_t len, uint8_t* out);
+
+/** Convert bytes to NUL-terminated uppercase ASCII hex string
+ * @param data      source data
+ * @param len       source data length
+ * @param out       output buffer, len * 2 + 1 characters
+ */
+void hex_encode(const uint8_t* data, size_t len, char* out);
+
 /** Convert uint8_t to ASCII hex values
  * @param src       source data
  * @param target    output value
@@ -4,15 +4,18 @@
 #include <flipper_format/flipper_format.h>
 #include <toolbox/stream/file_stream.h>
 #include <toolbox/stream/buffered_file_stream.h>
-#include <toolbox/args.h>
+#include <toolbox/hex.h>
 
 #define TAG "KeysDict"
 
+#define KEYS_DICT_READ_BUFFER_SIZE (512U)
+
 struct KeysDict {
     Stream* stream;
     size_t key_size;
     size_t key_size_symbols;
     size_t total_keys;
+    char read_buffer[KEYS_DICT_READ_BUFFER_SIZE];
 };
 
 static inline void keys_dict_add_ending_new_line(KeysDict* instance) {
@@ -67,6 +70,7 @@ bool keys_dict_check_presence(const char* path) {
 KeysDict* keys_dict_alloc(const char* path, KeysDictMode mode, size_t key_size) {
     furi_check(path);
     furi_check(key_size > 0);
+    furi_check(key_size * 2 + 1 <= KEYS_DICT_READ_BUFFER_SIZE);
 
     KeysDict* instance = malloc(sizeof(KeysDict));
 
@@ -134,25 +138,6 @@ static void keys_dict_int_to_str(KeysDict* instance, const uint8_t* key_int, Fur
         furi_string_cat_printf(key_str, "%02X", key_int[i]);
 }
 
-static void keys_dict_str_to_int(KeysDict* instance, FuriString* key_str, uint64_t* key_int) {
-    furi_assert(instance);
-    furi_assert(key_str);
-    furi_assert(key_int);
-
-    uint8_t key_byte_tmp;
-    char h, l;
-
-    *key_int = 0ULL;
-
-    for(size_t i = 0; i < instance->key_size_symbols - 1; i += 2) {
-        h = furi_string_get_char(key_str, i);
-        l = furi_string_get_char(key_str, i + 1);
-
-        args_char_to_hex(h, l, &key_byte_tmp);
-        *key_int |= (uint64_t)key_byte_tmp << (8 * (instance->key_size - 1 - i / 2));
-    }
-}
-
 size_t keys_dict_get_total_keys(KeysDict* instance) {
     furi_check(instance);
 
@@ -166,46 +151,61 @@ bool keys_dict_rewind(KeysDict* instance) {
     return stream_rewind(instance->stream);
 }
 
-static bool keys_dict_get_next_key_str(KeysDict* instance, FuriString* key) {
-    furi_assert(instance);
-    furi_assert(instance->stream);
-    furi_assert(key);
-
-    bool key_read = false;
-    bool is_endfile = false;
-
-    furi_string_reset(key);
-
-    while(!key_read && !is_endfile)
-        key_read = keys_dict_read_key_line(instance, key, &is_endfile);
-
-    return key_read;
-}
-
-bool keys_dict_get_next_key(KeysDict* instance, uint8_t* key, size_t key_size) {
+size_t keys_dict_get_next_keys(KeysDict* instance, uint8_t* keys, size_t key_size, size_t count) {
     furi_check(instance);
     furi_check(instance->stream);
     furi_check(instance->key_size == key_size);
-    furi_check(key);
-
-    FuriString* temp_key = furi_string_alloc();
-
-    bool key_read = keys_dict_get_next_key_str(instance, temp_key);
-
-    if(key_read) {
-        size_t tmp_len = key_size;
-        uint64_t key_int = 0;
+    furi_check(keys);
+
+    const size_t key_chars = instance->key_size_symbols - 1;
+    size_t keys_read = 0;
+    // Set while in the rest of a line longer than the read size
+    bool skip_line = false;
+
+    while(keys_read < count || skip_line) {
+        // Just enough for the remaining keys if there are no comments in between
+        const size_t lines_num = MAX(count - keys_read, 1U);
+        const size_t read_size =
+            MIN(lines_num * instance->key_size_symbols, KEYS_DICT_READ_BUFFER_SIZE);
+        const size_t size =
+            stream_read(instance->stream, (uint8_t*)instance->read_buffer, read_size);
+        if(size == 0) break;
+
+        const bool is_endfile = size < read_size;
+        size_t pos = 0;
+
+        while(pos < size && (keys_read < count || skip_line)) {
+            const char* line = &instance->read_buffer[pos];
+            const char* line_end = memchr(line, '\n', size - pos);
+
+            // Incomplete line, read it again from the start
+            if(!line_end && !is_endfile && pos > 0) break;
+
+            const size_t line_len = line_end ? (size_t)(line_end - line) + 1 : size - pos;
+
+            // As in keys_dict_read_key_line(), anything after the key is ignored
+            if(!skip_line && line[0] != '#' && line_len >= key_chars &&
+               hex_decode(line, key_chars, &keys[keys_read * key_size])) {
+                keys_read++;
+            }
 
-        keys_dict_str_to_int(instance, temp_key, &key_int);
+            skip_line = !line_end;
+            pos += line_len;
+        }
 
-        while(tmp_len--) {
-            key[tmp_len] = (uint8_t)key_int;
-            key_int >>= 8;
+        // Leave the stream right after the last consumed line
+        if(pos < size) {
+            stream_seek(instance->stream, (int32_t)pos - (int32_t)size, StreamOffsetFromCurrent);
         }
+
+        if(is_endfile) break;
     }
 
-    furi_string_free(temp_key);
-    return key_read;
+    return keys_read;
+}
+
+bool keys_dict_get_next_key(KeysDict* instance, uint8_t* key, size_t key_size) {
+    return keys_dict_get_next_keys(instance, key, key_size, 1) == 1;
 }
 
 static bool keys_dict_is_key_present_str(KeysDict* instance, FuriString* key) {
@@ -78,6 +78,20 @@ bool keys_dict_is_key_present(KeysDict* instance, const uint8_t* key, size_t key
 */
 bool keys_dict_get_next_key(KeysDict* instance, uint8_t* key, size_t key_size);
 
+/** Get next keys from the list
+ * Same as keys_dict_get_next_key(), but decodes up to count keys at once
+ * with a single read per batch, which is much faster for large lists.
+ * Calls can be mixed with keys_dict_get_next_key().
+ *
+ * @param instance  - KeysDict list instance
+ * @param keys      - Array where to store keys, count * key_size bytes
+ * @param key_size  - Size of each key in bytes
+ * @param count     - Maximum number of keys to get
+ *
+ * @return Returns number of keys retrieved, less than count at the end of list
+*/
+size_t keys_dict_get_next_keys(KeysDict* instance, uint8_t* keys, size_t key_size, size_t count);
+
 /** Add key to list
  *
  * @param instance  - KeysDict list instance
@@ -0,0 +1,406 @@
+#include "md5_cache.h"
+#include "md5_calc_i.h"
+
+#include <furi.h>
+#include <furi_hal_rtc.h>
+#include <storage/filesystem_api_defines.h>
+
+#define TAG "Md5Cache"
+
+#define MD5_CACHE_MAGIC       (0x3543444DU) /* "MDC5" */
+#define MD5_CACHE_VERSION     (2U)
+#define MD5_CACHE_MAX_ENTRIES (1024U)
+#define MD5_CACHE_GROW_STEP   (64U)
+#define MD5_CACHE_CHANGES_MAX (32U)
+#define MD5_HASH_SIZE         (16U)
+
+/* New entries are written to the cache file after this many insertions, so
+ * a crash or a power loss does not throw away a whole session of hashing */
+#define MD5_CACHE_FLUSH_INSERTIONS (16U)
+
+/* FAT stores the modification time with 2 second resolution, so a file
+ * modified that recently can change again without changing its mtime */
+#define MD5_CACHE_MTIME_GUARD (2U)
+
+/* FNV-1a 64-bit */
+#define MD5_CACHE_FNV_OFFSET (14695981039346656037ULL)
+#define MD5_CACHE_FNV_PRIME  (1099511628211ULL)
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t count;
+} Md5CacheHeader;
+
+/* Paths are not stored: two of them are told apart by the hash and the length */
+typedef struct {
+    uint64_t path_hash;
+    uint32_t path_len;
+} Md5CacheKey;
+
+typedef struct {
+    Md5CacheKey key;
+    uint32_t size;
+    uint32_t mtime;
+    uint8_t md5[MD5_HASH_SIZE];
+} Md5CacheEntry;
+
+struct Md5Cache {
+    Storage* storage;
+    FuriString* cache_path;
+    FuriPubSubSubscription* subscription;
+    /* Keys of changed files, filled from the storage thread */
+    FuriMessageQueue* changes;
+    volatile bool changes_lost;
+    volatile bool unmounted;
+
+    /* Sorted by key */
+    Md5CacheEntry* entries;
+    size_t count;
+    size_t capacity;
+    bool loaded;
+    bool dirty;
+    /* Insertions since the cache file was last written */
+    size_t unsaved;
+
+    size_t hits;
+    size_t misses;
+};
+
+static Md5CacheKey md5_cache_path_key(const char* path) {
+    Md5CacheKey key = {.path_hash = MD5_CACHE_FNV_OFFSET, .path_len = 0};
+    while(path[key.path_len]) {
+        key.path_hash ^= (uint8_t)path[key.path_len++];
+        key.path_hash *= MD5_CACHE_FNV_PRIME;
+    }
+    return key;
+}
+
+static int md5_cache_key_cmp(const Md5CacheKey* a, const Md5CacheKey* b) {
+    if(a->path_hash != b->path_hash) return a->path_hash < b->path_hash ? -1 : 1;
+    if(a->path_len != b->path_len) return a->path_len < b->path_len ? -1 : 1;
+    return 0;
+}
+
+/* Storage events carry resolved paths, so only those can be invalidated */
+static bool md5_cache_path_is_cacheable(const char* path) {
+    return strncmp(path, STORAGE_EXT_PATH_PREFIX "/", strlen(STORAGE_EXT_PATH_PREFIX "/")) == 0;
+}
+
+static void md5_cache_storage_callback(const void* message, void* context) {
+    const StorageEvent* event = message;
+    Md5Cache* cache = context;
+
+    if(event->type == StorageEventTypeFileChange) {
+        Md5CacheKey key = md5_cache_path_key(event->path);
+        if(furi_message_queue_put(cache->changes, &key, 0) != FuriStatusOk) {
+            cache->changes_lost = true;
+        }
+    } else if(event->type == StorageEventTypeCardUnmount) {
+        cache->unmounted = true;
+    }
+}
+
+static size_t md5_cache_lower_bound(const Md5Cache* cache, const Md5CacheKey* key) {
+    size_t low = 0;
+    size_t high = cache->count;
+
+    while(low < high) {
+        size_t mid = low + (high - low) / 2;
+        if(md5_cache_key_cmp(&cache->entries[mid].key, key) < 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    return low;
+}
+
+static Md5CacheEntry* md5_cache_find(Md5Cache* cache, const Md5CacheKey* key) {
+    size_t index = md5_cache_lower_bound(cache, key);
+    if(index < cache->count && md5_cache_key_cmp(&cache->entries[index].key, key) == 0) {
+        return &cache->entries[index];
+    }
+    return NULL;
+}
+
+static void md5_cache_remove_at(Md5Cache* cache, size_t index) {
+    memmove(
+        &cache->entries[index],
+        &cache->entries[index + 1],
+        (cache->count - index - 1) * sizeof(Md5CacheEntry));
+    cache->count--;
+    cache->dirty = true;
+}
+
+static void md5_cache_remove(Md5Cache* cache, const Md5CacheKey* key) {
+    Md5CacheEntry* entry = md5_cache_find(cache, key);
+    if(entry) {
+        md5_cache_remove_at(cache, entry - cache->entries);
+    }
+}
+
+static void md5_cache_clear(Md5Cache* cache) {
+    free(cache->entries);
+    cache->entries = NULL;
+    cache->count = 0;
+    cache->capacity = 0;
+}
+
+static void md5_cache_insert(Md5Cache* cache, const Md5CacheEntry* new_entry) {
+    Md5CacheEntry* entry = md5_cache_find(cache, &new_entry->key);
+
+    if(!entry) {
+        if(cache->count == MD5_CACHE_MAX_ENTRIES) {
+            // Full: evict a random entry
+            md5_cache_remove_at(cache, rand() % cache->count);
+        }
+
+        if(cache->count == cache->capacity) {
+            cache->capacity += MD5_CACHE_GROW_STEP;
+            cache->entries = realloc(cache->entries, cache->capacity * sizeof(Md5CacheEntry));
+        }
+
+        size_t index = md5_cache_lower_bound(cache, &new_entry->key);
+        memmove(
+            &cache->entries[index + 1],
+            &cache->entries[index],
+            (cache->count - index) * sizeof(Md5CacheEntry));
+        cache->count++;
+        entry = &cache->entries[index];
+    }
+
+    *entry = *new_entry;
+    cache->dirty = true;
+}
+
+static bool md5_cache_load(Md5Cache* cache) {
+    File* file = storage_file_alloc(cache->storage);
+    const char* cache_path = furi_string_get_cstr(cache->cache_path);
+    bool success = false;
+
+    do {
+        if(!storage_file_open(file, cache_path, FSAM_READ, FSOM_OPEN_EXISTING)) break;
+
+        Md5CacheHeader header;
+        if(storage_file_read(file, &header, sizeof(header)) != sizeof(header)) break;
+        if(header.magic != MD5_CACHE_MAGIC || header.version != MD5_CACHE_VERSION) break;
+        if(header.count == 0 || header.count > MD5_CACHE_MAX_ENTRIES) break;
+
+        size_t entries_size = header.count * sizeof(Md5CacheEntry);
+        cache->entries = malloc(entries_size);
+        cache->capacity = header.count;
+        if(storage_file_read(file, cache->entries, entries_size) != entries_size) break;
+
+        success = true;
+        for(size_t i = 1; i < header.count; i++) {
+            if(md5_cache_key_cmp(&cache->entries[i - 1].key, &cache->entries[i].key) >= 0) {
+                success = false;
+                break;
+            }
+        }
+
+        if(success) {
+            cache->count = header.count;
+        }
+    } while(false);
+
+    storage_file_close(file);
+    storage_file_free(file);
+
+    if(!success) {
+        md5_cache_clear(cache);
+    }
+
+    FURI_LOG_D(TAG, "Loaded %zu entries", cache->count);
+    return success;
+}
+
+static bool md5_cache_save(Md5Cache* cache) {
+    File* file = storage_file_alloc(cache->storage);
+    const char* cache_path = furi_string_get_cstr(cache->cache_path);
+    bool success = false;
+
+    do {
+        if(cache->count == 0) {
+            FS_Error error = storage_common_remove(cache->storage, cache_path);
+            success = error == FSE_OK || error == FSE_NOT_EXIST;
+            break;
+        }
+
+        if(!storage_file_open(file, cache_path, FSAM_WRITE, FSOM_CREATE_ALWAYS)) break;
+
+        Md5CacheHeader header = {
+            .magic = MD5_CACHE_MAGIC,
+            .version = MD5_CACHE_VERSION,
+            .count = cache->count,
+        };
+        if(storage_file_write(file, &header, sizeof(header)) != sizeof(header)) break;
+
+        size_t entries_size = cache->count * sizeof(Md5CacheEntry);
+        if(storage_file_write(file, cache->entries, entries_size) != entries_size) break;
+
+        success = true;
+    } while(false);
+
+    storage_file_close(file);
+    storage_file_free(file);
+
+    if(!success) {
+        FURI_LOG_E(TAG, "Failed to save");
+        storage_common_remove(cache->storage, cache_path);
+    }
+
+    return success;
+}
+
+static void md5_cache_sync(Md5Cache* cache) {
+    if(cache->unmounted) {
+        // Entries may belong to another card now
+        cache->unmounted = false;
+        md5_cache_clear(cache);
+        furi_message_queue_reset(cache->changes);
+        cache->changes_lost = false;
+        cache->loaded = false;
+        cache->dirty = false;
+        cache->unsaved = 0;
+    }
+
+    if(!cache->loaded) {
+        md5_cache_load(cache);
+        cache->loaded = true;
+    }
+
+    Md5CacheKey key;
+    while(furi_message_queue_get(cache->changes, &key, 0) == FuriStatusOk) {
+        md5_cache_remove(cache, &key);
+    }
+
+    if(cache->changes_lost) {
+        // Unknown files were changed, the cache file must not be reused
+        cache->changes_lost = false;
+        md5_cache_clear(cache);
+        cache->dirty = true;
+    }
+}
+
+static void md5_cache_flush(Md5Cache* cache) {
+    // Drop entries of files changed by the last requests
+    md5_cache_sync(cache);
+    if(cache->dirty && md5_cache_save(cache)) {
+        cache->dirty = false;
+    }
+    cache->unsaved = 0;
+}
+
+Md5Cache* md5_cache_alloc(Storage* storage, const char* cache_path) {
+    furi_check(storage);
+    furi_check(cache_path);
+
+    Md5Cache* cache = malloc(sizeof(Md5Cache));
+    cache->storage = storage;
+    cache->cache_path = furi_string_alloc_set(cache_path);
+    cache->changes = furi_message_queue_alloc(MD5_CACHE_CHANGES_MAX, sizeof(Md5CacheKey));
+    cache->subscription =
+        furi_pubsub_subscribe(storage_get_pubsub(storage), md5_cache_storage_callback, cache);
+
+    return cache;
+}
+
+void md5_cache_free(Md5Cache* cache) {
+    furi_check(cache);
+
+    furi_pubsub_unsubscribe(storage_get_pubsub(cache->storage), cache->subscription);
+
+    if(cache->hits || cache->misses) {
+        FURI_LOG_I(TAG, "%zu hits, %zu misses", cache->hits, cache->misses);
+    }
+
+    if(cache->loaded && !cache->unmounted) {
+        md5_cache_flush(cache);
+    }
+
+    md5_cache_clear(cache);
+    furi_message_queue_free(cache->changes);
+    furi_string_free(cache->cache_path);
+    free(cache);
+}
+
+bool md5_cache_calc_file(
+    Md5Cache* cache,
+    File* file,
+    const char* path,
+    unsigned char output[16],
+    FS_Error* file_error) {
+    furi_check(cache);
+    furi_check(file);
+    furi_check(path);
+
+    if(!storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        if(file_error != NULL) {
+            *file_error = storage_file_get_error(file);
+        }
+        return false;
+    }
+
+    // The file cannot be opened for writing until it is closed below, so the
+    // pending changes, the size, the mtime and the contents are consistent
+    Md5CacheEntry entry = {.key = md5_cache_path_key(path)};
+    uint64_t size = storage_file_size(file);
+    bool cacheable = md5_cache_path_is_cacheable(path) && size <= UINT32_MAX &&
+                     storage_common_mtime(cache->storage, path, &entry.mtime) == FSE_OK;
+    entry.size = size;
+
+    const Md5CacheEntry* cached = NULL;
+    if(cacheable) {
+        md5_cache_sync(cache);
+        cached = md5_cache_find(cache, &entry.key);
+    }
+
+    bool result;
+    if(cached && cached->size == entry.size && cached->mtime == entry.mtime) {
+        memcpy(output, cached->md5, MD5_HASH_SIZE);
+        cache->hits++;
+        result = true;
+    } else {
+        result = md5_calc_opened_file(file, output);
+        cache->misses++;
+
+        if(result && cacheable &&
+           entry.mtime + MD5_CACHE_MTIME_GUARD < furi_hal_rtc_get_timestamp()) {
+            memcpy(entry.md5, output, MD5_HASH_SIZE);
+            md5_cache_insert(cache, &entry);
+
+            if(++cache->unsaved >= MD5_CACHE_FLUSH_INSERTIONS) {
+                md5_cache_flush(cache);
+            }
+        }
+    }
+
+    if(file_error != NULL) {
+        *file_error = storage_file_get_error(file);
+    }
+
+    storage_file_close(file);
+    return result;
+}
+
+bool md5_cache_string_calc_file(
+    Md5Cache* cache,
+    File* file,
+    const char* path,
+    FuriString* output,
+    FS_Error* file_error) {
+    unsigned char hash[MD5_HASH_SIZE];
+    bool result = md5_cache_calc_file(cache, file, path, hash, file_error);
+
+    if(result) {
+        furi_string_set(output, "");
+        for(size_t i = 0; i < MD5_HASH_SIZE; i++) {
+            furi_string_cat_printf(output, "%02x", hash[i]);
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <stdint.h>
+#include <storage/storage.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Default cache location */
+#define MD5_CACHE_DEFAULT_PATH EXT_PATH(".md5sum.cache")
+
+typedef struct Md5Cache Md5Cache;
+
+/** Allocate MD5 cache
+ *
+ * Entries are keyed by path and validated by file size and modification time.
+ * The cache file is loaded on first use and written back every few new
+ * entries. Files opened for writing or removed while the cache is allocated
+ * are dropped from it.
+ *
+ * @param storage     Storage instance
+ * @param cache_path  Cache file path
+ *
+ * @return Md5Cache instance
+ */
+Md5Cache* md5_cache_alloc(Storage* storage, const char* cache_path);
+
+/** Free MD5 cache, writing it back to the cache file if it was changed
+ *
+ * @param cache  Md5Cache instance
+ */
+void md5_cache_free(Md5Cache* cache);
+
+/** Calculate file MD5, answering from the cache when possible
+ *
+ * Same as md5_calc_file, but only hashes the file if it is not in the cache
+ * or was modified since it was cached.
+ *
+ * @param cache       Md5Cache instance
+ * @param file        File instance
+ * @param path        File path
+ * @param output      MD5 output
+ * @param file_error  File error output, can be NULL
+ *
+ * @return true on success
+ */
+bool md5_cache_calc_file(
+    Md5Cache* cache,
+    File* file,
+    const char* path,
+    unsigned char output[16],
+    FS_Error* file_error);
+
+/** Calculate file MD5 as a hex string, answering from the cache when possible
+ *
+ * @param cache       Md5Cache instance
+ * @param file        File instance
+ * @param path        File path
+ * @param output      MD5 hex string output
+ * @param file_error  File error output, can be NULL
+ *
+ * @return true on success
+ */
+bool md5_cache_string_calc_file(
+    Md5Cache* cache,
+    File* file,
+    const char* path,
+    FuriString* output,
+    FS_Error* file_error);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,9 +1,29 @@
 #include "md5_calc.h"
+#include "md5_calc_i.h"
+#include "file_read_pipeline.h"
 
 #include <storage/filesystem_api_defines.h>
 #include <storage/storage.h>
 #include <mbedtls/md5.h>
 
+static bool md5_calc_file_block(const uint8_t* data, size_t size, void* context) {
+    mbedtls_md5_update(context, data, size);
+    return true;
+}
+
+bool md5_calc_opened_file(File* file, unsigned char output[16]) {
+    mbedtls_md5_context* md5_ctx = malloc(sizeof(mbedtls_md5_context));
+    mbedtls_md5_init(md5_ctx);
+    mbedtls_md5_starts(md5_ctx);
+    /* Hash the current block while the next one is being read */
+    bool result =
+        file_read_pipeline_run(file, FILE_READ_PIPELINE_BLOCK_SIZE, md5_calc_file_block, md5_ctx);
+    mbedtls_md5_finish(md5_ctx, output);
+    free(md5_ctx);
+
+    return result;
+}
+
 bool md5_calc_file(File* file, const char* path, unsigned char output[16], FS_Error* file_error) {
     if(!storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
         if(file_error != NULL) {
@@ -12,27 +32,7 @@ bool md5_calc_file(File* file, const char* path, unsigned char output[16], FS_Er
         return false;
     }
 
-    const size_t size_to_read = 512;
-    uint8_t* data = malloc(size_to_read);
-    bool result = true;
-
-    mbedtls_md5_context* md5_ctx = malloc(sizeof(mbedtls_md5_context));
-    mbedtls_md5_init(md5_ctx);
-    mbedtls_md5_starts(md5_ctx);
-    while(true) {
-        size_t read_size = storage_file_read(file, data, size_to_read);
-        if(storage_file_get_error(file) != FSE_OK) {
-            result = false;
-            break;
-        }
-        if(read_size == 0) {
-            break;
-        }
-        mbedtls_md5_update(md5_ctx, data, read_size);
-    }
-    mbedtls_md5_finish(md5_ctx, output);
-    free(md5_ctx);
-    free(data);
+    bool result = md5_calc_opened_file(file, output);
 
     if(file_error != NULL) {
         *file_error = storage_file_get_error(file);
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <storage/storage.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Calculate MD5 of an opened file, from the current position to the end
+ *
+ * @param file    Opened file
+ * @param output  MD5 output
+ *
+ * @return true on success
+ */
+bool md5_calc_opened_file(File* file, unsigned char output[16]);
+
+#ifdef __cplusplus
+}
+#endif
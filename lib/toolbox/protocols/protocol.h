@@ -5,7 +5,16 @@
 #include <lib/toolbox/level_duration.h>
 #include <furi.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** State shared by the protocols of one ProtocolDict */
+typedef struct ProtocolShared ProtocolShared;
+
 typedef void* (*ProtocolAlloc)(void);
+typedef void* (*ProtocolAllocShared)(ProtocolShared* shared);
+typedef void (*ProtocolSharedFree)(void* object);
 typedef void (*ProtocolFree)(void* protocol);
 typedef uint8_t* (*ProtocolGetData)(void* protocol);
 
@@ -36,6 +45,8 @@ typedef struct {
     const uint8_t validate_count;
 
     ProtocolAlloc alloc;
+    // Optional, used instead of alloc by ProtocolDict
+    ProtocolAllocShared alloc_shared;
     ProtocolFree free;
     ProtocolGetData get_data;
     ProtocolDecoder decoder;
@@ -45,3 +56,42 @@ typedef struct {
     ProtocolRenderData render_brief_data;
     ProtocolWriteData write_data;
 } ProtocolBase;
+
+/** Get object shared by the protocols of one ProtocolDict
+ *
+ * @param shared    ProtocolShared instance passed to ProtocolAllocShared
+ * @param key       object identity, usually the address of a static variable
+ *
+ * @return object stored with protocol_shared_set() or NULL
+ */
+void* protocol_shared_get(ProtocolShared* shared, const void* key);
+
+/** Store object shared by the protocols of one ProtocolDict
+ *
+ * Object is freed along with the ProtocolDict, after all of its protocols.
+ *
+ * @param shared    ProtocolShared instance passed to ProtocolAllocShared
+ * @param key       object identity, usually the address of a static variable
+ * @param object    object to store
+ * @param free_cb   object free callback
+ */
+void protocol_shared_set(
+    ProtocolShared* shared,
+    const void* key,
+    void* object,
+    ProtocolSharedFree free_cb);
+
+/** Get current sample number
+ *
+ * Incremented by ProtocolDict before every sample is fed to its decoders,
+ * so protocols can tell whether another protocol already processed it.
+ *
+ * @param shared    ProtocolShared instance passed to ProtocolAllocShared
+ *
+ * @return sample number
+ */
+uint32_t protocol_shared_get_sample(const ProtocolShared* shared);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,9 +1,11 @@
 #include <furi.h>
 #include "protocol_dict.h"
+#include "protocol_shared_i.h"
 
 struct ProtocolDict {
     const ProtocolBase** base;
     size_t count;
+    ProtocolShared* shared;
     void* data[];
 };
 
@@ -13,9 +15,14 @@ ProtocolDict* protocol_dict_alloc(const ProtocolBase** protocols, size_t count)
     ProtocolDict* dict = malloc(sizeof(ProtocolDict) + (sizeof(void*) * count));
     dict->base = protocols;
     dict->count = count;
+    dict->shared = protocol_shared_alloc();
 
     for(size_t i = 0; i < dict->count; i++) {
-        dict->data[i] = dict->base[i]->alloc();
+        if(dict->base[i]->alloc_shared) {
+            dict->data[i] = dict->base[i]->alloc_shared(dict->shared);
+        } else {
+            dict->data[i] = dict->base[i]->alloc();
+        }
     }
 
     return dict;
@@ -28,6 +35,7 @@ void protocol_dict_free(ProtocolDict* dict) {
         dict->base[i]->free(dict->data[i]);
     }
 
+    protocol_shared_free(dict->shared);
     free(dict);
 }
 
@@ -107,6 +115,8 @@ uint32_t protocol_dict_get_features(ProtocolDict* dict, size_t protocol_index) {
 ProtocolId protocol_dict_decoders_feed(ProtocolDict* dict, bool level, uint32_t duration) {
     furi_check(dict);
 
+    protocol_shared_next_sample(dict->shared);
+
     bool done = false;
     ProtocolId ready_protocol_id = PROTOCOL_NO;
 
@@ -133,6 +143,8 @@ ProtocolId protocol_dict_decoders_feed_by_feature(
     uint32_t duration) {
     furi_check(dict);
 
+    protocol_shared_next_sample(dict->shared);
+
     bool done = false;
     ProtocolId ready_protocol_id = PROTOCOL_NO;
 
@@ -162,6 +174,8 @@ ProtocolId protocol_dict_decoders_feed_by_id(
     uint32_t duration) {
     furi_check(protocol_index < dict->count);
 
+    protocol_shared_next_sample(dict->shared);
+
     ProtocolId ready_protocol_id = PROTOCOL_NO;
     ProtocolDecoderFeed fn = dict->base[protocol_index]->decoder.feed;
 
@@ -0,0 +1,70 @@
+#include <furi.h>
+#include "protocol_shared_i.h"
+
+typedef struct ProtocolSharedItem ProtocolSharedItem;
+
+struct ProtocolSharedItem {
+    const void* key;
+    void* object;
+    ProtocolSharedFree free_cb;
+    ProtocolSharedItem* next;
+};
+
+struct ProtocolShared {
+    ProtocolSharedItem* items;
+    uint32_t sample;
+};
+
+ProtocolShared* protocol_shared_alloc(void) {
+    ProtocolShared* shared = malloc(sizeof(ProtocolShared));
+    return shared;
+}
+
+void protocol_shared_free(ProtocolShared* shared) {
+    furi_check(shared);
+
+    while(shared->items) {
+        ProtocolSharedItem* item = shared->items;
+        shared->items = item->next;
+        item->free_cb(item->object);
+        free(item);
+    }
+
+    free(shared);
+}
+
+void protocol_shared_next_sample(ProtocolShared* shared) {
+    shared->sample++;
+}
+
+void* protocol_shared_get(ProtocolShared* shared, const void* key) {
+    furi_check(shared);
+
+    for(ProtocolSharedItem* item = shared->items; item; item = item->next) {
+        if(item->key == key) return item->object;
+    }
+
+    return NULL;
+}
+
+void protocol_shared_set(
+    ProtocolShared* shared,
+    const void* key,
+    void* object,
+    ProtocolSharedFree free_cb) {
+    furi_check(shared);
+    furi_check(free_cb);
+    furi_check(protocol_shared_get(shared, key) == NULL);
+
+    ProtocolSharedItem* item = malloc(sizeof(ProtocolSharedItem));
+    item->key = key;
+    item->object = object;
+    item->free_cb = free_cb;
+    item->next = shared->items;
+    shared->items = item;
+}
+
+uint32_t protocol_shared_get_sample(const ProtocolShared* shared) {
+    furi_check(shared);
+    return shared->sample;
+}
@@ -0,0 +1,8 @@
+#pragma once
+#include "protocol.h"
+
+ProtocolShared* protocol_shared_alloc(void);
+
+void protocol_shared_free(ProtocolShared* shared);
+
+void protocol_shared_next_sample(ProtocolShared* shared);
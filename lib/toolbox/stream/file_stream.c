@@ -1,11 +1,22 @@
 #include "stream.h"
 #include "stream_i.h"
 #include "file_stream.h"
+#include "file_stream_i.h"
+#include "string_stream.h"
+
+#define TAG "FileStream"
+
+/** Chunk size used to move the file tail on insert and delete */
+#define FILE_STREAM_SHIFT_CHUNK_SIZE 4096U
 
 typedef struct {
     Stream stream_base;
     Storage* storage;
     File* file;
+#ifdef FW_CFG_unit_tests
+    /* Countdown to an injected tail move write failure, 0 if none */
+    size_t shift_write_failure;
+#endif
 } FileStream;
 
 static void file_stream_free(FileStream* stream);
@@ -40,6 +51,9 @@ Stream* file_stream_alloc(Storage* storage) {
     FileStream* stream = malloc(sizeof(FileStream));
     stream->file = storage_file_alloc(storage);
     stream->storage = storage;
+#ifdef FW_CFG_unit_tests
+    stream->shift_write_failure = 0;
+#endif
 
     stream->stream_base.vtable = &file_stream_vtable;
     return (Stream*)stream;
@@ -143,75 +157,201 @@ static size_t file_stream_read(FileStream* stream, uint8_t* data, size_t size) {
     return storage_file_read(stream->file, data, size);
 }
 
-static bool file_stream_delete_and_insert(
-    FileStream* _stream,
-    size_t delete_size,
-    StreamWriteCB write_callback,
-    const void* ctx) {
-    bool result = false;
-    Stream* stream = (Stream*)_stream;
+#ifdef FW_CFG_unit_tests
+void file_stream_set_shift_write_failure(Stream* _stream, size_t write_index) {
+    furi_check(_stream);
+    FileStream* stream = (FileStream*)_stream;
+    furi_check(stream->stream_base.vtable == &file_stream_vtable);
+    stream->shift_write_failure = write_index;
+}
+#endif
 
-    // open scratchpad
-    Stream* scratch_stream = file_stream_alloc(_stream->storage);
+static bool file_stream_move_chunk(
+    FileStream* stream,
+    size_t from,
+    size_t to,
+    uint8_t* buffer,
+    size_t size) {
+    File* file = stream->file;
+    if(!storage_file_seek(file, from, true)) return false;
+    if(storage_file_read(file, buffer, size) != size) return false;
+    if(!storage_file_seek(file, to, true)) return false;
+
+#ifdef FW_CFG_unit_tests
+    if(stream->shift_write_failure && --stream->shift_write_failure == 0) {
+        // card gave up in the middle of the chunk
+        storage_file_write(file, buffer, size / 2);
+        return false;
+    }
+#endif
+
+    return storage_file_write(file, buffer, size) == size;
+}
+
+/* Move data inside of the file, chunk order makes sure nothing is overwritten before read */
+static bool file_stream_shift(FileStream* stream, size_t from, size_t to, size_t size) {
+    if(from == to || size == 0) return true;
+
+    uint8_t* buffer = malloc(MIN(size, FILE_STREAM_SHIFT_CHUNK_SIZE));
+    bool result = true;
+
+    if(to < from) {
+        size_t offset = 0;
+        while(result && offset < size) {
+            size_t chunk_size = MIN(size - offset, FILE_STREAM_SHIFT_CHUNK_SIZE);
+            result =
+                file_stream_move_chunk(stream, from + offset, to + offset, buffer, chunk_size);
+            offset += chunk_size;
+        }
+    } else {
+        size_t offset = size;
+        while(result && offset > 0) {
+            size_t chunk_size = MIN(offset, FILE_STREAM_SHIFT_CHUNK_SIZE);
+            offset -= chunk_size;
+            result =
+                file_stream_move_chunk(stream, from + offset, to + offset, buffer, chunk_size);
+        }
+    }
+
+    free(buffer);
+    return result;
+}
+
+static bool file_stream_extend(File* file, size_t file_size, size_t size) {
+    if(!storage_file_seek(file, file_size, true)) return false;
+
+    uint8_t* buffer = malloc(MIN(size, FILE_STREAM_SHIFT_CHUNK_SIZE));
+    bool result = true;
+
+    while(result && size > 0) {
+        size_t chunk_size = MIN(size, FILE_STREAM_SHIFT_CHUNK_SIZE);
+        result = storage_file_write(file, buffer, chunk_size) == chunk_size;
+        size -= chunk_size;
+    }
+
+    free(buffer);
+    return result;
+}
+
+/* Copy the original bytes from `position` to the end into a scratchpad, so that an interrupted
+ * tail move can be rolled back. Returns NULL if the journal could not be written */
+static Stream* file_stream_journal_alloc(FileStream* stream, size_t position, FuriString* path) {
+    Stream* journal = file_stream_alloc(stream->storage);
+    size_t size = file_stream_size(stream) - position;
 
     // TODO FL-3546: we need something like "storage_open_tmpfile and storage_close_tmpfile"
-    FuriString* scratch_name;
-    FuriString* tmp_name;
-    tmp_name = furi_string_alloc();
+    FuriString* tmp_name = furi_string_alloc();
     storage_get_next_filename(
-        _stream->storage, STORAGE_EXT_PATH_PREFIX, ".scratch", ".pad", tmp_name, 255);
-    scratch_name = furi_string_alloc_printf(EXT_PATH("%s.pad"), furi_string_get_cstr(tmp_name));
+        stream->storage, STORAGE_EXT_PATH_PREFIX, ".scratch", ".pad", tmp_name, 255);
+    furi_string_printf(path, EXT_PATH("%s.pad"), furi_string_get_cstr(tmp_name));
     furi_string_free(tmp_name);
 
+    bool result = false;
     do {
         if(!file_stream_open(
-               scratch_stream,
-               furi_string_get_cstr(scratch_name),
-               FSAM_READ_WRITE,
-               FSOM_CREATE_NEW))
+               journal, furi_string_get_cstr(path), FSAM_READ_WRITE, FSOM_CREATE_NEW))
             break;
+        if(!storage_file_seek(stream->file, position, true)) break;
+        if(stream_copy((Stream*)stream, journal, size) != size) break;
+        result = true;
+    } while(false);
+
+    storage_file_seek(stream->file, position, true);
+
+    if(!result) {
+        stream_free(journal);
+        storage_common_remove(stream->storage, furi_string_get_cstr(path));
+        journal = NULL;
+    }
+
+    return journal;
+}
+
+/* Put the journaled bytes back at `position` and cut the file to its original size */
+static bool file_stream_journal_restore(FileStream* stream, Stream* journal, size_t position) {
+    size_t size = stream_size(journal);
+    if(!stream_rewind(journal)) return false;
+    if(!storage_file_seek(stream->file, position, true)) return false;
+    if(stream_copy(journal, (Stream*)stream, size) != size) return false;
+    if(!storage_file_truncate(stream->file)) return false;
+    return storage_file_seek(stream->file, position, true);
+}
+
+static bool file_stream_delete_and_insert(
+    FileStream* _stream,
+    size_t delete_size,
+    StreamWriteCB write_callback,
+    const void* ctx) {
+    bool result = false;
+    Stream* stream = (Stream*)_stream;
+    File* file = _stream->file;
+    Stream* journal = NULL;
+    FuriString* journal_path = furi_string_alloc();
 
-        size_t current_position = stream_tell(stream);
+    // inserted data is rendered first, its size tells where the tail goes
+    Stream* insert_stream = string_stream_alloc();
+    size_t current_position = stream_tell(stream);
+
+    do {
+        if(write_callback) {
+            if(!write_callback(insert_stream, ctx)) break;
+        }
+        size_t insert_size = stream_size(insert_stream);
         size_t file_size = stream_size(stream);
 
         size_t size_to_delete = file_size - current_position;
         size_to_delete = MIN(delete_size, size_to_delete);
 
-        size_t size_to_copy_before = current_position;
-        size_t size_to_copy_after = file_size - current_position - size_to_delete;
+        size_t tail_position = current_position + size_to_delete;
+        size_t tail_size = file_size - tail_position;
+        size_t new_tail_position = current_position + insert_size;
 
-        // copy file from 0 to insert position to scratchpad
-        if(!stream_rewind(stream)) break;
-        if(stream_copy(stream, scratch_stream, size_to_copy_before) != size_to_copy_before) break;
-
-        if(write_callback) {
-            if(!write_callback(scratch_stream, ctx)) break;
+        // a tail move cannot be atomic, the bytes it overwrites are kept to roll it back
+        if(tail_size && new_tail_position != tail_position) {
+            journal = file_stream_journal_alloc(_stream, current_position, journal_path);
+            if(!journal) break;
         }
-        size_t new_position = stream_tell(scratch_stream);
 
-        // copy key file after insert position + size_to_delete to scratchpad
-        if(!stream_seek(stream, size_to_delete, StreamOffsetFromCurrent)) break;
-        if(stream_copy(stream, scratch_stream, size_to_copy_after) != size_to_copy_after) break;
+        // reserve space before moving anything, so a full card fails early
+        if(tail_size && new_tail_position > tail_position) {
+            if(!file_stream_extend(file, file_size, new_tail_position - tail_position)) break;
+        }
 
-        size_t new_file_size = stream_size(scratch_stream);
+        // nothing is moved on append and on same size replace
+        if(!file_stream_shift(_stream, tail_position, new_tail_position, tail_size)) break;
 
-        // copy whole scratchpad file to the original file
-        if(!stream_rewind(stream)) break;
-        if(!stream_rewind(scratch_stream)) break;
-        if(stream_copy(scratch_stream, stream, new_file_size) != new_file_size) break;
+        if(!storage_file_seek(file, current_position, true)) break;
+        if(!stream_rewind(insert_stream)) break;
+        if(stream_copy(insert_stream, stream, insert_size) != insert_size) break;
 
-        // and truncate original file
-        if(!storage_file_truncate(_stream->file)) break;
+        // drop leftovers of the old tail if the file got shorter
+        size_t new_file_size = new_tail_position + tail_size;
+        if(new_file_size < file_size) {
+            if(!storage_file_seek(file, new_file_size, true)) break;
+            if(!storage_file_truncate(file)) break;
+        }
 
         // move seek pointer at insert end
-        if(!stream_seek(stream, new_position, StreamOffsetFromStart)) break;
+        if(!storage_file_seek(file, new_tail_position, true)) break;
 
         result = true;
     } while(false);
 
-    stream_free(scratch_stream);
-    storage_common_remove(_stream->storage, furi_string_get_cstr(scratch_name));
-    furi_string_free(scratch_name);
+    if(journal) {
+        bool restored = result || file_stream_journal_restore(_stream, journal, current_position);
+        stream_free(journal);
+        if(restored) {
+            storage_common_remove(_stream->storage, furi_string_get_cstr(journal_path));
+        } else {
+            FURI_LOG_E(
+                TAG,
+                "Rollback failed, original data is in %s",
+                furi_string_get_cstr(journal_path));
+        }
+    }
+
+    furi_string_free(journal_path);
+    stream_free(insert_stream);
 
     return result;
 }
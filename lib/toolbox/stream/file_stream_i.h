@@ -0,0 +1,19 @@
+#pragma once
+#include "stream.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef FW_CFG_unit_tests
+/**
+ * Make a chunk write of the following tail moves fail halfway, for unit tests.
+ * @param stream file stream instance
+ * @param write_index 1-based index of the failing chunk write, 0 to disable
+ */
+void file_stream_set_shift_write_failure(Stream* stream, size_t write_index);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
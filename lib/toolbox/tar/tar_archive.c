@@ -11,6 +11,9 @@
 #define MAX_NAME_LEN    255
 #define FILE_BLOCK_SIZE 512
 
+/* Extraction moves data in multiples of the tar record size */
+#define EXTRACT_BLOCK_SIZE 4096
+
 #define FILE_OPEN_NTRIES      10
 #define FILE_OPEN_RETRY_DELAY 25
 
@@ -32,6 +35,8 @@ typedef struct TarArchive {
     Storage* storage;
     File* stream;
     mtar_t tar;
+    /* Set for compressed archives, owned by mtar */
+    struct HeatshrinkStream* hs_stream;
     tar_unpack_file_cb unpack_cb;
     void* unpack_cb_context;
 } TarArchive;
@@ -68,7 +73,7 @@ const struct mtar_ops filesystem_ops = {
 
 /* Heatshrink stream backend - compressed, read-only */
 
-typedef struct {
+typedef struct HeatshrinkStream {
     CompressConfigHeatshrink heatshrink_config;
     File* stream;
     CompressStreamDecoder* decoder;
@@ -129,6 +134,7 @@ TarArchive* tar_archive_alloc(Storage* storage) {
     TarArchive* archive = malloc(sizeof(TarArchive));
     archive->storage = storage;
     archive->stream = storage_file_alloc(archive->storage);
+    archive->hs_stream = NULL;
     archive->unpack_cb = NULL;
     return archive;
 }
@@ -185,12 +191,14 @@ bool tar_archive_open(TarArchive* archive, const char* path, TarOpenMode mode) {
         hs_stream->stream = stream;
         hs_stream->heatshrink_config.window_sz2 = header.window_sz2;
         hs_stream->heatshrink_config.lookahead_sz2 = header.lookahead_sz2;
-        hs_stream->heatshrink_config.input_buffer_sz = FILE_BLOCK_SIZE;
+        hs_stream->heatshrink_config.input_buffer_sz = EXTRACT_BLOCK_SIZE;
         hs_stream->decoder = compress_stream_decoder_alloc(
             CompressTypeHeatshrink, &hs_stream->heatshrink_config, file_read_cb, stream);
         mtar_init(&archive->tar, mtar_access, &heatshrink_ops, hs_stream);
+        archive->hs_stream = hs_stream;
     } else {
         mtar_init(&archive->tar, mtar_access, &filesystem_ops, stream);
+        archive->hs_stream = NULL;
     }
 
     return true;
@@ -286,101 +294,300 @@ bool tar_archive_file_finalize(TarArchive* archive) {
     return mtar_end_data(&archive->tar) == MTAR_ESUCCESS;
 }
 
+/* Extraction engine - reads the archive forward-only, in large blocks */
+
+typedef struct {
+    char name[100];
+    char mode[8];
+    char owner[8];
+    char group[8];
+    char size[12];
+    char mtime[12];
+    char checksum[8];
+    char type;
+    char linkname[100];
+    char magic[6];
+    char version[2];
+    char uname[32];
+    char gname[32];
+    char devmajor[8];
+    char devminor[8];
+    char prefix[155];
+    char padding[12];
+} TarRawHeader;
+_Static_assert(sizeof(TarRawHeader) == FILE_BLOCK_SIZE, "Invalid TarRawHeader size");
+
+/* ustar prefix, separator and name */
+#define EXTRACT_NAME_LEN (155 + 1 + 100)
+
+#define TAR_RECORD_ALIGN(size) (((size) + FILE_BLOCK_SIZE - 1) & ~(FILE_BLOCK_SIZE - 1))
+
+/* Entry data is either skipped or written to dst_path */
+typedef enum {
+    TarExtractActionSkip,
+    TarExtractActionWrite,
+    TarExtractActionWriteAndStop,
+    TarExtractActionFail,
+} TarExtractAction;
+
 typedef struct {
     TarArchive* archive;
-    const char* work_dir;
-    TarArchiveNameConverter converter;
-} TarArchiveDirectoryOpParams;
+    uint8_t* buffer;
+    File* out_file;
+    size_t bytes_written;
+    /* Current entry */
+    char name[EXTRACT_NAME_LEN + 1];
+    char type;
+    uint32_t size;
+    FuriString* dst_path;
+} TarExtractor;
+
+typedef TarExtractAction (*TarExtractEntryCallback)(TarExtractor* extractor, void* context);
+
+static bool tar_extractor_read(TarExtractor* extractor, uint8_t* data, size_t size) {
+    TarArchive* archive = extractor->archive;
+    if(archive->hs_stream) {
+        return compress_stream_decoder_read(archive->hs_stream->decoder, data, size);
+    }
+    return storage_file_read(archive->stream, data, size) == size;
+}
 
-static bool archive_extract_current_file(TarArchive* archive, const char* dst_path) {
-    mtar_t* tar = &archive->tar;
-    File* out_file = storage_file_alloc(archive->storage);
-    uint8_t* readbuf = malloc(FILE_BLOCK_SIZE);
+static bool tar_extractor_skip(TarExtractor* extractor, size_t size) {
+    TarArchive* archive = extractor->archive;
+    if(!archive->hs_stream) {
+        uint64_t position = storage_file_tell(archive->stream) + size;
+        return position <= storage_file_size(archive->stream) &&
+               storage_file_seek(archive->stream, position, true);
+    }
+
+    /* Compressed data still has to be decoded, but it never reaches the storage */
+    while(size) {
+        size_t chunk = MIN(size, (size_t)EXTRACT_BLOCK_SIZE);
+        if(!tar_extractor_read(extractor, extractor->buffer, chunk)) {
+            return false;
+        }
+        size -= chunk;
+    }
+    return true;
+}
+
+static bool tar_parse_octal(const char* field, size_t field_len, uint32_t* value) {
+    size_t i = 0;
+    while(i < field_len && field[i] == ' ') {
+        i++;
+    }
+    if(i == field_len || field[i] < '0' || field[i] > '7') {
+        return false;
+    }
+
+    uint32_t result = 0;
+    for(; i < field_len && field[i] >= '0' && field[i] <= '7'; i++) {
+        result = (result << 3) | (uint32_t)(field[i] - '0');
+    }
+    *value = result;
+    return true;
+}
+
+static bool tar_extractor_read_header(TarExtractor* extractor, bool* is_end) {
+    const TarRawHeader* header = (const TarRawHeader*)extractor->buffer;
+    *is_end = false;
+
+    if(!tar_extractor_read(extractor, extractor->buffer, sizeof(TarRawHeader))) {
+        return false;
+    }
+
+    /* Same end of archive check as in microtar */
+    if(header->checksum[0] == '\0') {
+        *is_end = true;
+        return true;
+    }
+
+    /* Checksum is calculated with the checksum field filled with spaces */
+    uint32_t checksum = 0, expected_checksum = 0;
+    for(size_t i = 0; i < sizeof(TarRawHeader); i++) {
+        checksum += extractor->buffer[i];
+    }
+    for(size_t i = 0; i < sizeof(header->checksum); i++) {
+        checksum += ' ' - (uint8_t)header->checksum[i];
+    }
+    if(!tar_parse_octal(header->checksum, sizeof(header->checksum), &expected_checksum) ||
+       checksum != expected_checksum) {
+        FURI_LOG_E(TAG, "Bad header checksum");
+        return false;
+    }
+
+    if(!tar_parse_octal(header->size, sizeof(header->size), &extractor->size)) {
+        FURI_LOG_E(TAG, "Bad entry size");
+        return false;
+    }
+    extractor->type = header->type;
+
+    /* Long names are split in POSIX ustar, GNU format has no prefix field */
+    size_t name_len = 0;
+    if(memcmp(header->magic, "ustar", sizeof(header->magic)) == 0 && header->prefix[0]) {
+        name_len = strnlen(header->prefix, sizeof(header->prefix));
+        memcpy(extractor->name, header->prefix, name_len);
+        extractor->name[name_len++] = '/';
+    }
+    size_t base_len = strnlen(header->name, sizeof(header->name));
+    memcpy(&extractor->name[name_len], header->name, base_len);
+    extractor->name[name_len + base_len] = '\0';
+
+    return true;
+}
+
+static bool tar_extractor_write_file(TarExtractor* extractor) {
+    const char* dst_path = furi_string_get_cstr(extractor->dst_path);
+    File* out_file = extractor->out_file;
 
-    bool success = true;
     uint8_t n_tries = FILE_OPEN_NTRIES;
-    do {
-        while(n_tries-- > 0) {
-            if(storage_file_open(out_file, dst_path, FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
-                break;
-            }
-            FURI_LOG_W(TAG, "Failed to open '%s', reties: %d", dst_path, n_tries);
-            storage_file_close(out_file);
-            furi_delay_ms(FILE_OPEN_RETRY_DELAY);
+    while(n_tries-- > 0) {
+        if(storage_file_open(out_file, dst_path, FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+            break;
+        }
+        FURI_LOG_W(TAG, "Failed to open '%s', reties: %d", dst_path, n_tries);
+        storage_file_close(out_file);
+        furi_delay_ms(FILE_OPEN_RETRY_DELAY);
+    }
+
+    if(!storage_file_is_open(out_file)) {
+        return false;
+    }
+
+    /* Record padding is read along with the data, writes stay sector-aligned */
+    bool success = true;
+    size_t data_left = extractor->size;
+    size_t record_left = TAR_RECORD_ALIGN(data_left);
+    while(record_left) {
+        size_t chunk = MIN(record_left, (size_t)EXTRACT_BLOCK_SIZE);
+        size_t data_chunk = MIN(data_left, chunk);
+        if(!tar_extractor_read(extractor, extractor->buffer, chunk) ||
+           storage_file_write(out_file, extractor->buffer, data_chunk) != data_chunk) {
+            success = false;
+            break;
         }
+        data_left -= data_chunk;
+        record_left -= chunk;
+        extractor->bytes_written += data_chunk;
+    }
+
+    storage_file_close(out_file);
+    return success;
+}
+
+static bool tar_archive_extract(
+    TarArchive* archive,
+    TarExtractEntryCallback entry_cb,
+    void* context) {
+    /* Rewinds the underlying stream through the active backend */
+    if(mtar_access_mode(&archive->tar) != MTAR_READ ||
+       mtar_rewind(&archive->tar) != MTAR_ESUCCESS) {
+        return false;
+    }
 
-        if(!storage_file_is_open(out_file)) {
+    TarExtractor extractor = {
+        .archive = archive,
+        .buffer = malloc(EXTRACT_BLOCK_SIZE),
+        .out_file = storage_file_alloc(archive->storage),
+        .bytes_written = 0,
+        .dst_path = furi_string_alloc(),
+    };
+
+    uint32_t start_tick = furi_get_tick();
+    bool success = true;
+    while(true) {
+        bool is_end = false;
+        if(!tar_extractor_read_header(&extractor, &is_end)) {
             success = false;
             break;
         }
+        if(is_end) {
+            break;
+        }
+
+        furi_string_reset(extractor.dst_path);
+        TarExtractAction action = entry_cb(&extractor, context);
 
-        while(!mtar_eof_data(tar)) {
-            int32_t readcnt = mtar_read_data(tar, readbuf, FILE_BLOCK_SIZE);
-            if(!readcnt || !storage_file_write(out_file, readbuf, readcnt)) {
+        if(action == TarExtractActionFail) {
+            success = false;
+            break;
+        } else if(action == TarExtractActionSkip) {
+            if(!tar_extractor_skip(&extractor, TAR_RECORD_ALIGN(extractor.size))) {
+                success = false;
+                break;
+            }
+        } else {
+            if(!tar_extractor_write_file(&extractor)) {
                 success = false;
                 break;
             }
+            if(action == TarExtractActionWriteAndStop) {
+                break;
+            }
         }
-    } while(false);
-    storage_file_free(out_file);
-    free(readbuf);
+    }
+
+    FURI_LOG_I(
+        TAG,
+        "Extracted %zu bytes in %lu ms",
+        extractor.bytes_written,
+        furi_get_tick() - start_tick);
 
+    furi_string_free(extractor.dst_path);
+    storage_file_free(extractor.out_file);
+    free(extractor.buffer);
     return success;
 }
 
-static int archive_extract_foreach_cb(mtar_t* tar, const mtar_header_t* header, void* param) {
-    UNUSED(tar);
-    TarArchiveDirectoryOpParams* op_params = param;
-    TarArchive* archive = op_params->archive;
+typedef struct {
+    TarArchive* archive;
+    const char* work_dir;
+    TarArchiveNameConverter converter;
+} TarArchiveDirectoryOpParams;
 
-    bool skip_entry = false;
-    if(archive->unpack_cb) {
-        skip_entry = !archive->unpack_cb(
-            header->name, header->type == MTAR_TDIR, archive->unpack_cb_context);
-    }
+static TarExtractAction archive_extract_entry_cb(TarExtractor* extractor, void* context) {
+    TarArchiveDirectoryOpParams* op_params = context;
+    TarArchive* archive = op_params->archive;
+    const char* name = extractor->name;
+    bool is_dir = extractor->type == MTAR_TDIR;
 
-    if(skip_entry) {
-        FURI_LOG_W(TAG, "filter: skipping entry \"%s\"", header->name);
-        return 0;
+    if(archive->unpack_cb && !archive->unpack_cb(name, is_dir, archive->unpack_cb_context)) {
+        FURI_LOG_D(TAG, "filter: skipping entry \"%s\"", name);
+        return TarExtractActionSkip;
     }
 
     FuriString* full_extracted_fname;
-    if(header->type == MTAR_TDIR) {
+    if(is_dir) {
         // Skip "/" entry since concat would leave it dangling, also want caller to mkdir destination
-        if(strcmp(header->name, "/") == 0) {
-            return 0;
+        if(strcmp(name, "/") == 0) {
+            return TarExtractActionSkip;
         }
 
         full_extracted_fname = furi_string_alloc();
-        path_concat(op_params->work_dir, header->name, full_extracted_fname);
+        path_concat(op_params->work_dir, name, full_extracted_fname);
 
         bool create_res =
             storage_simply_mkdir(archive->storage, furi_string_get_cstr(full_extracted_fname));
         furi_string_free(full_extracted_fname);
-        return create_res ? 0 : -1;
+        return create_res ? TarExtractActionSkip : TarExtractActionFail;
     }
 
-    if(header->type != MTAR_TREG) {
-        FURI_LOG_W(TAG, "not extracting unsupported type \"%s\"", header->name);
-        return 0;
+    if(extractor->type != MTAR_TREG) {
+        FURI_LOG_W(TAG, "not extracting unsupported type \"%s\"", name);
+        return TarExtractActionSkip;
     }
 
-    FURI_LOG_D(TAG, "Extracting %u bytes to '%s'", header->size, header->name);
+    FURI_LOG_D(TAG, "Extracting %lu bytes to '%s'", extractor->size, name);
 
-    FuriString* converted_fname = furi_string_alloc_set(header->name);
+    FuriString* converted_fname = furi_string_alloc_set(name);
     if(op_params->converter) {
         op_params->converter(converted_fname);
     }
 
-    full_extracted_fname = furi_string_alloc();
-    path_concat(op_params->work_dir, furi_string_get_cstr(converted_fname), full_extracted_fname);
-
-    bool success =
-        archive_extract_current_file(archive, furi_string_get_cstr(full_extracted_fname));
+    path_concat(op_params->work_dir, furi_string_get_cstr(converted_fname), extractor->dst_path);
 
     furi_string_free(converted_fname);
-    furi_string_free(full_extracted_fname);
-    return success ? 0 : MTAR_EFAILURE;
+    return TarExtractActionWrite;
 }
 
 bool tar_archive_unpack_to(
@@ -396,7 +603,7 @@ bool tar_archive_unpack_to(
 
     FURI_LOG_I(TAG, "Restoring '%s'", destination);
 
-    return mtar_foreach(&archive->tar, archive_extract_foreach_cb, &param) == MTAR_ESUCCESS;
+    return tar_archive_extract(archive, archive_extract_entry_cb, &param);
 }
 
 bool tar_archive_add_file(
@@ -501,6 +708,23 @@ bool tar_archive_add_dir(TarArchive* archive, const char* fs_full_path, const ch
     return success;
 }
 
+typedef struct {
+    const char* archive_fname;
+    const char* destination;
+    bool found;
+} TarArchiveFileOpParams;
+
+static TarExtractAction archive_find_entry_cb(TarExtractor* extractor, void* context) {
+    TarArchiveFileOpParams* op_params = context;
+    if(strcmp(extractor->name, op_params->archive_fname) != 0) {
+        return TarExtractActionSkip;
+    }
+
+    op_params->found = true;
+    furi_string_set(extractor->dst_path, op_params->destination);
+    return TarExtractActionWriteAndStop;
+}
+
 bool tar_archive_unpack_file(
     TarArchive* archive,
     const char* archive_fname,
@@ -508,8 +732,11 @@ bool tar_archive_unpack_file(
     furi_check(archive);
     furi_check(archive_fname);
     furi_check(destination);
-    if(mtar_find(&archive->tar, archive_fname) != MTAR_ESUCCESS) {
-        return false;
-    }
-    return archive_extract_current_file(archive, destination);
+    TarArchiveFileOpParams param = {
+        .archive_fname = archive_fname,
+        .destination = destination,
+        .found = false,
+    };
+
+    return tar_archive_extract(archive, archive_find_entry_cb, &param) && param.found;
 }
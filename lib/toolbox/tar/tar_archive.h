@@ -59,6 +59,9 @@ typedef void (*TarArchiveNameConverter)(FuriString*);
 /* High-level API  - assumes archive is open */
 
 /** Unpack tar archive to destination
+ *
+ * The archive is read in a single forward pass, entries rejected by the
+ * per-entry callback are skipped without touching the destination storage.
  *
  * @param       archive       Tar archive object. Must be opened in read mode
  * @param[in]   destination   Destination path
@@ -115,6 +118,8 @@ int32_t tar_archive_get_entries_count(TarArchive* archive);
 bool tar_archive_get_read_progress(TarArchive* archive, int32_t* processed, int32_t* total);
 
 /** Unpack single file from tar archive
+ *
+ * Reading stops at the first entry with a matching name.
  *
  * @param       archive       Tar archive object. Must be opened in read mode
  * @param[in]   archive_fname Name of the file in the archive
@@ -8,6 +8,7 @@
 #include <furi_hal_interrupt.h>
 #include <furi_hal_resources.h>
 #include <furi_hal_bus.h>
+#include <furi_hal_power.h>
 
 #include <stm32wbxx_ll_dma.h>
 
@@ -17,6 +18,9 @@
 
 #define TAG "FuriHalSubGhz"
 
+/* Battery temperature is used to detect synthesizer calibration drift */
+#define SUBGHZ_TEMPERATURE_UPDATE_MS 10000
+
 static uint32_t furi_hal_subghz_debug_gpio_buff[2] = {0};
 
 /* DMA Channels definition */
@@ -63,6 +67,19 @@ volatile FuriHalSubGhz furi_hal_subghz = {
     .dangerous_frequency_i = false,
 };
 
+static CC1101CalibrationCache furi_hal_subghz_calibration_cache = {0};
+static FuriTimer* furi_hal_subghz_temperature_timer = NULL;
+
+static int8_t furi_hal_subghz_get_temperature(void) {
+    return (int8_t)furi_hal_power_get_battery_temperature(FuriHalPowerICFuelGauge);
+}
+
+static void furi_hal_subghz_temperature_timer_callback(void* context) {
+    UNUSED(context);
+    cc1101_calibration_cache_set_temperature(
+        &furi_hal_subghz_calibration_cache, furi_hal_subghz_get_temperature());
+}
+
 int8_t furi_hal_subghz_get_rolling_counter_mult(void) {
     return furi_hal_subghz.rolling_counter_mult;
 }
@@ -165,6 +182,10 @@ void furi_hal_subghz_sleep(void) {
     cc1101_shutdown(&furi_hal_spi_bus_handle_subghz);
 
     furi_hal_spi_release(&furi_hal_spi_bus_handle_subghz);
+
+    if(furi_hal_subghz_temperature_timer) {
+        furi_timer_stop(furi_hal_subghz_temperature_timer);
+    }
 }
 
 void furi_hal_subghz_dump_state(void) {
@@ -302,6 +323,18 @@ void furi_hal_subghz_reset(void) {
     // Warning: push pull cc1101 clock output on GD0
     cc1101_write_reg(&furi_hal_spi_bus_handle_subghz, CC1101_IOCFG0, CC1101IocfgHighImpedance);
     furi_hal_spi_release(&furi_hal_spi_bus_handle_subghz);
+
+    // Temperature for the calibration cache is tracked while radio is in use
+    if(!furi_hal_subghz_temperature_timer) {
+        cc1101_calibration_cache_reset(
+            &furi_hal_subghz_calibration_cache, furi_hal_subghz_get_temperature());
+        furi_hal_subghz_temperature_timer = furi_timer_alloc(
+            furi_hal_subghz_temperature_timer_callback, FuriTimerTypePeriodic, NULL);
+    } else {
+        furi_hal_subghz_temperature_timer_callback(NULL);
+    }
+    furi_timer_start(
+        furi_hal_subghz_temperature_timer, furi_ms_to_ticks(SUBGHZ_TEMPERATURE_UPDATE_MS));
 }
 
 void furi_hal_subghz_idle(void) {
@@ -411,9 +444,8 @@ uint32_t furi_hal_subghz_set_frequency(uint32_t value) {
 
     furi_hal_spi_acquire(&furi_hal_spi_bus_handle_subghz);
     uint32_t real_frequency = cc1101_set_frequency(&furi_hal_spi_bus_handle_subghz, value);
-    cc1101_calibrate(&furi_hal_spi_bus_handle_subghz);
-
-    furi_check(cc1101_wait_status_state(&furi_hal_spi_bus_handle_subghz, CC1101StateIDLE, 10000));
+    furi_check(cc1101_calibrate_cached(
+        &furi_hal_spi_bus_handle_subghz, &furi_hal_subghz_calibration_cache, real_frequency));
 
     furi_hal_spi_release(&furi_hal_spi_bus_handle_subghz);
     return real_frequency;
@@ -184,6 +184,9 @@ int8_t furi_hal_subghz_get_rolling_counter_mult(void);
 void furi_hal_subghz_set_rolling_counter_mult(int8_t mult);
 
 /** Set frequency
+ *
+ * Synthesizer calibration is cached per frequency, so automatic calibration
+ * (MCSM0 FS_AUTOCAL) is disabled until the next preset load.
  *
  * @param      value  frequency in Hz
  *